@@ -14,9 +14,9 @@ namespace rtt_RTT_Format_Reader {
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Parses the cell_data block data from the mesh file via calls to private member functions.
- * \param meshfile Mesh file name.
+ * \param meshfile Mesh file buffer.
  */
-void CellData::readCellData(ifstream &meshfile) {
+void CellData::readCellData(Token_Buffer &meshfile) {
   readKeyword(meshfile);
   if (dims.get_ncell_data() > 0)
     readData(meshfile);
@@ -26,46 +26,52 @@ void CellData::readCellData(ifstream &meshfile) {
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Reads and validates the cell_data block keyword.
- * \param meshfile Mesh file name.
+ * \param meshfile Mesh file buffer.
  */
-void CellData::readKeyword(ifstream &meshfile) {
-  string dummyString;
-
-  meshfile >> dummyString;
-  Insist(dummyString == "celldat", "Invalid mesh file: celldat block missing");
-  std::getline(meshfile, dummyString);
+void CellData::readKeyword(Token_Buffer &meshfile) {
+  Insist(meshfile.next_word() == "celldat", "Invalid mesh file: celldat block missing");
+  meshfile.skip_line();
 }
 
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Reads and validates the cell_data block data.
- * \param meshfile Mesh file name.
+ * \param meshfile Mesh file buffer.
  */
-void CellData::readData(ifstream &meshfile) {
-  string dummyString;
-  size_t cellNum;
+void CellData::readData(Token_Buffer &meshfile) {
+  const size_t ndata = dims.get_ncell_data();
 
   for (size_t i = 0; i < dims.get_ncells(); ++i) {
-    meshfile >> cellNum;
-    Insist(cellNum == i + 1, "Invalid mesh file: cell data index out of order");
-    for (size_t j = 0; j < dims.get_ncell_data(); ++j) {
-      meshfile >> data[i][j];
-    }
-    std::getline(meshfile, dummyString);
+    const int cellNum = meshfile.next_int();
+    Insist(static_cast<size_t>(cellNum) == i + 1,
+           "Invalid mesh file: cell data index out of order");
+    for (size_t j = 0; j < ndata; ++j)
+      data[i * ndata + j] = meshfile.next_double();
+    meshfile.skip_line();
   }
 }
 
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Reads and validate the end_celldat block keyword.
- * \param meshfile Mesh file name.
+ * \param meshfile Mesh file buffer.
  */
-void CellData::readEndKeyword(ifstream &meshfile) {
-  string dummyString;
+void CellData::readEndKeyword(Token_Buffer &meshfile) {
+  Insist(meshfile.next_word() == "end_celldat", "Invalid mesh file: celldat block missing end");
+  meshfile.skip_line(); // read and discard blank line.
+}
 
-  meshfile >> dummyString;
-  Insist(dummyString == "end_celldat", "Invalid mesh file: celldat block missing end");
-  std::getline(meshfile, dummyString); // read and discard blank line.
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Returns all of the data field values for each of the cells.
+ * \return The data field values for each of the cells.
+ */
+CellData::vector_vector_dbl CellData::get_data() const {
+  vector_vector_dbl cell_data;
+  cell_data.reserve(dims.get_ncells());
+  for (size_t i = 0; i < dims.get_ncells(); ++i)
+    cell_data.push_back(get_data(i));
+  return cell_data;
 }
 
 } // end namespace rtt_RTT_Format_Reader
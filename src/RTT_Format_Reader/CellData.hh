@@ -22,17 +22,16 @@ namespace rtt_RTT_Format_Reader {
 //================================================================================================//
 class CellData {
   // typedefs
-  using ifstream = std::ifstream;
   using string = std::string;
   using vector_dbl = std::vector<double>;
   using vector_vector_dbl = std::vector<std::vector<double>>;
 
   const Dims &dims;
-  vector_vector_dbl data;
+  vector_dbl data;
 
 public:
   explicit CellData(const Dims &dims_)
-      : dims(dims_), data(dims.get_ncells(), vector_dbl(dims.get_ncell_data())) {}
+      : dims(dims_), data(dims.get_ncells() * dims.get_ncell_data()) {}
   ~CellData() = default;
 
   CellData(CellData const &rhs) = delete;
@@ -40,26 +39,32 @@ public:
   CellData &operator=(CellData const &rhs) = delete;
   CellData &operator=(CellData &&rhs) noexcept = delete;
 
-  void readCellData(ifstream &meshfile);
+  void readCellData(Token_Buffer &meshfile);
 
 private:
-  void readKeyword(ifstream &meshfile);
-  void readData(ifstream &meshfile);
-  void readEndKeyword(ifstream &meshfile);
+  void readKeyword(Token_Buffer &meshfile);
+  void readData(Token_Buffer &meshfile);
+  void readEndKeyword(Token_Buffer &meshfile);
 
 public:
+  vector_vector_dbl get_data() const;
+
   /*!
-   * \brief Returns all of the data field values for each of the cells.
-   * \return The data field values for each of the cells.
+   * \brief Returns the data field values of all of the cells in one array, cell-major.
+   * \return The get_ncell_data() data field values of each of the cells.
    */
-  vector_vector_dbl get_data() const { return data; }
+  const vector_dbl &get_flat_data() const { return data; }
 
   /*!
    * \brief Returns all of the data field values for the specified cell.
    * \param cell_numb Cell number.
    * \return The cell data field values.
    */
-  vector_dbl get_data(size_t cell_numb) const { return data[cell_numb]; }
+  vector_dbl get_data(size_t cell_numb) const {
+    const size_t ndata = dims.get_ncell_data();
+    const auto first = data.begin() + static_cast<std::ptrdiff_t>(cell_numb * ndata);
+    return vector_dbl(first, first + static_cast<std::ptrdiff_t>(ndata));
+  }
 
   /*!
    * \brief Returns the specified data field value for the specified cel.
@@ -67,7 +72,9 @@ public:
    * \param data_index Data field.
    * \return The cell data field value.
    */
-  double get_data(size_t cell_numb, size_t data_index) const { return data[cell_numb][data_index]; }
+  double get_data(size_t cell_numb, size_t data_index) const {
+    return data[cell_numb * dims.get_ncell_data() + data_index];
+  }
 };
 
 } // end namespace rtt_RTT_Format_Reader
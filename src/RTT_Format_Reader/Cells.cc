@@ -14,9 +14,9 @@ namespace rtt_RTT_Format_Reader {
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Parses the cells block data from the mesh file via calls to private member functions.
-  * \param meshfile Mesh file name.
+ * \param meshfile Mesh file buffer.
  */
-void Cells::readCells(ifstream &meshfile) {
+void Cells::readCells(Token_Buffer &meshfile) {
   readKeyword(meshfile);
   readData(meshfile);
   readEndKeyword(meshfile);
@@ -25,63 +25,51 @@ void Cells::readCells(ifstream &meshfile) {
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Reads and validates the cells block keyword.
- * \param meshfile Mesh file name.
+ * \param meshfile Mesh file buffer.
  */
-void Cells::readKeyword(ifstream &meshfile) {
-  string dummyString;
-
-  meshfile >> dummyString;
-  Insist(dummyString == "cells", "Invalid mesh file: cells block missing");
-  std::getline(meshfile, dummyString);
+void Cells::readKeyword(Token_Buffer &meshfile) {
+  Insist(meshfile.next_word() == "cells", "Invalid mesh file: cells block missing");
+  meshfile.skip_line();
 }
 
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Reads and validates the cells block data.
- * \param meshfile Mesh file name.
+ * \param meshfile Mesh file buffer.
  */
-void Cells::readData(ifstream &meshfile) {
-  string dummyString;
-  int cellNum;
+void Cells::readData(Token_Buffer &meshfile) {
+  const size_t nflag_types = dims.get_ncell_flag_types();
 
   for (size_t i = 0; i < dims.get_ncells(); ++i) {
-    cellNum = Nodes::readNextInt(meshfile);
-    // meshfile >> cellNum;
+    const int cellNum = meshfile.next_int_skip_comments();
     Insist(static_cast<size_t>(cellNum) == i + 1, "Invalid mesh file: cell index out of order");
     Check(i < cellType.size());
-    meshfile >> cellType[i];
-    --cellType[i];
+    cellType[i] = meshfile.next_int() - 1;
     Insist(dims.allowed_cell_type(cellType[i]), "Invalid mesh file: illegal cell type");
-    Check(i < nodes.size());
-    nodes[i].resize(cellDefs.get_nnodes(cellType[i]));
-    for (unsigned j = 0; j < cellDefs.get_nnodes(cellType[i]); ++j) {
-      Check(j < nodes[i].size());
-      meshfile >> nodes[i][j];
-      --nodes[i][j];
-    }
+    const size_t nnodes = cellDefs.get_nnodes(cellType[i]);
+    for (size_t j = 0; j < nnodes; ++j)
+      nodes.push_back(static_cast<unsigned>(meshfile.next_int()) - 1);
+    nodeOffset[i + 1] = nodes.size();
 
-    for (size_t j = 0; j < dims.get_ncell_flag_types(); ++j) {
-      Check(j < flags[i].size());
-      meshfile >> flags[i][j];
+    for (size_t j = 0; j < nflag_types; ++j) {
+      const int flag = meshfile.next_int();
       Check(j < INT_MAX);
-      Insist(cellFlags.allowed_flag(static_cast<int>(j), flags[i][j]),
+      Insist(cellFlags.allowed_flag(static_cast<int>(j), flag),
              "Invalid mesh file: illegal cell flag");
+      flags[i * nflag_types + j] = flag;
     }
-    std::getline(meshfile, dummyString);
+    meshfile.skip_line();
   }
 }
 
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Reads and validates the end_cells block keyword.
- * \param meshfile Mesh file name.
+ * \param meshfile Mesh file buffer.
  */
-void Cells::readEndKeyword(ifstream &meshfile) {
-  string dummyString;
-
-  meshfile >> dummyString;
-  Insist(dummyString == "end_cells", "Invalid mesh file: cells block missing end");
-  std::getline(meshfile, dummyString); // read and discard blank line.
+void Cells::readEndKeyword(Token_Buffer &meshfile) {
+  Insist(meshfile.next_word() == "end_cells", "Invalid mesh file: cells block missing end");
+  meshfile.skip_line(); // read and discard blank line.
 }
 
 //------------------------------------------------------------------------------------------------//
@@ -107,9 +95,10 @@ void Cells::redefineCells() {
       temp_nodes.resize(cellDefs.get_nnodes(this_cell_type));
       for (size_t c = 0; c < dims.get_ncells(); c++) {
         if (cellType[c] == this_cell_type) {
-          for (size_t n = 0; n < nodes[c].size(); n++)
-            temp_nodes[node_map[n]] = nodes[c][n];
-          nodes[c] = temp_nodes;
+          const auto first = nodes.begin() + static_cast<std::ptrdiff_t>(nodeOffset[c]);
+          for (size_t n = 0; n < temp_nodes.size(); n++)
+            temp_nodes[node_map[n]] = first[static_cast<std::ptrdiff_t>(n)];
+          std::copy(temp_nodes.begin(), temp_nodes.end(), first);
         }
       }
     }
@@ -117,6 +106,19 @@ void Cells::redefineCells() {
   }
 }
 
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Returns all of the node numbers for each of the cells.
+ * \return The node numbers for all cells.
+ */
+Cells::vector_vector_uint Cells::get_nodes() const {
+  vector_vector_uint cell_nodes;
+  cell_nodes.reserve(dims.get_ncells());
+  for (size_t c = 0; c < dims.get_ncells(); ++c)
+    cell_nodes.push_back(get_nodes(c));
+  return cell_nodes;
+}
+
 } // end namespace rtt_RTT_Format_Reader
 
 //------------------------------------------------------------------------------------------------//
@@ -19,7 +19,6 @@ namespace rtt_RTT_Format_Reader {
 //! Controls parsing, storing, and accessing the data specific to the cells block of the mesh file.
 class Cells {
   // typedefs
-  using ifstream = std::ifstream;
   using string = std::string;
   using vector_int = std::vector<int>;
   using vector_vector_int = std::vector<std::vector<int>>;
@@ -30,14 +29,15 @@ class Cells {
   const Dims &dims;
   const CellDefs &cellDefs;
   vector_int cellType;
-  vector_vector_uint nodes;
-  vector_vector_int flags;
+  std::vector<size_t> nodeOffset;
+  vector_uint nodes;
+  vector_int flags;
 
 public:
   Cells(const CellFlags &cellFlags_, const Dims &dims_, const CellDefs &cellDefs_)
       : cellFlags(cellFlags_), dims(dims_), cellDefs(cellDefs_), cellType(dims.get_ncells()),
-        nodes(dims.get_ncells()),
-        flags(dims.get_ncells(), vector_int(dims.get_ncell_flag_types())) { /* empty */
+        nodeOffset(dims.get_ncells() + 1, 0), nodes(),
+        flags(dims.get_ncells() * dims.get_ncell_flag_types()) { /* empty */
   }
   ~Cells() = default;
   Cells(Cells const &rhs) = delete;
@@ -45,7 +45,7 @@ public:
   Cells &operator=(Cells const &rhs) = delete;
   Cells &operator=(Cells &&rhs) noexcept = delete;
 
-  void readCells(ifstream &meshfile);
+  void readCells(Token_Buffer &meshfile);
   void redefineCells();
 
   /*!
@@ -55,18 +55,29 @@ public:
    */
   int get_type(size_t cell_numb) const { return cellType[cell_numb]; }
 
+  vector_vector_uint get_nodes() const;
+
+  /*!
+   * \brief Returns the node numbers of all of the cells in one array, cell-major.
+   * \return The node numbers for all cells; those of cell i start at get_node_offsets()[i].
+   */
+  const vector_uint &get_flat_nodes() const { return nodes; }
+
   /*!
-   * \brief Returns all of the node numbers for each of the cells.
-   * \return The node numbers for all cells.
-  */
-  vector_vector_uint get_nodes() const { return nodes; }
+   * \brief Returns the offset of each cell's node numbers in get_flat_nodes(), and their total.
+   * \return The get_ncells() + 1 offsets.
+   */
+  const std::vector<size_t> &get_node_offsets() const { return nodeOffset; }
 
   /*!
    * \brief Returns all of the node numbers associated with the specified cell.
    * \param cell_numb Cell number.
    * \return The cell node numbers.
    */
-  vector_uint get_nodes(size_t cell_numb) const { return nodes[cell_numb]; }
+  vector_uint get_nodes(size_t cell_numb) const {
+    return vector_uint(nodes.begin() + static_cast<std::ptrdiff_t>(nodeOffset[cell_numb]),
+                       nodes.begin() + static_cast<std::ptrdiff_t>(nodeOffset[cell_numb + 1]));
+  }
 
   /*!
    * \brief Returns the node number associated with the specified cell and cell-node index.
@@ -74,7 +85,9 @@ public:
    * \param node_numb Cell-node index number.
    * \return The cell node number.
    */
-  int get_nodes(size_t cell_numb, size_t node_numb) const { return nodes[cell_numb][node_numb]; }
+  int get_nodes(size_t cell_numb, size_t node_numb) const {
+    return static_cast<int>(nodes[nodeOffset[cell_numb] + node_numb]);
+  }
 
   /*!
    * \brief Returns the cell flag for the specified cell and flag index
@@ -82,12 +95,14 @@ public:
    * \param flag_numb Cell flag index.
    * \return The cell flag.
    */
-  int get_flags(size_t cell_numb, size_t flag_numb) const { return flags[cell_numb][flag_numb]; }
+  int get_flags(size_t cell_numb, size_t flag_numb) const {
+    return flags[cell_numb * dims.get_ncell_flag_types() + flag_numb];
+  }
 
 private:
-  void readKeyword(ifstream &meshfile);
-  void readData(ifstream &meshfile);
-  void readEndKeyword(ifstream &meshfile);
+  void readKeyword(Token_Buffer &meshfile);
+  void readData(Token_Buffer &meshfile);
+  void readEndKeyword(Token_Buffer &meshfile);
 };
 
 } // end namespace rtt_RTT_Format_Reader
@@ -14,9 +14,9 @@ namespace rtt_RTT_Format_Reader {
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Parses the node_data block data from the mesh file via calls to private member functions.
- * \param meshfile Mesh file name.
+ * \param meshfile Mesh file buffer.
  */
-void NodeData::readNodeData(ifstream &meshfile) {
+void NodeData::readNodeData(Token_Buffer &meshfile) {
   readKeyword(meshfile);
   if (dims.get_nnode_data() > 0)
     readData(meshfile);
@@ -26,45 +26,52 @@ void NodeData::readNodeData(ifstream &meshfile) {
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Reads and validates the node_data block keyword.
- * \param meshfile Mesh file name.
+ * \param meshfile Mesh file buffer.
  */
-void NodeData::readKeyword(ifstream &meshfile) {
-  string dummyString;
-
-  meshfile >> dummyString;
-  Insist(dummyString == "nodedat", "Invalid mesh file: nodedat block missing");
-  std::getline(meshfile, dummyString);
+void NodeData::readKeyword(Token_Buffer &meshfile) {
+  Insist(meshfile.next_word() == "nodedat", "Invalid mesh file: nodedat block missing");
+  meshfile.skip_line();
 }
 
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Reads and validates the node_data block datae.
- * \param meshfile Mesh file name.
+ * \param meshfile Mesh file buffer.
  */
-void NodeData::readData(ifstream &meshfile) {
-  string dummyString;
-  size_t nodeNum;
+void NodeData::readData(Token_Buffer &meshfile) {
+  const size_t ndata = dims.get_nnode_data();
 
   for (size_t i = 0; i < dims.get_nnodes(); ++i) {
-    meshfile >> nodeNum;
-    Insist(nodeNum == i + 1, "Invalid mesh file: node data index out of order");
-    for (size_t j = 0; j < dims.get_nnode_data(); ++j)
-      meshfile >> data[i][j];
-    std::getline(meshfile, dummyString);
+    const int nodeNum = meshfile.next_int();
+    Insist(static_cast<size_t>(nodeNum) == i + 1,
+           "Invalid mesh file: node data index out of order");
+    for (size_t j = 0; j < ndata; ++j)
+      data[i * ndata + j] = meshfile.next_double();
+    meshfile.skip_line();
   }
 }
 
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Reads and validates the end_nodedat block keyword.
- * \param meshfile Mesh file name.
+ * \param meshfile Mesh file buffer.
  */
-void NodeData::readEndKeyword(ifstream &meshfile) {
-  string dummyString;
+void NodeData::readEndKeyword(Token_Buffer &meshfile) {
+  Insist(meshfile.next_word() == "end_nodedat", "Invalid mesh file: nodedat block missing end");
+  meshfile.skip_line(); // read and discard blank line.
+}
 
-  meshfile >> dummyString;
-  Insist(dummyString == "end_nodedat", "Invalid mesh file: nodedat block missing end");
-  std::getline(meshfile, dummyString); // read and discard blank line.
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Returns all of the data field values for each of the nodes.
+ * \return The data field values for each of the nodes.
+ */
+NodeData::vector_vector_dbl NodeData::get_data() const {
+  vector_vector_dbl node_data;
+  node_data.reserve(dims.get_nnodes());
+  for (size_t i = 0; i < dims.get_nnodes(); ++i)
+    node_data.push_back(get_data(i));
+  return node_data;
 }
 
 } // end namespace rtt_RTT_Format_Reader
@@ -23,42 +23,47 @@ namespace rtt_RTT_Format_Reader {
 class NodeData {
 
 private:
-  void readKeyword(std::ifstream &meshfile);
-  void readData(std::ifstream &meshfile);
-  void readEndKeyword(std::ifstream &meshfile);
+  void readKeyword(Token_Buffer &meshfile);
+  void readData(Token_Buffer &meshfile);
+  void readEndKeyword(Token_Buffer &meshfile);
 
   // typedefs
-  using ifstream = std::ifstream;
   using string = std::string;
   using vector_dbl = std::vector<double>;
   using vector_vector_dbl = std::vector<std::vector<double>>;
 
   const Dims &dims;
-  vector_vector_dbl data;
+  vector_dbl data;
 
 public:
   explicit NodeData(const Dims &dims_)
-      : dims(dims_), data(dims.get_nnodes(), vector_dbl(dims.get_nnode_data())) {}
+      : dims(dims_), data(dims.get_nnodes() * dims.get_nnode_data()) {}
   ~NodeData() = default;
   NodeData(NodeData const &rhs) = delete;
   NodeData(NodeData &&rhs) noexcept = delete;
   NodeData &operator=(NodeData const &rhs) = delete;
   NodeData &operator=(NodeData &&rhs) noexcept = delete;
 
-  void readNodeData(ifstream &meshfile);
+  void readNodeData(Token_Buffer &meshfile);
+
+  vector_vector_dbl get_data() const;
 
   /*!
-   * \brief Returns all of the data field values for each of the nodes.
-   * \return The data field values for each of the nodes.
+   * \brief Returns the data field values of all of the nodes in one array, node-major.
+   * \return The get_nnode_data() data field values of each of the nodes.
    */
-  vector_vector_dbl get_data() const { return data; }
+  const vector_dbl &get_flat_data() const { return data; }
 
   /*!
    * \brief Returns all of the data field values for the specified node.
    * \param node_numb Node number.
    * \return The node data field values.
    */
-  vector_dbl get_data(size_t node_numb) const { return data[node_numb]; }
+  vector_dbl get_data(size_t node_numb) const {
+    const size_t ndata = dims.get_nnode_data();
+    const auto first = data.begin() + static_cast<std::ptrdiff_t>(node_numb * ndata);
+    return vector_dbl(first, first + static_cast<std::ptrdiff_t>(ndata));
+  }
 
   /*!
    * \brief Returns the specified data field value for the specified node.
@@ -66,7 +71,9 @@ public:
    * \param data_index Data field.
    * \return The node data field value.
    */
-  double get_data(size_t node_numb, size_t data_index) const { return data[node_numb][data_index]; }
+  double get_data(size_t node_numb, size_t data_index) const {
+    return data[node_numb * dims.get_nnode_data() + data_index];
+  }
 };
 
 } // end namespace rtt_RTT_Format_Reader
@@ -14,9 +14,9 @@ namespace rtt_RTT_Format_Reader {
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Parses the nodes block data from the mesh file via calls to private member functions.
- * \param meshfile Mesh file name.
+ * \param meshfile Mesh file buffer.
  */
-void Nodes::readNodes(ifstream &meshfile) {
+void Nodes::readNodes(Token_Buffer &meshfile) {
   readKeyword(meshfile);
   readData(meshfile);
   readEndKeyword(meshfile);
@@ -25,85 +25,61 @@ void Nodes::readNodes(ifstream &meshfile) {
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Reads and validates the nodes block keyword.
- * \param meshfile Mesh file name.
+ * \param meshfile Mesh file buffer.
  */
-void Nodes::readKeyword(ifstream &meshfile) {
-  string dummyString;
-
-  meshfile >> dummyString;
-  Insist(dummyString == "nodes", "Invalid mesh file: nodes block missing");
-  std::getline(meshfile, dummyString);
-}
-
-//------------------------------------------------------------------------------------------------//
-/*!
- * \brief Read next integer value from mesh file, skipping comments.
- * \param meshfile Input file stream for meshfile.
- * \return the next integer in the meshfile.
- */
-int Nodes::readNextInt(ifstream &meshfile) {
-  using std::atoi;
-
-  int retVal(0);
-  string dummyString;
-  bool commentLine = true;
-  while (commentLine) {
-    meshfile >> dummyString;
-    if (dummyString.rfind('!') == string::npos) {
-      commentLine = false;
-      retVal = atoi(dummyString.c_str());
-    } else { // Dump everything from here to the end of the line.
-      std::getline(meshfile, dummyString);
-      commentLine = true;
-    }
-  }
-  return retVal;
+void Nodes::readKeyword(Token_Buffer &meshfile) {
+  Insist(meshfile.next_word() == "nodes", "Invalid mesh file: nodes block missing");
+  meshfile.skip_line();
 }
 
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Reads and validates the nodes block data.
- * \param meshfile Mesh file name.
+ * \param meshfile Mesh file buffer.
  */
-void Nodes::readData(ifstream &meshfile) {
-  string dummyString;
-  int nodeNum;
+void Nodes::readData(Token_Buffer &meshfile) {
+  const size_t ndim = dims.get_ndim();
+  const size_t nflag_types = dims.get_nnode_flag_types();
 
   for (size_t i = 0; i < dims.get_nnodes(); ++i) {
-    nodeNum = readNextInt(meshfile);
-    // meshfile >> nodeNum;
+    const int nodeNum = meshfile.next_int_skip_comments();
     Insist(static_cast<size_t>(nodeNum) == i + 1, "Invalid mesh file: node index out of order");
-    Check(i < coords.size());
-    for (size_t j = 0; j < dims.get_ndim(); ++j) {
-      Check(j < coords[i].size());
-      meshfile >> coords[i][j];
-    }
     Check(i < parents.size());
-    meshfile >> parents[i];
-    --parents[i];
-    Check(i < flags.size());
-    for (size_t j = 0; j < dims.get_nnode_flag_types(); ++j) {
-      Check(j < flags[i].size());
-      meshfile >> flags[i][j];
+    for (size_t j = 0; j < ndim; ++j)
+      coords[i * ndim + j] = meshfile.next_double();
+    parents[i] = meshfile.next_int() - 1;
+    for (size_t j = 0; j < nflag_types; ++j) {
+      const int flag = meshfile.next_int();
       Check(j < INT_MAX);
-      Insist(nodeFlags.allowed_flag(static_cast<int>(j), flags[i][j]),
+      Insist(nodeFlags.allowed_flag(static_cast<int>(j), flag),
              "Invalid mesh file: illegal node flag");
+      flags[i * nflag_types + j] = flag;
     }
-    std::getline(meshfile, dummyString);
+    meshfile.skip_line();
   }
 }
 
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Reads and validates the end_nodes block keyword.
- * \param meshfile Mesh file name.
+ * \param meshfile Mesh file buffer.
  */
-void Nodes::readEndKeyword(ifstream &meshfile) {
-  string dummyString;
+void Nodes::readEndKeyword(Token_Buffer &meshfile) {
+  Insist(meshfile.next_word() == "end_nodes", "Invalid mesh file: nodes block missing end");
+  meshfile.skip_line(); // read and discard blank line.
+}
 
-  meshfile >> dummyString;
-  Insist(dummyString == "end_nodes", "Invalid mesh file: nodes block missing end");
-  std::getline(meshfile, dummyString); // read and discard blank line.
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Returns the coordinate values for each of the nodes.
+ * \return The coordinate values for the nodes.
+ */
+Nodes::vector_vector_dbl Nodes::get_coords() const {
+  vector_vector_dbl node_coords;
+  node_coords.reserve(dims.get_nnodes());
+  for (size_t i = 0; i < dims.get_nnodes(); ++i)
+    node_coords.push_back(get_coords(i));
+  return node_coords;
 }
 
 } // end namespace rtt_RTT_Format_Reader
@@ -11,6 +11,7 @@
 #define rtt_RTT_Format_Reader_Nodes_hh
 
 #include "NodeFlags.hh"
+#include "Token_Buffer.hh"
 
 namespace rtt_RTT_Format_Reader {
 
@@ -18,17 +19,19 @@ namespace rtt_RTT_Format_Reader {
 /*!
  * \brief Controls parsing, storing, and accessing the data specific to the nodes block of the mesh
  *        file.
+ *
+ * Coordinates and flags are stored node-major in flat arrays (get_ndim() coordinates and
+ * get_nnode_flag_types() flags per node).
  */
 //================================================================================================//
 class Nodes {
 
 private:
-  void readKeyword(std::ifstream &meshfile);
-  void readData(std::ifstream &meshfile);
-  void readEndKeyword(std::ifstream &meshfile);
+  void readKeyword(Token_Buffer &meshfile);
+  void readData(Token_Buffer &meshfile);
+  void readEndKeyword(Token_Buffer &meshfile);
 
   // typedefs
-  using ifstream = std::ifstream;
   using string = std::string;
   using vector_int = std::vector<int>;
   using vector_vector_int = std::vector<std::vector<int>>;
@@ -37,36 +40,39 @@ private:
 
   const NodeFlags &nodeFlags;
   const Dims &dims;
-  vector_vector_dbl coords;
+  vector_dbl coords;
   vector_int parents;
-  vector_vector_int flags;
+  vector_int flags;
 
 public:
   Nodes(const NodeFlags &nodeFlags_, const Dims &dims_)
-      : nodeFlags(nodeFlags_), dims(dims_), coords(dims.get_nnodes(), vector_dbl(dims.get_ndim())),
-        parents(dims.get_nnodes()),
-        flags(dims.get_nnodes(), vector_int(dims.get_nnode_flag_types())) {}
+      : nodeFlags(nodeFlags_), dims(dims_), coords(dims.get_nnodes() * dims.get_ndim()),
+        parents(dims.get_nnodes()), flags(dims.get_nnodes() * dims.get_nnode_flag_types()) {}
   ~Nodes() = default;
   Nodes(Nodes const &rhs) = delete;
   Nodes(Nodes &&rhs) noexcept = delete;
   Nodes &operator=(Nodes const &rhs) = delete;
   Nodes &operator=(Nodes &&rhs) noexcept = delete;
 
-  void readNodes(ifstream &meshfile);
-  static int readNextInt(ifstream &meshfile);
+  void readNodes(Token_Buffer &meshfile);
+
+  vector_vector_dbl get_coords() const;
 
   /*!
-   * \brief Returns the coordinate values for each of the nodes.
+   * \brief Returns the coordinate values of all of the nodes in one array, node-major.
    * \return The coordinate values for the nodes.
    */
-  vector_vector_dbl get_coords() const { return coords; }
+  const vector_dbl &get_flat_coords() const { return coords; }
 
   /*!
    * \brief Returns all of the coordinate values for the specified node.
    * \param node_numb Node number.
    * \return The node coordinate values.
    */
-  vector_dbl get_coords(size_t node_numb) const { return coords[node_numb]; }
+  vector_dbl get_coords(size_t node_numb) const {
+    const auto first = coords.begin() + static_cast<std::ptrdiff_t>(node_numb * dims.get_ndim());
+    return vector_dbl(first, first + static_cast<std::ptrdiff_t>(dims.get_ndim()));
+  }
 
   /*!
    * \brief Returns the coordinate value for the specified node and direction (i.e., x, y, and z).
@@ -75,7 +81,7 @@ public:
    * \return The node coordinate value.
    */
   double get_coords(size_t node_numb, size_t coord_index) const {
-    return coords[node_numb][coord_index];
+    return coords[node_numb * dims.get_ndim() + coord_index];
   }
 
   /*!
@@ -91,7 +97,9 @@ public:
    * \param flag_numb Node flag index.
    * \return The node flag.
    */
-  int get_flags(size_t node_numb, size_t flag_numb) const { return flags[node_numb][flag_numb]; }
+  int get_flags(size_t node_numb, size_t flag_numb) const {
+    return flags[node_numb * dims.get_nnode_flag_types() + flag_numb];
+  }
 };
 
 } // end namespace rtt_RTT_Format_Reader
@@ -49,13 +49,16 @@ void RTT_Format_Reader::readMesh(const string &RTT_File) {
     readFlagBlocks(meshfile);
     readDataIDs(meshfile);
     spCellDefs->readCellDefs(meshfile);
-    spNodes->readNodes(meshfile);
-    spSides->readSides(meshfile);
-    spCells->readCells(meshfile);
-    spNodeData->readNodeData(meshfile);
-    spSideData->readSideData(meshfile);
-    spCellData->readCellData(meshfile);
-    readEndKeyword(meshfile);
+
+    // the remaining blocks hold nearly all of the file, so read them in one piece
+    Token_Buffer meshdata(meshfile);
+    spNodes->readNodes(meshdata);
+    spSides->readSides(meshdata);
+    spCells->readCells(meshdata);
+    spNodeData->readNodeData(meshdata);
+    spSideData->readSideData(meshdata);
+    spCellData->readCellData(meshdata);
+    readEndKeyword(meshdata);
   } catch (rtt_dsxx::assertion &as) {
     std::cout << "Assertion thrown: " << as.what() << std::endl;
     Insist(false, as.what());
@@ -120,14 +123,11 @@ void RTT_Format_Reader::readDataIDs(ifstream &meshfile) {
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Reads and validates the end_rtt_mesh keyword at the end of the mesh file.
- * \param meshfile Mesh file name.
+ * \param meshfile Mesh file buffer.
  */
-void RTT_Format_Reader::readEndKeyword(ifstream &meshfile) {
-  string dummyString;
-
-  meshfile >> dummyString;
-  Insist(dummyString == "end_rtt_mesh", "Invalid mesh file: RTT file missing end");
-  std::getline(meshfile, dummyString);
+void RTT_Format_Reader::readEndKeyword(Token_Buffer &meshfile) {
+  Insist(meshfile.next_word() == "end_rtt_mesh", "Invalid mesh file: RTT file missing end");
+  meshfile.skip_line();
 }
 
 //------------------------------------------------------------------------------------------------//
@@ -28,6 +28,10 @@ namespace rtt_RTT_Format_Reader {
  *     member function used to parse the mesh data.  Accessor functions are provided for all of the
  *     remaining member classes to allow data retrieval. The \ref overview_rtt_format_reader page
  *     presents a summary of the capabilities provided by the class.
+ *
+ * The node, side and cell blocks are also available as flat arrays (get_flat_nodes_coords(),
+ * get_flat_cells_nodes() with get_cells_nodes_offsets(), and so on), which return references to
+ * the reader's storage rather than building a vector per entity.
  */
 //================================================================================================//
 
@@ -559,6 +563,12 @@ public:
    */
   vector_vector_dbl get_nodes_coords() const { return spNodes->get_coords(); }
 
+  /*!
+   * \brief Returns the coordinate values of all of the nodes in one array, node-major.
+   * \return The get_dims_ndim() coordinate values of each of the nodes.
+   */
+  const vector_dbl &get_flat_nodes_coords() const { return spNodes->get_flat_coords(); }
+
   /*!
    * \brief Returns all of the coordinate values for the specified node.
    * \param node_numb Node number.
@@ -607,6 +617,20 @@ public:
    */
   vector_vector_uint get_sides_nodes() const { return spSides->get_nodes(); }
 
+  /*!
+   * \brief Returns the node numbers of all of the sides in one array, side-major.
+   * \return The node numbers of the sides; those of side i start at get_sides_nodes_offsets()[i].
+   */
+  const vector_uint &get_flat_sides_nodes() const { return spSides->get_flat_nodes(); }
+
+  /*!
+   * \brief Returns the offset of each side's node numbers in get_flat_sides_nodes().
+   * \return The get_dims_nsides() + 1 offsets.
+   */
+  const std::vector<size_t> &get_sides_nodes_offsets() const {
+    return spSides->get_node_offsets();
+  }
+
   /*!
    * \brief Returns the node numbers associated with the specified side.
    * \param side_numb Side number.
@@ -648,6 +672,20 @@ public:
    */
   vector_vector_uint get_cells_nodes() const { return spCells->get_nodes(); }
 
+  /*!
+   * \brief Returns the node numbers of all of the cells in one array, cell-major.
+   * \return The node numbers of the cells; those of cell i start at get_cells_nodes_offsets()[i].
+   */
+  const vector_uint &get_flat_cells_nodes() const { return spCells->get_flat_nodes(); }
+
+  /*!
+   * \brief Returns the offset of each cell's node numbers in get_flat_cells_nodes().
+   * \return The get_dims_ncells() + 1 offsets.
+   */
+  const std::vector<size_t> &get_cells_nodes_offsets() const {
+    return spCells->get_node_offsets();
+  }
+
   /*!
    * \brief Returns all of the node numbers associated with the specified cell.
    * \param cell_numb Cell number.
@@ -682,6 +720,12 @@ public:
    */
   vector_vector_dbl get_node_data() const { return spNodeData->get_data(); }
 
+  /*!
+   * \brief Returns the data field values of all of the nodes in one array, node-major.
+   * \return The get_dims_nnode_data() data field values of each of the nodes.
+   */
+  const vector_dbl &get_flat_node_data() const { return spNodeData->get_flat_data(); }
+
   /*!
    * \brief Returns all of the data field values for the specified node.
    * \param node_numb Node number.
@@ -706,6 +750,12 @@ public:
    */
   vector_vector_dbl get_side_data() const { return spSideData->get_data(); }
 
+  /*!
+   * \brief Returns the data field values of all of the sides in one array, side-major.
+   * \return The get_dims_nside_data() data field values of each of the sides.
+   */
+  const vector_dbl &get_flat_side_data() const { return spSideData->get_flat_data(); }
+
   /*!
    * \brief Returns all of the data field values for the specified side.
    * \param side_numb Side number.
@@ -730,6 +780,12 @@ public:
    */
   vector_vector_dbl get_cell_data() const { return spCellData->get_data(); }
 
+  /*!
+   * \brief Returns the data field values of all of the cells in one array, cell-major.
+   * \return The get_dims_ncell_data() data field values of each of the cells.
+   */
+  const vector_dbl &get_flat_cell_data() const { return spCellData->get_flat_data(); }
+
   /*!
    * \brief Returns all of the data field values for the specified cell.
    * \param cell_numb Cell number.
@@ -758,7 +814,7 @@ private:
   void createMembers();
   void readFlagBlocks(ifstream &meshfile);
   void readDataIDs(ifstream &meshfile);
-  void readEndKeyword(ifstream &meshfile);
+  void readEndKeyword(Token_Buffer &meshfile);
 };
 
 } // end namespace rtt_RTT_Format_Reader
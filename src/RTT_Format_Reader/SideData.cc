@@ -14,9 +14,9 @@ namespace rtt_RTT_Format_Reader {
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Parses the side_data block data from the mesh file via calls to private member functions.
- * \param meshfile Mesh file name.
+ * \param meshfile Mesh file buffer.
  */
-void SideData::readSideData(ifstream &meshfile) {
+void SideData::readSideData(Token_Buffer &meshfile) {
   readKeyword(meshfile);
   if (dims.get_nside_data() > 0)
     readData(meshfile);
@@ -26,45 +26,52 @@ void SideData::readSideData(ifstream &meshfile) {
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Reads and validates the side_data block keyword.
- * \param meshfile Mesh file name.
+ * \param meshfile Mesh file buffer.
  */
-void SideData::readKeyword(ifstream &meshfile) {
-  string dummyString;
-
-  meshfile >> dummyString;
-  Insist(dummyString == "sidedat", "Invalid mesh file: sidedat block missing");
-  std::getline(meshfile, dummyString);
+void SideData::readKeyword(Token_Buffer &meshfile) {
+  Insist(meshfile.next_word() == "sidedat", "Invalid mesh file: sidedat block missing");
+  meshfile.skip_line();
 }
 
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Reads and validates the side data block data.
- * \param meshfile Mesh file name.
+ * \param meshfile Mesh file buffer.
  */
-void SideData::readData(ifstream &meshfile) {
-  string dummyString;
-  size_t sideNum;
+void SideData::readData(Token_Buffer &meshfile) {
+  const size_t ndata = dims.get_nside_data();
 
   for (size_t i = 0; i < dims.get_nsides(); ++i) {
-    meshfile >> sideNum;
-    Insist(sideNum == i + 1, "Invalid mesh file: side data index out of order");
-    for (size_t j = 0; j < dims.get_nside_data(); ++j)
-      meshfile >> data[i][j];
-    std::getline(meshfile, dummyString);
+    const int sideNum = meshfile.next_int();
+    Insist(static_cast<size_t>(sideNum) == i + 1,
+           "Invalid mesh file: side data index out of order");
+    for (size_t j = 0; j < ndata; ++j)
+      data[i * ndata + j] = meshfile.next_double();
+    meshfile.skip_line();
   }
 }
 
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Reads and validates the end_sidedat block keyword.
- * \param meshfile Mesh file name.
+ * \param meshfile Mesh file buffer.
  */
-void SideData::readEndKeyword(ifstream &meshfile) {
-  string dummyString;
+void SideData::readEndKeyword(Token_Buffer &meshfile) {
+  Insist(meshfile.next_word() == "end_sidedat", "Invalid mesh file: sidedat block missing end");
+  meshfile.skip_line(); // read and discard blank line.
+}
 
-  meshfile >> dummyString;
-  Insist(dummyString == "end_sidedat", "Invalid mesh file: sidedat block missing end");
-  std::getline(meshfile, dummyString); // read and discard blank line.
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Returns all of the data field values for each of the sides.
+ * \return The data field values for each of the sides.
+ */
+SideData::vector_vector_dbl SideData::get_data() const {
+  vector_vector_dbl side_data;
+  side_data.reserve(dims.get_nsides());
+  for (size_t i = 0; i < dims.get_nsides(); ++i)
+    side_data.push_back(get_data(i));
+  return side_data;
 }
 
 } // end namespace rtt_RTT_Format_Reader
@@ -23,42 +23,47 @@ namespace rtt_RTT_Format_Reader {
 class SideData {
 
 private:
-  void readKeyword(std::ifstream &meshfile);
-  void readData(std::ifstream &meshfile);
-  void readEndKeyword(std::ifstream &meshfile);
+  void readKeyword(Token_Buffer &meshfile);
+  void readData(Token_Buffer &meshfile);
+  void readEndKeyword(Token_Buffer &meshfile);
 
   // typedefs
-  using ifstream = std::ifstream;
   using string = std::string;
   using vector_dbl = std::vector<double>;
   using vector_vector_dbl = std::vector<std::vector<double>>;
 
   const Dims &dims;
-  vector_vector_dbl data;
+  vector_dbl data;
 
 public:
   explicit SideData(const Dims &dims_)
-      : dims(dims_), data(dims.get_nsides(), vector_dbl(dims.get_nside_data())) {}
+      : dims(dims_), data(dims.get_nsides() * dims.get_nside_data()) {}
   ~SideData() = default;
   SideData(SideData const &rhs) = delete;
   SideData(SideData &&rhs) noexcept = delete;
   SideData &operator=(SideData const &rhs) = delete;
   SideData &operator=(SideData &&rhs) noexcept = delete;
 
-  void readSideData(ifstream &meshfile);
+  void readSideData(Token_Buffer &meshfile);
+
+  vector_vector_dbl get_data() const;
 
   /*!
-   * \brief Returns all of the data field values for each of the sides.
-   * \return The data field values for each of the sides.
+   * \brief Returns the data field values of all of the sides in one array, side-major.
+   * \return The get_nside_data() data field values of each of the sides.
    */
-  vector_vector_dbl get_data() const { return data; }
+  const vector_dbl &get_flat_data() const { return data; }
 
   /*!
    * \brief Returns all of the data field values for the specified side.
    * \param side_numb Side number.
    * \return The side data field values.
    */
-  vector_dbl get_data(size_t side_numb) const { return data[side_numb]; }
+  vector_dbl get_data(size_t side_numb) const {
+    const size_t ndata = dims.get_nside_data();
+    const auto first = data.begin() + static_cast<std::ptrdiff_t>(side_numb * ndata);
+    return vector_dbl(first, first + static_cast<std::ptrdiff_t>(ndata));
+  }
 
   /*!
    * \brief Returns the specified data field value for the specified side.
@@ -66,7 +71,9 @@ public:
    * \param data_index Data field.
    * \return The side data field value.
    */
-  double get_data(size_t side_numb, size_t data_index) const { return data[side_numb][data_index]; }
+  double get_data(size_t side_numb, size_t data_index) const {
+    return data[side_numb * dims.get_nside_data() + data_index];
+  }
 };
 
 } // end namespace rtt_RTT_Format_Reader
@@ -14,9 +14,9 @@ namespace rtt_RTT_Format_Reader {
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Parses the sides block data from the mesh file via calls to private member functions.
- * \param meshfile Mesh file name.
+ * \param meshfile Mesh file buffer.
  */
-void Sides::readSides(ifstream &meshfile) {
+void Sides::readSides(Token_Buffer &meshfile) {
   readKeyword(meshfile);
   readData(meshfile);
   readEndKeyword(meshfile);
@@ -25,61 +25,50 @@ void Sides::readSides(ifstream &meshfile) {
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Reads and validates the sides block keyword.
- * \param meshfile Mesh file name.
+ * \param meshfile Mesh file buffer.
  */
-void Sides::readKeyword(ifstream &meshfile) {
-  string dummyString;
-
-  meshfile >> dummyString;
-  Insist(dummyString == "sides", "Invalid mesh file: sides block missing");
-  std::getline(meshfile, dummyString);
+void Sides::readKeyword(Token_Buffer &meshfile) {
+  Insist(meshfile.next_word() == "sides", "Invalid mesh file: sides block missing");
+  meshfile.skip_line();
 }
 
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Reads and validates the sides block data.
- * \param meshfile Mesh file name.
+ * \param meshfile Mesh file buffer.
  */
-void Sides::readData(ifstream &meshfile) {
-  string dummyString;
-  int sideNum;
+void Sides::readData(Token_Buffer &meshfile) {
+  const auto nflag_types = static_cast<unsigned int>(dims.get_nside_flag_types());
 
   for (unsigned i = 0; i < static_cast<unsigned int>(dims.get_nsides()); ++i) {
-    sideNum = Nodes::readNextInt(meshfile);
-    // meshfile >> sideNum;
+    const int sideNum = meshfile.next_int_skip_comments();
     Insist(static_cast<unsigned int>(sideNum) == i + 1,
            "Invalid mesh file: side index out of order");
     Check(i < sideType.size());
-    meshfile >> sideType[i];
-    --sideType[i];
+    sideType[i] = meshfile.next_int() - 1;
     Insist(dims.allowed_side_type(sideType[i]), "Invalid mesh file: illegal side type");
-    Check(i < nodes.size());
-    nodes[i].resize(cellDefs.get_nnodes(sideType[i]));
-    for (unsigned j = 0; j < cellDefs.get_nnodes(sideType[i]); ++j) {
-      Check(j < nodes[i].size());
-      meshfile >> nodes[i][j];
-      --nodes[i][j];
-    }
-    for (unsigned j = 0; j < static_cast<unsigned int>(dims.get_nside_flag_types()); ++j) {
-      Check(j < flags[i].size());
-      meshfile >> flags[i][j];
-      Insist(sideFlags.allowed_flag(j, flags[i][j]), "Invalid mesh file: illegal side flag");
+    const size_t nnodes = cellDefs.get_nnodes(sideType[i]);
+    for (size_t j = 0; j < nnodes; ++j)
+      nodes.push_back(static_cast<unsigned>(meshfile.next_int()) - 1);
+    nodeOffset[i + 1] = nodes.size();
+
+    for (unsigned j = 0; j < nflag_types; ++j) {
+      const int flag = meshfile.next_int();
+      Insist(sideFlags.allowed_flag(j, flag), "Invalid mesh file: illegal side flag");
+      flags[i * nflag_types + j] = flag;
     }
-    std::getline(meshfile, dummyString);
+    meshfile.skip_line();
   }
 }
 
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Reads and validates the end_sides block keyword.
- * \param meshfile Mesh file name.
+ * \param meshfile Mesh file buffer.
  */
-void Sides::readEndKeyword(ifstream &meshfile) {
-  string dummyString;
-
-  meshfile >> dummyString;
-  Insist(dummyString == "end_sides", "Invalid mesh file: sides block missing end");
-  std::getline(meshfile, dummyString); // read and discard blank line.
+void Sides::readEndKeyword(Token_Buffer &meshfile) {
+  Insist(meshfile.next_word() == "end_sides", "Invalid mesh file: sides block missing end");
+  meshfile.skip_line(); // read and discard blank line.
 }
 
 //------------------------------------------------------------------------------------------------//
@@ -103,9 +92,10 @@ void Sides::redefineSides() {
       temp_nodes.resize(cellDefs.get_nnodes(this_side_type));
       for (size_t s = 0; s < dims.get_nsides(); s++) {
         if (sideType[s] == this_side_type) {
-          for (size_t n = 0; n < nodes[s].size(); n++)
-            temp_nodes[node_map[n]] = nodes[s][n];
-          nodes[s] = temp_nodes;
+          const auto first = nodes.begin() + static_cast<std::ptrdiff_t>(nodeOffset[s]);
+          for (size_t n = 0; n < temp_nodes.size(); n++)
+            temp_nodes[node_map[n]] = first[static_cast<std::ptrdiff_t>(n)];
+          std::copy(temp_nodes.begin(), temp_nodes.end(), first);
         }
       }
     }
@@ -113,6 +103,19 @@ void Sides::redefineSides() {
   }
 }
 
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Returns the node numbers associated with each side.
+ * \return The node numbers for all of the sides.
+ */
+Sides::vector_vector_uint Sides::get_nodes() const {
+  vector_vector_uint side_nodes;
+  side_nodes.reserve(dims.get_nsides());
+  for (size_t s = 0; s < dims.get_nsides(); ++s)
+    side_nodes.push_back(get_nodes(s));
+  return side_nodes;
+}
+
 } // end namespace rtt_RTT_Format_Reader
 
 //------------------------------------------------------------------------------------------------//
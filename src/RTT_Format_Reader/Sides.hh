@@ -26,12 +26,11 @@ namespace rtt_RTT_Format_Reader {
 class Sides {
 
 private:
-  void readKeyword(std::ifstream &meshfile);
-  void readData(std::ifstream &meshfile);
-  void readEndKeyword(std::ifstream &meshfile);
+  void readKeyword(Token_Buffer &meshfile);
+  void readData(Token_Buffer &meshfile);
+  void readEndKeyword(Token_Buffer &meshfile);
 
   // typedefs
-  using ifstream = std::ifstream;
   using string = std::string;
   using vector_int = std::vector<int>;
   using vector_vector_int = std::vector<std::vector<int>>;
@@ -42,14 +41,15 @@ private:
   const Dims &dims;
   const CellDefs &cellDefs;
   vector_int sideType;
-  vector_vector_uint nodes;
-  vector_vector_int flags;
+  std::vector<size_t> nodeOffset;
+  vector_uint nodes;
+  vector_int flags;
 
 public:
   Sides(const SideFlags &sideFlags_, const Dims &dims_, const CellDefs &cellDefs_)
       : sideFlags(sideFlags_), dims(dims_), cellDefs(cellDefs_), sideType(dims.get_nsides()),
-        nodes(dims.get_nsides()),
-        flags(dims.get_nsides(), vector_int(dims.get_nside_flag_types())) { /* empty */
+        nodeOffset(dims.get_nsides() + 1, 0), nodes(),
+        flags(dims.get_nsides() * dims.get_nside_flag_types()) { /* empty */
   }
   ~Sides() = default;
   Sides(Sides const &rhs) = delete;
@@ -57,7 +57,7 @@ public:
   Sides &operator=(Sides const &rhs) = delete;
   Sides &operator=(Sides &&rhs) noexcept = delete;
 
-  void readSides(ifstream &meshfile);
+  void readSides(Token_Buffer &meshfile);
   void redefineSides();
 
   /*!
@@ -66,31 +66,46 @@ public:
    * \return The side type.
    */
   int get_type(size_t side_numb) const { return sideType[side_numb]; }
+  vector_vector_uint get_nodes() const;
+
+  /*!
+   * \brief Returns the node numbers of all of the sides in one array, side-major.
+   * \return The node numbers for all sides; those of side i start at get_node_offsets()[i].
+   */
+  const vector_uint &get_flat_nodes() const { return nodes; }
+
   /*!
-   * \brief Returns the node numbers associated with each side.
-   * \return The node numbers for all of the sides.
+   * \brief Returns the offset of each side's node numbers in get_flat_nodes(), and their total.
+   * \return The get_nsides() + 1 offsets.
    */
-  vector_vector_uint get_nodes() const { return nodes; }
+  const std::vector<size_t> &get_node_offsets() const { return nodeOffset; }
   /*!
    * \brief Returns the node numbers associated with the specified side.
    * \param side_numb Side number.
    * \return The side node numbers.
    */
-  vector_uint get_nodes(size_t side_numb) const { return nodes[side_numb]; }
+  vector_uint get_nodes(size_t side_numb) const {
+    return vector_uint(nodes.begin() + static_cast<std::ptrdiff_t>(nodeOffset[side_numb]),
+                       nodes.begin() + static_cast<std::ptrdiff_t>(nodeOffset[side_numb + 1]));
+  }
   /*!
    * \brief Returns the node number associated with the specified side and side-node index.
    * \param side_numb Side number.
    * \param node_numb Side-node index number.
    * \return The side node number.
    */
-  int get_nodes(size_t side_numb, size_t node_numb) const { return nodes[side_numb][node_numb]; }
+  int get_nodes(size_t side_numb, size_t node_numb) const {
+    return static_cast<int>(nodes[nodeOffset[side_numb] + node_numb]);
+  }
   /*!
    * \brief Returns the side flag for the specified side and flag index
    * \param side_numb Side number.
    * \param flag_numb Side flag index.
    * \return The side flag.
    */
-  int get_flags(size_t side_numb, size_t flag_numb) const { return flags[side_numb][flag_numb]; }
+  int get_flags(size_t side_numb, size_t flag_numb) const {
+    return flags[side_numb * dims.get_nside_flag_types() + flag_numb];
+  }
 };
 
 } // end namespace rtt_RTT_Format_Reader
@@ -0,0 +1,86 @@
+//--------------------------------------------*-C++-*---------------------------------------------//
+/*!
+ * \file   RTT_Format_Reader/Token_Buffer.cc
+ * \author agent
+ * \date   Friday, Oct 16, 2026, 4:10 pm
+ * \brief  Implementation file for RTT_Format_Reader/Token_Buffer class.
+ * \note   Copyright (C) 2026 Triad National Security, LLC., All rights reserved. */
+//------------------------------------------------------------------------------------------------//
+
+#include "Token_Buffer.hh"
+#include <cstring>
+#include <iterator>
+
+namespace rtt_RTT_Format_Reader {
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Reads the remainder of a mesh file into memory.
+ *
+ * Seekable streams are read with a single read of their remaining size; others are copied
+ * character by character.
+ *
+ * \param meshfile Mesh file stream, positioned at the first character to be tokenized.
+ */
+Token_Buffer::Token_Buffer(std::istream &meshfile) : text(), cursor(nullptr) {
+  const std::istream::pos_type start = meshfile.tellg();
+  if (start != std::istream::pos_type(-1)) {
+    meshfile.seekg(0, std::ios::end);
+    const std::istream::pos_type end = meshfile.tellg();
+    meshfile.seekg(start);
+    if (end != std::istream::pos_type(-1) && end >= start) {
+      // in text mode the size may overestimate the characters read, so trust gcount
+      text.resize(static_cast<size_t>(end - start) + 1);
+      meshfile.read(text.data(), end - start);
+      text.resize(static_cast<size_t>(meshfile.gcount()) + 1);
+    }
+  }
+  if (text.empty()) {
+    meshfile.clear();
+    text.assign(std::istreambuf_iterator<char>(meshfile), std::istreambuf_iterator<char>());
+    text.push_back('\0');
+  }
+  text.back() = '\0';
+  cursor = text.data();
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Reads the next whitespace-delimited word, as operator>> into a string would.
+ * \return The word, or an empty string at the end of the buffer.
+ */
+std::string Token_Buffer::next_word() {
+  skip_space();
+  const char *end = word_end();
+  string word(cursor, end);
+  cursor = end;
+  return word;
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Reads the next integer, skipping comments.
+ *
+ * A word containing '!' starts a comment, and it and the rest of its line are discarded.  The
+ * integer is the leading digits of the first other word (as atoi), and the whole word is consumed.
+ *
+ * \return The integer value.
+ */
+int Token_Buffer::next_int_skip_comments() {
+  while (true) {
+    skip_space();
+    const char *end = word_end();
+    if (std::memchr(cursor, '!', static_cast<size_t>(end - cursor)) == nullptr) {
+      const auto value = static_cast<int>(std::strtol(cursor, nullptr, 10));
+      cursor = end;
+      return value;
+    }
+    skip_line();
+  }
+}
+
+} // end namespace rtt_RTT_Format_Reader
+
+//------------------------------------------------------------------------------------------------//
+// end of RTT_Format_Reader/Token_Buffer.cc
+//------------------------------------------------------------------------------------------------//
@@ -0,0 +1,114 @@
+//--------------------------------------------*-C++-*---------------------------------------------//
+/*!
+ * \file   RTT_Format_Reader/Token_Buffer.hh
+ * \author agent
+ * \date   Friday, Oct 16, 2026, 4:10 pm
+ * \brief  Header file for RTT_Format_Reader/Token_Buffer class.
+ * \note   Copyright (C) 2026 Triad National Security, LLC., All rights reserved. */
+//------------------------------------------------------------------------------------------------//
+
+#ifndef rtt_RTT_Format_Reader_Token_Buffer_hh
+#define rtt_RTT_Format_Reader_Token_Buffer_hh
+
+#include "ds++/Assert.hh"
+#include <climits>
+#include <cstdlib>
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace rtt_RTT_Format_Reader {
+
+//================================================================================================//
+/*!
+ * \class Token_Buffer
+ * \brief Holds the remainder of a mesh file in memory and tokenizes it in place.
+ *
+ * The nodes, sides, cells and data blocks make up nearly all of a large mesh file.  Rather than
+ * extracting each value from an ifstream (a sentry, locale lookup and virtual buffer calls per
+ * value) these blocks are read with one bulk read into a single buffer and parsed with strtol and
+ * strtod directly from it.  The functions mirror the ifstream operations they replace: next_int()
+ * and next_double() skip leading whitespace and stop at the first character that cannot continue
+ * the number, as operator>> does, and skip_line() discards the rest of the line, as std::getline.
+ */
+//================================================================================================//
+class Token_Buffer {
+
+  // typedefs
+  using string = std::string;
+
+  //! File text from the stream position at construction, terminated by a null character.
+  std::vector<char> text;
+  //! Position of the next unread character.
+  const char *cursor;
+
+public:
+  explicit Token_Buffer(std::istream &meshfile);
+  ~Token_Buffer() = default;
+  Token_Buffer(Token_Buffer const &rhs) = delete;
+  Token_Buffer(Token_Buffer &&rhs) noexcept = delete;
+  Token_Buffer &operator=(Token_Buffer const &rhs) = delete;
+  Token_Buffer &operator=(Token_Buffer &&rhs) noexcept = delete;
+
+  string next_word();
+  int next_int_skip_comments();
+
+  /*!
+   * \brief Reads the next integer, as operator>> would.
+   * \return The integer value.
+   */
+  int next_int() {
+    char *end = nullptr;
+    const long value = std::strtol(cursor, &end, 10);
+    Insist(end != cursor, "Invalid mesh file: integer value expected");
+    Insist(value >= INT_MIN && value <= INT_MAX, "Invalid mesh file: integer value out of range");
+    cursor = end;
+    return static_cast<int>(value);
+  }
+
+  /*!
+   * \brief Reads the next floating point value, as operator>> would.
+   * \return The floating point value.
+   */
+  double next_double() {
+    char *end = nullptr;
+    const double value = std::strtod(cursor, &end);
+    Insist(end != cursor, "Invalid mesh file: floating point value expected");
+    cursor = end;
+    return value;
+  }
+
+  /*!
+   * \brief Discards the remainder of the current line, including the end of line.
+   */
+  void skip_line() {
+    while (*cursor != '\0' && *cursor != '\n')
+      ++cursor;
+    if (*cursor == '\n')
+      ++cursor;
+  }
+
+private:
+  //! Whitespace as classified by std::isspace in the "C" locale.
+  static bool is_space(char c) { return c == ' ' || (c >= '\t' && c <= '\r'); }
+
+  void skip_space() {
+    while (is_space(*cursor))
+      ++cursor;
+  }
+
+  const char *word_end() const {
+    const char *end = cursor;
+    while (*end != '\0' && !is_space(*end))
+      ++end;
+    return end;
+  }
+};
+
+} // end namespace rtt_RTT_Format_Reader
+
+#endif // rtt_RTT_Format_Reader_Token_Buffer_hh
+
+//------------------------------------------------------------------------------------------------//
+// end of RTT_Format_Reader/Token_Buffer.hh
+//------------------------------------------------------------------------------------------------//
@@ -1234,6 +1234,14 @@ bool check_nodes(RTT_Format_Reader const &mesh, Meshes const &meshtype, UnitTest
     FAILMSG("Node coordinate not obtained.");
     all_passed = false;
   }
+  // Check the flat, node-major coordinate array.
+  std::vector<double> flat_coords;
+  for (size_t i = 0; i < mesh.get_dims_nnodes(); i++)
+    flat_coords.insert(flat_coords.end(), coords[i].begin(), coords[i].end());
+  if (flat_coords != mesh.get_flat_nodes_coords()) {
+    FAILMSG("Flat nodes coordinates not obtained.");
+    all_passed = false;
+  }
   // Check the node parents.
   bool got_nodes_parents = true;
   for (size_t i = 0; i < mesh.get_dims_nnodes(); i++) {
@@ -1346,6 +1354,18 @@ bool check_sides(RTT_Format_Reader const &mesh, Meshes const &meshtype, UnitTest
     FAILMSG("Side node not obtained.");
     all_passed = false;
   }
+  // Check the flat side nodes against their offsets.
+  std::vector<unsigned> flat_side_nodes;
+  std::vector<size_t> side_offsets(1, 0);
+  for (size_t i = 0; i < mesh.get_dims_nsides(); i++) {
+    flat_side_nodes.insert(flat_side_nodes.end(), nodes[i].begin(), nodes[i].end());
+    side_offsets.push_back(flat_side_nodes.size());
+  }
+  if (flat_side_nodes != mesh.get_flat_sides_nodes() ||
+      side_offsets != mesh.get_sides_nodes_offsets()) {
+    FAILMSG("Flat Sides nodes not obtained.");
+    all_passed = false;
+  }
   // Check the side flags.
   bool got_sides_flags = true;
   for (size_t i = 0; i < mesh.get_dims_nsides(); i++) {
@@ -1435,6 +1455,18 @@ bool check_cells(RTT_Format_Reader const &mesh, Meshes const &meshtype, UnitTest
     FAILMSG("Cell node not obtained.");
     all_passed = false;
   }
+  // Check the flat cell nodes against their offsets.
+  std::vector<unsigned> flat_cell_nodes;
+  std::vector<size_t> cell_offsets(1, 0);
+  for (size_t i = 0; i < mesh.get_dims_ncells(); i++) {
+    flat_cell_nodes.insert(flat_cell_nodes.end(), nodes[i].begin(), nodes[i].end());
+    cell_offsets.push_back(flat_cell_nodes.size());
+  }
+  if (flat_cell_nodes != mesh.get_flat_cells_nodes() ||
+      cell_offsets != mesh.get_cells_nodes_offsets()) {
+    FAILMSG("Flat Cells nodes not obtained.");
+    all_passed = false;
+  }
   // Check the cell flags.
   bool got_cells_flags = true;
   for (size_t i = 0; i < mesh.get_dims_ncells(); i++) {
@@ -1509,6 +1541,14 @@ bool check_node_data(RTT_Format_Reader const &mesh, Meshes const &meshtype, Unit
     FAILMSG("NodeData value not obtained.");
     all_passed = false;
   }
+  // Check the flat, node-major data array.
+  std::vector<double> flat_data;
+  for (size_t i = 0; i < mesh.get_dims_nnodes(); i++)
+    flat_data.insert(flat_data.end(), data[i].begin(), data[i].end());
+  if (flat_data != mesh.get_flat_node_data()) {
+    FAILMSG("Flat NodeData values not obtained.");
+    all_passed = false;
+  }
 
   if (all_passed) {
     PASSMSG("Got all NodeData accessors.");
@@ -0,0 +1,96 @@
+//--------------------------------------------*-C++-*---------------------------------------------//
+/*!
+ * \file   c4/Node_Shared_Table.cc
+ * \author agent
+ * \date   Fri Oct 16 2026
+ * \brief  Node_Shared_Segment member definitions.
+ * \note   Copyright (C) 2026 Triad National Security, LLC., All rights reserved. */
+//------------------------------------------------------------------------------------------------//
+
+#include "Node_Shared_Table.hh"
+#include "ds++/Assert.hh"
+
+namespace rtt_c4 {
+
+#ifdef C4_HAVE_NODE_SHARED_MEMORY
+
+//------------------------------------------------------------------------------------------------//
+bool node_shared_storage_available() {
+  // Scalar unit tests and serial tools may use an MPI build of c4 without initializing MPI.
+  int mpi_initialized(0);
+  int mpi_finalized(0);
+  MPI_Initialized(&mpi_initialized);
+  MPI_Finalized(&mpi_finalized);
+  return mpi_initialized && !mpi_finalized;
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \param[in] size Number of bytes in the segment.
+ *
+ * The ranks of rtt_c4::communicator are split by shared-memory domain; the lowest rank on each
+ * node allocates the whole segment and the others allocate nothing and map the writer's memory.
+ */
+Node_Shared_Segment::Node_Shared_Segment(size_t size) {
+  Remember(int result =) MPI_Comm_split_type(communicator, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL,
+                                             &node_comm);
+  Check(result == MPI_SUCCESS);
+  int node_rank(-1);
+  MPI_Comm_rank(node_comm, &node_rank);
+  writer = node_rank == 0;
+
+  // Allocating at least one byte keeps the base address valid for empty tables.
+  MPI_Aint const local_size = writer ? static_cast<MPI_Aint>(size > 0 ? size : 1) : 0;
+  void *local_base = nullptr;
+  Remember(result =) MPI_Win_allocate_shared(local_size, 1, MPI_INFO_NULL, node_comm, &local_base,
+                                             &window);
+  Check(result == MPI_SUCCESS);
+
+  MPI_Aint writer_size(0);
+  int disp_unit(0);
+  Remember(result =) MPI_Win_shared_query(window, 0, &writer_size, &disp_unit, &base);
+  Check(result == MPI_SUCCESS);
+  Ensure(writer_size >= static_cast<MPI_Aint>(size));
+  Ensure(base != nullptr);
+}
+
+//------------------------------------------------------------------------------------------------//
+Node_Shared_Segment::~Node_Shared_Segment() {
+  int mpi_finalized(0);
+  MPI_Finalized(&mpi_finalized);
+  if (mpi_finalized)
+    return;
+  MPI_Win_free(&window);
+  MPI_Comm_free(&node_comm);
+}
+
+//------------------------------------------------------------------------------------------------//
+void Node_Shared_Segment::fence() const {
+  // Close the epoch in which the writer stored the entries; this synchronizes all ranks on the node
+  // and orders the writer's stores before any later loads.
+  Remember(int result =) MPI_Win_fence(0, window);
+  Check(result == MPI_SUCCESS);
+}
+
+#else
+
+//------------------------------------------------------------------------------------------------//
+// Without MPI-3 every table is held on the heap and no segment is ever created.
+//------------------------------------------------------------------------------------------------//
+bool node_shared_storage_available() { return false; }
+
+Node_Shared_Segment::Node_Shared_Segment(size_t /*size*/) {
+  Insist(false, "Node-shared storage requires MPI-3 or later.");
+}
+
+Node_Shared_Segment::~Node_Shared_Segment() = default;
+
+void Node_Shared_Segment::fence() const {}
+
+#endif // C4_HAVE_NODE_SHARED_MEMORY
+
+} // end namespace rtt_c4
+
+//------------------------------------------------------------------------------------------------//
+// end of c4/Node_Shared_Table.cc
+//------------------------------------------------------------------------------------------------//
@@ -0,0 +1,159 @@
+//--------------------------------------------*-C++-*---------------------------------------------//
+/*!
+ * \file   c4/Node_Shared_Table.hh
+ * \author agent
+ * \date   Fri Oct 16 2026
+ * \brief  Read-only tables stored once per shared-memory node.
+ * \note   Copyright (C) 2026 Triad National Security, LLC., All rights reserved. */
+//------------------------------------------------------------------------------------------------//
+
+#ifndef rtt_c4_Node_Shared_Table_hh
+#define rtt_c4_Node_Shared_Table_hh
+
+#include "C4_Functions.hh"
+#include "ds++/Assert.hh"
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#if defined(C4_MPI) && MPI_VERSION >= 3
+#define C4_HAVE_NODE_SHARED_MEMORY
+#endif
+
+namespace rtt_c4 {
+
+//! Where the entries of a Node_Shared_Table live.
+enum class Table_Storage {
+  heap,       //!< A private copy of the table in each rank's heap (default)
+  node_shared //!< One copy per shared-memory node in an MPI-3 shared window (heap fallback)
+};
+
+//! True if Table_Storage::node_shared is honored (MPI-3 or later, and MPI is running).
+bool node_shared_storage_available();
+
+//================================================================================================//
+/*!
+ * \class Node_Shared_Segment
+ * \brief An MPI_Win_allocate_shared segment owned by the lowest rank of each shared-memory node.
+ *
+ * Construction and destruction are collective over rtt_c4::communicator.  Only the writer (rank 0
+ * of the node communicator) allocates memory; the other ranks on the node query the writer's base
+ * address.  Use Node_Shared_Table rather than this class directly.
+ */
+//================================================================================================//
+class Node_Shared_Segment {
+public:
+  //! Allocate (collective) a segment of size bytes on each shared-memory node.
+  explicit Node_Shared_Segment(size_t size);
+
+  //! Free (collective) the window; skipped if MPI has already been finalized.
+  ~Node_Shared_Segment();
+
+  Node_Shared_Segment(Node_Shared_Segment const &rhs) = delete;
+  Node_Shared_Segment &operator=(Node_Shared_Segment const &rhs) = delete;
+
+  //! Base address of the node's segment, valid on every rank of the node.
+  void *data() const { return base; }
+
+  //! True on the rank that fills the segment.
+  bool is_writer() const { return writer; }
+
+  //! Make the writer's stores visible to the other ranks on the node (collective).
+  void fence() const;
+
+private:
+#ifdef C4_HAVE_NODE_SHARED_MEMORY
+  MPI_Comm node_comm = MPI_COMM_NULL;
+  MPI_Win window = MPI_WIN_NULL;
+#endif
+  void *base = nullptr;
+  bool writer = true;
+};
+
+//================================================================================================//
+/*!
+ * \class Node_Shared_Table
+ * \brief A fixed-size, read-only array that may be stored once per shared-memory node.
+ *
+ * Large immutable data (opacity, stopping power or scattering tables) is usually identical on every
+ * rank.  With Table_Storage::node_shared the entries are allocated once per node with
+ * MPI_Win_allocate_shared and filled by one rank; the other ranks on the node read the same memory.
+ * With Table_Storage::heap, in scalar builds, when the MPI library predates MPI-3, or when MPI is
+ * not initialized, every rank holds a private std::vector and fills it itself.  Client code is
+ * identical in both cases:
+ *
+ * \code
+ *   Node_Shared_Table<double> table(n, storage); // collective if storage is node_shared
+ *   table.fill([&](double *entries) { ... write n entries ... });
+ *   double x = table[i];
+ * \endcode
+ *
+ * Copies share the storage.  When node_shared, the constructor, fill() and the destruction of the
+ * last copy are collective over rtt_c4::communicator, so every rank must create, fill and release
+ * its tables in the same order, and before rtt_c4::finalize().
+ */
+//================================================================================================//
+template <typename T> class Node_Shared_Table {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "Node_Shared_Table entries are shared as raw memory");
+
+public:
+  //! An empty table.
+  Node_Shared_Table() = default;
+
+  //! Allocate size entries (collective when storage is node_shared and it is available).
+  Node_Shared_Table(size_t size, Table_Storage storage)
+      : num_entries(size) {
+    if (storage == Table_Storage::node_shared && node_shared_storage_available()) {
+      segment = std::make_shared<Node_Shared_Segment>(size * sizeof(T));
+      entries = static_cast<T *>(segment->data());
+    } else {
+      heap = std::make_shared<std::vector<T>>(size);
+      entries = heap->data();
+    }
+  }
+
+  /*!
+   * \brief Fill the table (collective when node shared).
+   * \param[in] writer Callable invoked as writer(T *entries) on the rank that owns the storage; it
+   *               must set all size() entries.  Other ranks only wait for the writes to be visible.
+   */
+  template <typename Writer> void fill(Writer &&writer) {
+    if (is_writer())
+      writer(entries);
+    if (segment)
+      segment->fence();
+  }
+
+  // ACCESSORS
+
+  T const *data() const { return entries; }
+  size_t size() const { return num_entries; }
+  bool empty() const { return num_entries == 0; }
+  T const &operator[](size_t i) const {
+    Require(i < num_entries);
+    return entries[i];
+  }
+  T const *begin() const { return entries; }
+  T const *end() const { return entries + num_entries; }
+
+  //! True if this rank writes the entries in fill().
+  bool is_writer() const { return !segment || segment->is_writer(); }
+
+  //! True if the entries live in a node-shared segment rather than this rank's heap.
+  bool is_node_shared() const { return static_cast<bool>(segment); }
+
+private:
+  std::shared_ptr<std::vector<T>> heap;
+  std::shared_ptr<Node_Shared_Segment> segment;
+  T *entries = nullptr;
+  size_t num_entries = 0;
+};
+
+} // end namespace rtt_c4
+
+#endif // rtt_c4_Node_Shared_Table_hh
+
+//------------------------------------------------------------------------------------------------//
+// end of c4/Node_Shared_Table.hh
+//------------------------------------------------------------------------------------------------//
@@ -0,0 +1,97 @@
+//--------------------------------------------*-C++-*---------------------------------------------//
+/*!
+ * \file   c4/test/tstNode_Shared_Table.cc
+ * \author agent
+ * \date   Fri Oct 16 2026
+ * \brief  Tests Node_Shared_Table with both storage policies.
+ * \note   Copyright (C) 2026 Triad National Security, LLC., All rights reserved. */
+//------------------------------------------------------------------------------------------------//
+
+#include "c4/Node_Shared_Table.hh"
+#include "c4/ParallelUnitTest.hh"
+#include "ds++/Release.hh"
+#include <numeric>
+
+using namespace std;
+using rtt_c4::Node_Shared_Table;
+using rtt_c4::Table_Storage;
+
+//------------------------------------------------------------------------------------------------//
+// TESTS
+//------------------------------------------------------------------------------------------------//
+void check_table(rtt_c4::ParallelUnitTest &ut, Table_Storage const storage) {
+  size_t const n = 1000;
+  Node_Shared_Table<double> table(n, storage);
+  FAIL_IF_NOT(table.size() == n);
+  FAIL_IF(table.empty());
+
+  bool const shared = storage == Table_Storage::node_shared &&
+                      rtt_c4::node_shared_storage_available();
+  FAIL_IF_NOT(table.is_node_shared() == shared);
+  if (!shared)
+    FAIL_IF_NOT(table.is_writer());
+
+  // Exactly one rank per node writes a shared table, every rank writes a heap table.
+  int writes(0);
+  table.fill([&writes](double *entries) {
+    ++writes;
+    for (size_t i = 0; i < n; ++i)
+      entries[i] = 0.5 * static_cast<double>(i);
+  });
+  FAIL_IF_NOT(writes == (table.is_writer() ? 1 : 0));
+
+  // Every rank sees the writer's values.
+  bool ok(true);
+  for (size_t i = 0; i < n; ++i)
+    ok = ok && table[i] >= 0.5 * static_cast<double>(i) && table[i] <= 0.5 * static_cast<double>(i);
+  FAIL_IF_NOT(ok);
+  FAIL_IF_NOT(std::accumulate(table.begin(), table.end(), 0.0) >= 0.25 * n * (n - 1));
+
+  // Copies alias the same entries.
+  Node_Shared_Table<double> const copy(table);
+  FAIL_IF_NOT(copy.data() == table.data());
+
+  // Count the writers across the job: one per node, or one per rank on the heap.
+  int num_writers = table.is_writer() ? 1 : 0;
+  rtt_c4::global_sum(num_writers);
+  FAIL_IF_NOT(num_writers >= 1 && num_writers <= rtt_c4::nodes());
+  if (!shared)
+    FAIL_IF_NOT(num_writers == rtt_c4::nodes());
+
+  if (ut.numFails == 0) {
+    ostringstream msg;
+    msg << (shared ? "node_shared" : "heap") << " table filled by " << num_writers
+        << " writer(s) for " << rtt_c4::nodes() << " rank(s).";
+    PASSMSG(msg.str());
+  }
+}
+
+//------------------------------------------------------------------------------------------------//
+void check_empty(rtt_c4::ParallelUnitTest &ut) {
+  Node_Shared_Table<int> const none;
+  FAIL_IF_NOT(none.empty());
+  FAIL_IF_NOT(none.begin() == none.end());
+
+  Node_Shared_Table<int> zero(0, Table_Storage::node_shared);
+  zero.fill([](int * /*entries*/) {});
+  FAIL_IF_NOT(zero.empty());
+  FAIL_IF_NOT(zero.begin() == zero.end());
+
+  if (ut.numFails == 0)
+    PASSMSG("empty tables are handled.");
+}
+
+//------------------------------------------------------------------------------------------------//
+int main(int argc, char *argv[]) {
+  rtt_c4::ParallelUnitTest ut(argc, argv, rtt_dsxx::release);
+  try {
+    check_table(ut, Table_Storage::heap);
+    check_table(ut, Table_Storage::node_shared);
+    check_empty(ut);
+  }
+  UT_EPILOG(ut);
+}
+
+//------------------------------------------------------------------------------------------------//
+// end of tstNode_Shared_Table.cc
+//------------------------------------------------------------------------------------------------//
@@ -8,6 +8,7 @@
 //------------------------------------------------------------------------------------------------//
 
 #include "CDI.hh"
+#include "Planck_Rosseland_Table.hh"
 #include "ds++/Safe_Divide.hh"
 #include "ds++/Soft_Equivalence.hh"
 #include <iostream>
@@ -49,6 +50,7 @@ CDI::CDI(std_string id)
 
 std::vector<double> CDI::frequencyGroupBoundaries = std::vector<double>();
 DLL_PUBLIC_cdi bool CDI::extend = false;
+std::shared_ptr<const Planck_Rosseland_Table> CDI::planckRosselandTable;
 
 //------------------------------------------------------------------------------------------------//
 // STATIC FUNCTIONS
@@ -197,6 +199,51 @@ void CDI::integrate_Rosseland_Planckian_Spectrum(const size_t groupIndex, const
   return;
 }
 
+namespace {
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Cumulative normalized Planckian (and Rosseland) integrals from zero to every boundary.
+ *
+ * Boundaries at or above 50 T are assigned exactly one, as described in the integrators below;
+ * the others are evaluated in a single pass of the array integrators of CDI.hh.
+ *
+ * \param bounds    The vector of group boundaries. Size n+1
+ * \param T         The temperature (must be greater than 0.0)
+ * \param planck    Return argument containing the cumulative Planckian integrals. Size n+1
+ * \param rosseland If not null, return argument for the cumulative Rosseland integrals. Size n+1
+ */
+void cumulative_Rosseland_Planckian_Spectrum(std::vector<double> const &bounds, double const T,
+                                             std::vector<double> &planck,
+                                             std::vector<double> *const rosseland) {
+  Require(T > 0.0);
+
+  size_t const n(bounds.size());
+  double const cutoff = 50 * T;
+
+  // Scale the frequencies, in place in planck.
+  planck.resize(n);
+  for (size_t b = 0; b < n; ++b)
+    planck[b] = bounds[b] < cutoff ? bounds[b] / T : 50.0;
+
+  if (rosseland) {
+    rosseland->resize(n);
+    integrate_planck_rosseland(n, planck.data(), planck.data(), rosseland->data());
+  } else {
+    integrate_planck(n, planck.data(), planck.data());
+  }
+
+  for (size_t b = 0; b < n; ++b) {
+    if (!(bounds[b] < cutoff)) {
+      planck[b] = 1.0;
+      if (rosseland)
+        (*rosseland)[b] = 1.0;
+    }
+  }
+}
+
+} // namespace
+
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Integrate the Planckian Specrum over an entire a set of frequency groups, returning a
@@ -223,28 +270,21 @@ void CDI::integrate_Planckian_Spectrum(std::vector<double> const &bounds, double
   // the integral is 1 to roundoff. We choose 50 to give just a little extra slack in case
   // some optimizing compiler does something weird and wonderful.
   if (T > 0.0) {
-    // Initialize the loop:
-    double frequency = bounds[0];
-    double planck_value =
-        extend ? 0.0 : ((frequency < T * 50) ? integrate_planck(frequency / T) : 1.0);
+    std::vector<double> cumulative;
+    cumulative_Rosseland_Planckian_Spectrum(bounds, T, cumulative, nullptr);
 
+    double last_planck = extend ? 0.0 : cumulative[0];
     for (size_t group = 0; group < groups; ++group) {
-      // Shift the data down:
-      Remember(double const last_frequency = frequency;);
-      double const last_planck = planck_value;
-
-      // New values:
-      frequency = bounds[group + 1];
-      Require(frequency > last_frequency);
-      planck_value = (frequency < T * 50) ? integrate_planck(frequency / T) : 1.0;
+      Require(bounds[group + 1] > bounds[group]);
 
       // Record the definite integral between frequencies.
-      planck[group] = planck_value - last_planck;
+      planck[group] = cumulative[group + 1] - last_planck;
+      last_planck = cumulative[group + 1];
       Ensure(planck[group] >= 0.0);
       Ensure(planck[group] <= 1.0);
     }
     if (extend) {
-      planck[groups - 1] += 1 - planck_value;
+      planck[groups - 1] += 1 - last_planck;
     }
   } else {
     // For the somewhat ill-posed case of T == 0 and bounds[0] == 0, we have chosen
@@ -285,28 +325,21 @@ std::vector<double> CDI::integrate_Planckian_Spectrum(std::vector<double> const
   // the integral is 1 to roundoff. We choose 50 to give just a little extra slack in case
   // some optimizing compiler does something weird and wonderful.
   if (T > 0.0) {
-    // Initialize the loop:
-    double frequency = bounds[0];
-    double planck_value =
-        extend ? 0.0 : ((frequency < 50 * T) ? integrate_planck(frequency / T) : 1.0);
+    std::vector<double> cumulative;
+    cumulative_Rosseland_Planckian_Spectrum(bounds, T, cumulative, nullptr);
 
+    double last_planck = extend ? 0.0 : cumulative[0];
     for (size_t group = 0; group < groups; ++group) {
-      // Shift the data down:
-      Remember(double const last_frequency = frequency;);
-      double const last_planck = planck_value;
-
-      // New values:
-      frequency = bounds[group + 1];
-      Require(frequency > last_frequency);
-      planck_value = (frequency < 50 * T) ? integrate_planck(frequency / T) : 1.0;
+      Require(bounds[group + 1] > bounds[group]);
 
       // Record the definite integral between frequencies.
-      planck[group] = planck_value - last_planck;
+      planck[group] = cumulative[group + 1] - last_planck;
+      last_planck = cumulative[group + 1];
       Ensure(planck[group] >= 0.0);
       Ensure(planck[group] <= 1.0);
     }
     if (extend) {
-      planck[groups - 1] += 1 - planck_value;
+      planck[groups - 1] += 1 - last_planck;
     }
   } else {
     // T==0
@@ -346,46 +379,22 @@ void CDI::integrate_Rosseland_Spectrum(std::vector<double> const &bounds, double
   // the integral is 1 to roundoff. We choose 50 to give just a little extra slack in case
   // some optimizing compiler does something weird and wonderful.
   if (T > 0.0) {
-    // Initialize the loop:
-    double planck_value(-42.0);
-    double rosseland_value(-42.0);
-    double frequency = bounds[0];
-    if (extend) {
-      rosseland_value = 0.0;
-    } else {
-      if (frequency < 50 * T) {
-        double scaled_frequency = frequency / T;
-        integrate_planck_rosseland(scaled_frequency, std::exp(-scaled_frequency), planck_value,
-                                   rosseland_value);
-      } else {
-        rosseland_value = 1.0;
-      }
-    }
+    std::vector<double> cumulative_planck;
+    std::vector<double> cumulative;
+    cumulative_Rosseland_Planckian_Spectrum(bounds, T, cumulative_planck, &cumulative);
 
+    double last_rosseland = extend ? 0.0 : cumulative[0];
     for (size_t group = 0; group < groups; ++group) {
-
-      // Shift the data down:
-      Remember(double const last_frequency = frequency;);
-      double const last_rosseland = rosseland_value;
-
-      // New values:
-      frequency = bounds[group + 1];
-      Require(frequency > last_frequency);
-      if (frequency < 50 * T) {
-        double scaled_frequency = frequency / T;
-        integrate_planck_rosseland(scaled_frequency, std::exp(-scaled_frequency), planck_value,
-                                   rosseland_value);
-      } else {
-        rosseland_value = 1.0;
-      }
+      Require(bounds[group + 1] > bounds[group]);
 
       // Record the definite integral between frequencies.
-      rosseland[group] = rosseland_value - last_rosseland;
+      rosseland[group] = cumulative[group + 1] - last_rosseland;
+      last_rosseland = cumulative[group + 1];
       Ensure(rosseland[group] >= 0.0);
       Ensure(rosseland[group] <= 1.0);
     }
     if (extend) {
-      rosseland[groups - 1] += 1 - rosseland_value;
+      rosseland[groups - 1] += 1 - last_rosseland;
     }
   } else {
     // T == 0
@@ -431,52 +440,28 @@ void CDI::integrate_Rosseland_Planckian_Spectrum(std::vector<double> const &boun
   // the integral is 1 to roundoff. We choose 50 to give just a little extra slack in case
   // some optimizing compiler does something weird and wonderful.
   if (T > 0.0) {
-    // Initialize the loop:
-    double frequency = bounds[0];
-
-    double planck_value(-42.0);
-    double rosseland_value(-42.0);
-    if (extend) {
-      planck_value = rosseland_value = 0.0;
-    } else {
-      if (frequency < 50 * T) {
-        double scaled_frequency = frequency / T;
-        integrate_planck_rosseland(scaled_frequency, std::exp(-scaled_frequency), planck_value,
-                                   rosseland_value);
-      } else {
-        planck_value = rosseland_value = 1.0;
-      }
-    }
+    std::vector<double> cumulative_planck;
+    std::vector<double> cumulative_rosseland;
+    cumulative_Rosseland_Planckian_Spectrum(bounds, T, cumulative_planck, &cumulative_rosseland);
 
+    double last_planck = extend ? 0.0 : cumulative_planck[0];
+    double last_rosseland = extend ? 0.0 : cumulative_rosseland[0];
     for (size_t group = 0; group < groups; ++group) {
-
-      // Shift the data down:
-      Remember(double const last_frequency = frequency;);
-      double const last_planck = planck_value;
-      double const last_rosseland = rosseland_value;
-
-      // New values:
-      frequency = bounds[group + 1];
-      Require(frequency > last_frequency);
-      if (frequency < 50 * T) {
-        double scaled_frequency = frequency / T;
-        integrate_planck_rosseland(scaled_frequency, std::exp(-scaled_frequency), planck_value,
-                                   rosseland_value);
-      } else {
-        planck_value = rosseland_value = 1.0;
-      }
+      Require(bounds[group + 1] > bounds[group]);
 
       // Record the definite integral between frequencies.
-      planck[group] = planck_value - last_planck;
-      rosseland[group] = rosseland_value - last_rosseland;
+      planck[group] = cumulative_planck[group + 1] - last_planck;
+      rosseland[group] = cumulative_rosseland[group + 1] - last_rosseland;
+      last_planck = cumulative_planck[group + 1];
+      last_rosseland = cumulative_rosseland[group + 1];
       Ensure(planck[group] >= 0.0);
       Ensure(planck[group] <= 1.0);
       Ensure(rosseland[group] >= 0.0);
       Ensure(rosseland[group] <= 1.0);
     }
     if (extend) {
-      planck[groups - 1] += 1 - planck_value;
-      rosseland[groups - 1] += 1 - rosseland_value;
+      planck[groups - 1] += 1 - last_planck;
+      rosseland[groups - 1] += 1 - last_rosseland;
     }
   } else {
     // T==0
@@ -492,6 +477,74 @@ void CDI::integrate_Rosseland_Planckian_Spectrum(std::vector<double> const &boun
   return;
 }
 
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Integrate the Planckian and Rosseland spectra over the stored frequency groups for a batch
+ *        of temperatures.
+ *
+ * If tabulatePlanckRosseland() has been called the integrals are interpolated from the table
+ * (temperatures outside of its range are integrated exactly); otherwise each temperature is
+ * integrated exactly.
+ *
+ * \param numCells  Number of temperatures
+ * \param T         The temperatures. Size numCells
+ * \param planck    Return argument containing the Planckian integrals, stored [cell][group]. Size
+ *                  numCells * getNumberFrequencyGroups()
+ * \param rosseland Return argument containing the Rosseland integrals, same layout, or nullptr
+ */
+void CDI::integrate_Rosseland_Planckian_Spectrum(size_t const numCells, double const *const T,
+                                                 double *const planck, double *const rosseland) {
+  Require(frequencyGroupBoundaries.size() > 1);
+  Require(numCells == 0 || (T != nullptr && planck != nullptr));
+
+  if (planckRosselandTable) {
+    Check(planckRosselandTable->getNumGroups() + 1 == frequencyGroupBoundaries.size());
+    planckRosselandTable->integrate(numCells, T, planck, rosseland);
+    return;
+  }
+
+  size_t const groups(frequencyGroupBoundaries.size() - 1);
+  std::vector<double> cellPlanck;
+  std::vector<double> cellRosseland;
+  for (size_t c = 0; c < numCells; ++c) {
+    integrate_Rosseland_Planckian_Spectrum(frequencyGroupBoundaries, T[c], cellPlanck,
+                                           cellRosseland);
+    std::copy(cellPlanck.begin(), cellPlanck.end(), planck + c * groups);
+    if (rosseland)
+      std::copy(cellRosseland.begin(), cellRosseland.end(), rosseland + c * groups);
+  }
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Build a Planck_Rosseland_Table for the stored frequency group boundaries.
+ *
+ * Subsequent calls to the batched integrate_Rosseland_Planckian_Spectrum interpolate from the
+ * table.  The table is discarded by reset() and setExtend().
+ *
+ * \param Tmin      Lowest tabulated temperature (keV)
+ * \param Tmax      Highest tabulated temperature (keV)
+ * \param tolerance Largest absolute error allowed in any group fraction
+ */
+void CDI::tabulatePlanckRosseland(double const Tmin, double const Tmax, double const tolerance) {
+  Insist(frequencyGroupBoundaries.size() > 1,
+         "Group boundaries must be set (via a multigroup opacity) before tabulating.");
+  Require(Tmin > 0.0);
+  Require(Tmax > Tmin);
+  Require(tolerance > 0.0);
+
+  planckRosselandTable = std::make_shared<const Planck_Rosseland_Table>(frequencyGroupBoundaries,
+                                                                        Tmin, Tmax, tolerance);
+  Ensure(planckRosselandTable);
+}
+
+//------------------------------------------------------------------------------------------------//
+//! Set the extended group boundaries flag; a table built without it no longer applies.
+void CDI::setExtend() {
+  extend = true;
+  planckRosselandTable.reset();
+}
+
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Collapse a multigroup opacity set into a single representative value weighted by the
@@ -1005,9 +1058,10 @@ void CDI::reset() {
     }
   }
 
-  // empty the frequency group boundaries
+  // empty the frequency group boundaries and their integral table
   frequencyGroupBoundaries.clear();
   Check(frequencyGroupBoundaries.empty());
+  planckRosselandTable.reset();
 
   // reset the EoS shared_ptr
   spEoS = SP_EoS();
@@ -51,6 +51,30 @@ double constexpr NORM_FACTOR = 0.25 * coeff; // 15/(4*pi^4);
 } // namespace
 
 namespace rtt_cdi {
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief The arithmetic of taylor_series_planck without design-by-contract checks.
+ *
+ * The kernels in this file are branch free and unchecked so that loops over arrays of scaled
+ * frequencies vectorize; the scalar functions wrap them with the checks.
+ */
+GPU_HOST_DEVICE inline double taylor_series_planck_kernel(double const x) {
+  double const xsqrd = x * x;
+
+  double taylor = FMA(xsqrd, coeff_21, coeff_19);
+  taylor = FMA(taylor, xsqrd, coeff_17);
+  taylor = FMA(taylor, xsqrd, coeff_15);
+  taylor = FMA(taylor, xsqrd, coeff_13);
+  taylor = FMA(taylor, xsqrd, coeff_11);
+  taylor = FMA(taylor, xsqrd, coeff_9);
+  taylor = FMA(taylor, xsqrd, coeff_7);
+  taylor = FMA(taylor, xsqrd, coeff_5);
+  taylor = FMA(taylor, x, coeff_4);
+  taylor = FMA(taylor, x, coeff_3);
+  taylor *= x * xsqrd * coeff;
+  return taylor;
+}
+
 //------------------------------------------------------------------------------------------------//
 /*!
  * \fn inline double taylor_series_planck(double x)
@@ -82,19 +106,7 @@ namespace rtt_cdi {
 GPU_HOST_DEVICE inline double taylor_series_planck(double x) {
   Require(x >= 0.0);
 
-  double const xsqrd = x * x;
-
-  double taylor = FMA(xsqrd, coeff_21, coeff_19);
-  taylor = FMA(taylor, xsqrd, coeff_17);
-  taylor = FMA(taylor, xsqrd, coeff_15);
-  taylor = FMA(taylor, xsqrd, coeff_13);
-  taylor = FMA(taylor, xsqrd, coeff_11);
-  taylor = FMA(taylor, xsqrd, coeff_9);
-  taylor = FMA(taylor, xsqrd, coeff_7);
-  taylor = FMA(taylor, xsqrd, coeff_5);
-  taylor = FMA(taylor, x, coeff_4);
-  taylor = FMA(taylor, x, coeff_3);
-  taylor *= x * xsqrd * coeff;
+  double const taylor = taylor_series_planck_kernel(x);
 
   Ensure(taylor >= 0.0);
 
@@ -102,15 +114,9 @@ GPU_HOST_DEVICE inline double taylor_series_planck(double x) {
 }
 
 //------------------------------------------------------------------------------------------------//
-/*!
- * \brief return the 10-term Polylogarithmic expansion (minus one) for the Planck integral given
- *        \f$ x \f$ and \f$ e^{-x} \f$ (for efficiency)
- */
-GPU_HOST_DEVICE inline double polylog_series_minus_one_planck(double const x, double const eix) {
-  Require(x >= 0.0);
-  Require(x < 1.0e154); // value will be squared, make sure it's less than sqrt of max double
-  Require(rtt_dsxx::soft_equiv(std::exp(-x), eix));
-
+//! The arithmetic of polylog_series_minus_one_planck without design-by-contract checks.
+GPU_HOST_DEVICE inline double polylog_series_minus_one_planck_kernel(double const x,
+                                                                     double const eix) {
   double const xsqrd = x * x;
 
   constexpr std::array<double, 9> i_plus_two_inv = {
@@ -178,6 +184,21 @@ GPU_HOST_DEVICE inline double polylog_series_minus_one_planck(double const x, do
   // calculate the lower polylogarithmic integral
   double const poly = -coeff * (xsqrd * x * li1 + 3 * xsqrd * li2 + 6.0 * (x * li3 + li4));
 
+  return poly;
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief return the 10-term Polylogarithmic expansion (minus one) for the Planck integral given
+ *        \f$ x \f$ and \f$ e^{-x} \f$ (for efficiency)
+ */
+GPU_HOST_DEVICE inline double polylog_series_minus_one_planck(double const x, double const eix) {
+  Require(x >= 0.0);
+  Require(x < 1.0e154); // value will be squared, make sure it's less than sqrt of max double
+  Require(rtt_dsxx::soft_equiv(std::exp(-x), eix));
+
+  double const poly = polylog_series_minus_one_planck_kernel(x, eix);
+
   Ensure(poly <= 0.0);
   return poly;
 }
@@ -218,6 +239,19 @@ GPU_HOST_DEVICE inline double integrate_planck(double const scaled_freq) {
   return integral;
 }
 
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief The arithmetic of integrate_planck without design-by-contract checks or branches.
+ *
+ * Above \f$ x = 10^{100} \f$, \f$ e^{-x} \f$ has underflowed, so clamping x there makes the polylog
+ * value exactly one, which is what integrate_planck returns in that case.
+ */
+GPU_HOST_DEVICE inline double integrate_planck_kernel(double const x, double const eix) {
+  double const taylor = taylor_series_planck_kernel(std::min(x, 1.0e15));
+  double const poly = polylog_series_minus_one_planck_kernel(std::min(x, 1.0e100), eix) + 1.0;
+  return std::min(taylor, poly);
+}
+
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Compute the difference between an integrated Planck and Rosseland curves over \f$ (0,\nu)
@@ -259,6 +293,25 @@ GPU_HOST_DEVICE inline double Planck2Rosseland(double const freq, double const e
   return NORM_FACTOR * exp_freq * freq_3 * freq / -std::expm1(-freq);
 }
 
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief The arithmetic of Planck2Rosseland without design-by-contract checks or branches.
+ *
+ * Both of the Planck2Rosseland expansions are evaluated and one is selected.  The argument of the
+ * full expression is clamped to [1e-5, 1e3] so that the discarded lane cannot divide zero by zero
+ * or overflow; above 1e3, \f$ e^{-x} \f$ is zero and so is the result, as in Planck2Rosseland.
+ */
+GPU_HOST_DEVICE inline double Planck2Rosseland_kernel(double const freq, double const exp_freq) {
+  double const freq_3 = freq * freq * freq;
+  double const series = NORM_FACTOR * freq_3 * (1.0 - 0.5 * freq);
+
+  double const clamped = std::min(std::max(freq, 1.0e-5), 1.0e3);
+  double const clamped_3 = clamped * clamped * clamped;
+  double const full = NORM_FACTOR * exp_freq * clamped_3 * clamped / -std::expm1(-clamped);
+
+  return freq < 1.0e-5 ? series : full;
+}
+
 //------------------------------------------------------------------------------------------------//
 /*! \brief Integrate the normalized Planckian and Rosseland spectra from 0 to \f$ x
  *         (\frac{h\nu}{kT}) \f$.
@@ -412,6 +465,110 @@ GPU_HOST_DEVICE inline double integrateRosselandSpectrum(const double low, const
   return rosseland;
 }
 
+//------------------------------------------------------------------------------------------------//
+// ARRAY FORMS
+//
+// These evaluate many scaled frequencies (or frequency ranges and temperatures) per call.  Their
+// loop bodies are the branch-free kernels above, so the compiler can vectorize them (with OpenMP
+// the loops are marked simd).  The arithmetic is that of the scalar functions, so results are
+// bitwise identical when the compiler contracts both the same way; with FMA contraction applied
+// differently to the vectorized loops they agree to within planck_array_ulp_tolerance units in the
+// last place.  Builds with -ffast-math may call vector exp() implementations and exceed this.
+//------------------------------------------------------------------------------------------------//
+
+//! Largest difference, in ULP, between the array and scalar forms of the Planck integrators.
+constexpr unsigned planck_array_ulp_tolerance = 8;
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Integrate the normalized Planckian spectrum from 0 to each of n scaled frequencies.
+ *
+ * \param[in]  n           number of frequencies.
+ * \param[in]  scaled_freq upper integration limits \f$ h\nu/kT \f$, each >= 0 (size n).
+ * \param[out] planck      integrate_planck(scaled_freq[i]) (size n, may alias scaled_freq).
+ */
+inline void integrate_planck(size_t const n, double const *const scaled_freq,
+                             double *const planck) {
+  Require(n == 0 || (scaled_freq != nullptr && planck != nullptr));
+#ifdef OPENMP_FOUND
+#pragma omp simd
+#endif
+  for (size_t i = 0; i < n; ++i)
+    planck[i] = integrate_planck_kernel(scaled_freq[i], std::exp(-scaled_freq[i]));
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Difference between the integrated Planck and Rosseland curves for n scaled frequencies.
+ *
+ * \param[in]  n    number of frequencies.
+ * \param[in]  freq scaled frequencies, each >= 0 (size n).
+ * \param[out] diff Planck2Rosseland(freq[i], exp(-freq[i])) (size n, may alias freq).
+ */
+inline void Planck2Rosseland(size_t const n, double const *const freq, double *const diff) {
+  Require(n == 0 || (freq != nullptr && diff != nullptr));
+#ifdef OPENMP_FOUND
+#pragma omp simd
+#endif
+  for (size_t i = 0; i < n; ++i)
+    diff[i] = Planck2Rosseland_kernel(freq[i], std::exp(-freq[i]));
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Integrate the normalized Planckian and Rosseland spectra from 0 to n scaled frequencies.
+ *
+ * \param[in]  n           number of frequencies.
+ * \param[in]  scaled_freq upper integration limits, each >= 0 (size n).
+ * \param[out] planck      Planck integrals (size n, may alias scaled_freq).
+ * \param[out] rosseland   Rosseland integrals (size n).
+ */
+inline void integrate_planck_rosseland(size_t const n, double const *const scaled_freq,
+                                       double *const planck, double *const rosseland) {
+  Require(n == 0 || (scaled_freq != nullptr && planck != nullptr && rosseland != nullptr));
+#ifdef OPENMP_FOUND
+#pragma omp simd
+#endif
+  for (size_t i = 0; i < n; ++i) {
+    double const x = scaled_freq[i];
+    double const eix = std::exp(-x);
+    double const p = integrate_planck_kernel(x, eix);
+    rosseland[i] = p - Planck2Rosseland_kernel(x, eix);
+    planck[i] = p;
+  }
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Integrate the normalized Planckian spectrum over n frequency ranges and temperatures.
+ *
+ * \param[in]  n        number of ranges.
+ * \param[in]  low      lower frequency bounds (size n).
+ * \param[in]  high     upper frequency bounds, high[i] >= low[i] (size n).
+ * \param[in]  T        temperatures, each >= 0 (size n).
+ * \param[out] integral integratePlanckSpectrum(low[i], high[i], T[i]) (size n).
+ */
+inline void integratePlanckSpectrum(size_t const n, double const *const low,
+                                    double const *const high, double const *const T,
+                                    double *const integral) {
+  Require(n == 0 || (low != nullptr && high != nullptr && T != nullptr && integral != nullptr));
+#ifdef OPENMP_FOUND
+#pragma omp simd
+#endif
+  for (size_t i = 0; i < n; ++i) {
+    // Cold lanes return zero; divide them by one so that they stay finite.
+    bool const cold = T[i] <= high[i] * std::numeric_limits<double>::min();
+    double const Ts = cold ? 1.0 : T[i];
+    double const x_low = low[i] / Ts;
+    double const x_high = high[i] / Ts;
+    double const value = integrate_planck_kernel(x_high, std::exp(-x_high)) -
+                         integrate_planck_kernel(x_low, std::exp(-x_low));
+    integral[i] = cold ? 0.0 : value;
+  }
+}
+
+class Planck_Rosseland_Table;
+
 //================================================================================================//
 /*!
  * \class CDI
@@ -681,6 +838,9 @@ class CDI {
   //! Extend integration to place low and high tails in low and high groups?
   DLL_PUBLIC_cdi static bool extend;
 
+  //! Tabulated group integrals of frequencyGroupBoundaries (null until tabulatePlanckRosseland).
+  static std::shared_ptr<const Planck_Rosseland_Table> planckRosselandTable;
+
   // IMPLELEMENTATION
   // ================
 
@@ -721,8 +881,12 @@ public:
   //! Clear all data objects
   void reset();
 
-  //! Set extended group boundaries flag
-  static void setExtend() { extend = true; }
+  //! Set extended group boundaries flag (discards any table built without it)
+  static void setExtend();
+
+  //! Tabulate the group integrals of the stored group structure for fast batched lookups.
+  static void tabulatePlanckRosseland(double const Tmin, double const Tmax,
+                                      double const tolerance = 1.0e-8);
 
   // GETTERS
   // -------
@@ -774,6 +938,11 @@ public:
   //! Returns the extended group boundaries flag.
   static bool getExtend() { return extend; }
 
+  //! Returns the table used by the batched integrator (null if none has been built).
+  static std::shared_ptr<const Planck_Rosseland_Table> getPlanckRosselandTable() {
+    return planckRosselandTable;
+  }
+
   // INTEGRATORS:
   // ===========
 
@@ -815,6 +984,14 @@ public:
   static void integrate_Rosseland_Planckian_Spectrum(std::vector<double> const &bounds,
                                                      double const T, std::vector<double> &planck,
                                                      std::vector<double> &rosseland);
+
+  // Over the stored group structure for a batch of temperatures:
+  // -----------------------------------------------------------
+
+  //! Integrate the Planckian and Rosseland over all frequency groups for many cells
+  static void integrate_Rosseland_Planckian_Spectrum(size_t const numCells, double const *const T,
+                                                     double *const planck,
+                                                     double *const rosseland);
 };
 
 //------------------------------------------------------------------------------------------------//
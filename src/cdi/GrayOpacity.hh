@@ -108,6 +108,24 @@ public:
   virtual std::vector<double> getOpacity(double targetTemperature,
                                          const std::vector<double> &targetDensity) const = 0;
 
+  /*!
+   * \brief Cell-batched opacity accessor that writes into a caller-owned buffer.
+   *
+   * Sets opacity[c] to getOpacity(targetTemperature[c], targetDensity[c]) for every cell.  The
+   * default implementation calls the single cell accessor; table based classes override it to
+   * search their tables more efficiently.
+   *
+   * \param numCells The number of cells.
+   * \param targetTemperature Cell temperatures (keV) [numCells].
+   * \param targetDensity Cell densities (g/cm^3) [numCells].
+   * \param opacity Caller-owned buffer that receives numCells opacities (cm^2/g).
+   */
+  virtual void getOpacityBatch(size_t numCells, double const *targetTemperature,
+                               double const *targetDensity, double *opacity) const {
+    for (size_t c = 0; c < numCells; ++c)
+      opacity[c] = getOpacity(targetTemperature[c], targetDensity[c]);
+  }
+
   //! Query whether the data is in tables or functional form.
   virtual bool data_in_tabular_form() const = 0;
 
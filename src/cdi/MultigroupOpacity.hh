@@ -11,7 +11,9 @@
 #define rtt_cdi_MultigroupOpacity_hh
 
 #include "OpacityCommon.hh"
+#include "ds++/Assert.hh"
 #include "ds++/config.h"
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -105,6 +107,30 @@ public:
   virtual std::vector<std::vector<double>>
   getOpacity(double targetTemperature, const std::vector<double> &targetDensity) const = 0;
 
+  /*!
+   * \brief Cell-batched opacity accessor that writes into a caller-owned (cell x group) buffer.
+   *
+   * Sets opacity[c * getNumGroups() + g] to the group g opacity at (targetTemperature[c],
+   * targetDensity[c]), i.e. the same values as getOpacity(targetTemperature[c], targetDensity[c]),
+   * without allocating a vector per cell.  The default implementation calls the single cell
+   * accessor (and so still allocates); derived classes override it to fill the buffer directly.
+   *
+   * \param numCells The number of cells.
+   * \param targetTemperature Cell temperatures (keV) [numCells].
+   * \param targetDensity Cell densities (g/cm^3) [numCells].
+   * \param opacity Caller-owned buffer that receives numCells * getNumGroups() opacities (cm^2/g),
+   *          group index fastest.
+   */
+  virtual void getOpacityBatch(size_t numCells, double const *targetTemperature,
+                               double const *targetDensity, double *opacity) const {
+    size_t const numGroups = getNumGroups();
+    for (size_t c = 0; c < numCells; ++c) {
+      std::vector<double> const cellOpacity = getOpacity(targetTemperature[c], targetDensity[c]);
+      Check(cellOpacity.size() == numGroups);
+      std::copy(cellOpacity.begin(), cellOpacity.end(), opacity + c * numGroups);
+    }
+  }
+
   //! Query whether the data is in tables or functional form.
   virtual bool data_in_tabular_form() const = 0;
 
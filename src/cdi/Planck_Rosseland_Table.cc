@@ -0,0 +1,247 @@
+//--------------------------------------------*-C++-*---------------------------------------------//
+/*!
+ * \file   cdi/Planck_Rosseland_Table.cc
+ * \author agent
+ * \date   Fri Oct 16 2026
+ * \brief  Planck_Rosseland_Table member definitions.
+ * \note   Copyright (C) 2026 Triad National Security, LLC., All rights reserved. */
+//------------------------------------------------------------------------------------------------//
+
+#include "Planck_Rosseland_Table.hh"
+#include "CDI.hh"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+//! Scaled frequencies above this integrate to 1 to roundoff (see CDI.cc).
+double constexpr x_cutoff = 50.0;
+
+//! Largest number of temperatures the constructor will tabulate.
+size_t constexpr max_temperatures = 1U << 20U;
+
+//! Initial number of intervals per decade of temperature.
+double constexpr intervals_per_decade = 16.0;
+
+//------------------------------------------------------------------------------------------------//
+//! Cumulative Planck and Rosseland integrals over [0, x] and their ln(T) derivatives.
+void cumulative(double const x, double &planck, double &dPlanck, double &rosseland,
+                double &dRosseland) {
+  if (x >= x_cutoff) {
+    planck = rosseland = 1.0;
+    dPlanck = dRosseland = 0.0;
+    return;
+  }
+  rtt_cdi::integrate_planck_rosseland(x, std::exp(-x), planck, rosseland);
+  if (x > 0.0) {
+    // x = h nu / kT so dx/dlnT = -x, and the derivatives are -x b(x) and -x r(x).
+    double const x4 = x * x * x * x;
+    double const em1 = std::expm1(-x);
+    dPlanck = -coeff * x4 / std::expm1(x);
+    dRosseland = -NORM_FACTOR * x4 * x * std::exp(-x) / (em1 * em1);
+  } else {
+    dPlanck = dRosseland = 0.0;
+  }
+}
+
+} // namespace
+
+namespace rtt_cdi {
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \param[in] groupBounds Frequency group boundaries (keV), monotonically increasing, size > 1.
+ * \param[in] Tmin_in     Lowest tabulated temperature (keV), > 0.
+ * \param[in] Tmax_in     Highest tabulated temperature (keV), > Tmin.
+ * \param[in] tolerance   Largest absolute error allowed in any group fraction.
+ */
+Planck_Rosseland_Table::Planck_Rosseland_Table(std::vector<double> groupBounds,
+                                               double const Tmin_in, double const Tmax_in,
+                                               double const tolerance)
+    : bounds(std::move(groupBounds)), numGroups(bounds.size() - 1), extend(CDI::getExtend()),
+      Tmin(Tmin_in), Tmax(Tmax_in), logTmin(std::log(Tmin_in)) {
+  Require(bounds.size() > 1);
+  Require(bounds[0] >= 0.0);
+  Require(std::is_sorted(bounds.begin(), bounds.end()));
+  Require(Tmin > 0.0);
+  Require(Tmax > Tmin);
+  Require(tolerance > 0.0);
+
+  double const decades = std::log10(Tmax / Tmin);
+  numTemperatures = static_cast<size_t>(std::ceil(intervals_per_decade * decades)) + 1;
+  for (;;) {
+    tabulate();
+    maxError = midpointError();
+    if (maxError <= 0.5 * tolerance)
+      break;
+    numTemperatures = 2 * (numTemperatures - 1) + 1;
+    Insist(numTemperatures <= max_temperatures,
+           "Planck_Rosseland_Table: tolerance cannot be met with a reasonable table size.");
+  }
+
+  Ensure(numTemperatures >= 2);
+  Ensure(nodes.size() == 4 * numGroups * numTemperatures);
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \param[in]  T          Temperature (keV), >= 0.
+ * \param[out] planck     Group Planck integrals (size numGroups) or nullptr.
+ * \param[out] dPlanck    Their derivatives with respect to ln T or nullptr.
+ * \param[out] rosseland  Group Rosseland integrals (size numGroups) or nullptr.
+ * \param[out] dRosseland Their derivatives with respect to ln T or nullptr.
+ *
+ * This is the algorithm of CDI::integrate_Rosseland_Planckian_Spectrum, applied with the extend
+ * setting captured at construction.
+ */
+void Planck_Rosseland_Table::evaluate(double const T, double *const planck,
+                                      double *const dPlanck, double *const rosseland,
+                                      double *const dRosseland) const {
+  Require(T >= 0.0);
+
+  if (T <= 0.0) {
+    // All of the energy is at zero frequency.
+    for (size_t g = 0; g < numGroups; ++g) {
+      double const value = (g == 0 && (extend || bounds[0] <= 0.0)) ? 1.0 : 0.0;
+      if (planck)
+        planck[g] = value;
+      if (rosseland)
+        rosseland[g] = value;
+      if (dPlanck)
+        dPlanck[g] = 0.0;
+      if (dRosseland)
+        dRosseland[g] = 0.0;
+    }
+    return;
+  }
+
+  double const invT = 1.0 / T;
+  double lastP(0.0), lastDP(0.0), lastR(0.0), lastDR(0.0);
+  if (!extend)
+    cumulative(bounds[0] * invT, lastP, lastDP, lastR, lastDR);
+
+  for (size_t g = 0; g < numGroups; ++g) {
+    double P(0.0), DP(0.0), R(0.0), DR(0.0);
+    if (extend && g + 1 == numGroups) {
+      // The last group collects the tail, so its upper cumulative integral is one.
+      P = R = 1.0;
+    } else {
+      cumulative(bounds[g + 1] * invT, P, DP, R, DR);
+    }
+    if (planck)
+      planck[g] = P - lastP;
+    if (dPlanck)
+      dPlanck[g] = DP - lastDP;
+    if (rosseland)
+      rosseland[g] = R - lastR;
+    if (dRosseland)
+      dRosseland[g] = DR - lastDR;
+    lastP = P;
+    lastDP = DP;
+    lastR = R;
+    lastDR = DR;
+  }
+}
+
+//------------------------------------------------------------------------------------------------//
+void Planck_Rosseland_Table::tabulate() {
+  Require(numTemperatures >= 2);
+
+  spacing = (std::log(Tmax) - logTmin) / static_cast<double>(numTemperatures - 1);
+  invSpacing = 1.0 / spacing;
+  nodes.resize(4 * numGroups * numTemperatures);
+
+  for (size_t i = 0; i < numTemperatures; ++i) {
+    double const T =
+        i + 1 == numTemperatures ? Tmax : std::exp(logTmin + static_cast<double>(i) * spacing);
+    double *const node = &nodes[4 * numGroups * i];
+    evaluate(T, node, node + numGroups, node + 2 * numGroups, node + 3 * numGroups);
+  }
+}
+
+//------------------------------------------------------------------------------------------------//
+double Planck_Rosseland_Table::midpointError() const {
+  std::vector<double> exactP(numGroups);
+  std::vector<double> exactR(numGroups);
+  std::vector<double> P(numGroups);
+  std::vector<double> R(numGroups);
+
+  double error(0.0);
+  for (size_t i = 0; i + 1 < numTemperatures; ++i) {
+    double const T = std::exp(logTmin + (static_cast<double>(i) + 0.5) * spacing);
+    evaluate(T, exactP.data(), nullptr, exactR.data(), nullptr);
+    integrate(1, &T, P.data(), R.data());
+    for (size_t g = 0; g < numGroups; ++g)
+      error = std::max(error, std::max(std::abs(P[g] - exactP[g]), std::abs(R[g] - exactR[g])));
+  }
+  return error;
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \param[in]  T         Temperature (keV), >= 0.
+ * \param[out] planck    Group Planck integrals (size numGroups) or nullptr.
+ * \param[out] rosseland Group Rosseland integrals (size numGroups) or nullptr.
+ */
+void Planck_Rosseland_Table::integrate(double const T, double *const planck,
+                                       double *const rosseland) const {
+  integrate(1, &T, planck, rosseland);
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \param[in]  numCells  Number of temperatures.
+ * \param[in]  T         Cell temperatures (keV), each >= 0.
+ * \param[out] planck    Group Planck integrals, planck[cell * numGroups + group], or nullptr.
+ * \param[out] rosseland Group Rosseland integrals, same layout, or nullptr.
+ *
+ * Each in-range cell costs one logarithm and a four-term blend of two table rows per group; the
+ * group loop is unit stride and has no branches.
+ */
+void Planck_Rosseland_Table::integrate(size_t const numCells, double const *const T,
+                                       double *const planck, double *const rosseland) const {
+  Require(numCells == 0 || T != nullptr);
+
+  size_t const G = numGroups;
+  size_t const rowSize = 4 * G;
+  for (size_t c = 0; c < numCells; ++c) {
+    Require(T[c] >= 0.0);
+    double *const P = planck ? planck + c * G : nullptr;
+    double *const R = rosseland ? rosseland + c * G : nullptr;
+
+    if (!(T[c] >= Tmin && T[c] <= Tmax)) {
+      evaluate(T[c], P, nullptr, R, nullptr);
+      continue;
+    }
+
+    double const s = (std::log(T[c]) - logTmin) * invSpacing;
+    size_t const i = std::min(static_cast<size_t>(std::max(s, 0.0)), numTemperatures - 2);
+    double const t = s - static_cast<double>(i);
+    double const omt = 1.0 - t;
+
+    // Cubic Hermite basis, with the derivative weights scaled by the node spacing.
+    double const h00 = (1.0 + 2.0 * t) * omt * omt;
+    double const h10 = t * omt * omt * spacing;
+    double const h01 = t * t * (3.0 - 2.0 * t);
+    double const h11 = -t * t * omt * spacing;
+
+    double const *const lo = &nodes[rowSize * i];
+    double const *const hi = lo + rowSize;
+    if (P) {
+      for (size_t g = 0; g < G; ++g)
+        P[g] = h00 * lo[g] + h10 * lo[G + g] + h01 * hi[g] + h11 * hi[G + g];
+    }
+    if (R) {
+      double const *const lor = lo + 2 * G;
+      double const *const hir = hi + 2 * G;
+      for (size_t g = 0; g < G; ++g)
+        R[g] = h00 * lor[g] + h10 * lor[G + g] + h01 * hir[g] + h11 * hir[G + g];
+    }
+  }
+}
+
+} // end namespace rtt_cdi
+
+//------------------------------------------------------------------------------------------------//
+// end of cdi/Planck_Rosseland_Table.cc
+//------------------------------------------------------------------------------------------------//
@@ -0,0 +1,119 @@
+//--------------------------------------------*-C++-*---------------------------------------------//
+/*!
+ * \file   cdi/Planck_Rosseland_Table.hh
+ * \author agent
+ * \date   Fri Oct 16 2026
+ * \brief  Planck_Rosseland_Table class header file.
+ * \note   Copyright (C) 2026 Triad National Security, LLC., All rights reserved. */
+//------------------------------------------------------------------------------------------------//
+
+#ifndef rtt_cdi_Planck_Rosseland_Table_hh
+#define rtt_cdi_Planck_Rosseland_Table_hh
+
+#include <cstddef>
+#include <vector>
+
+namespace rtt_cdi {
+
+//================================================================================================//
+/*!
+ * \class Planck_Rosseland_Table
+ *
+ * \brief Tabulated group integrals of the normalized Planckian and Rosseland spectra.
+ *
+ * CDI::integrate_Rosseland_Planckian_Spectrum evaluates series expansions and exponentials at every
+ * group boundary for every temperature.  For a fixed group structure the group fractions are smooth
+ * functions of \f$ \ln T \f$, so this class samples them, with their exact \f$ \ln T \f$
+ * derivatives, on a uniform \f$ \ln T \f$ grid and evaluates them by cubic Hermite interpolation.
+ *
+ * The derivative of the fraction of group \f$ [\nu_g, \nu_{g+1}] \f$ is known in closed form,
+ * \f[
+ *   \frac{\partial}{\partial \ln T} \int_{x_g}^{x_{g+1}} b(x) dx = x_g b(x_g) - x_{g+1} b(x_{g+1}),
+ *   \qquad x = \frac{h\nu}{kT},
+ * \f]
+ * and likewise for the Rosseland \f$ r(x) \f$.  The interpolation error of cubic Hermite is
+ * largest near the middle of an interval, so the constructor compares the interpolant with the
+ * exact integrals at every interval midpoint and doubles the grid density until all midpoint
+ * errors are below half of the requested tolerance.  Temperatures outside [Tmin, Tmax] (including
+ * T = 0) are integrated exactly.
+ *
+ * The table honors the CDI::getExtend() setting in effect when it is built.
+ */
+//================================================================================================//
+class Planck_Rosseland_Table {
+public:
+  // CREATORS
+
+  //! Tabulate the group integrals of groupBounds for Tmin <= T <= Tmax.
+  Planck_Rosseland_Table(std::vector<double> groupBounds, double const Tmin, double const Tmax,
+                         double const tolerance = 1.0e-8);
+
+  // ACCESSORS
+
+  //! Number of frequency groups.
+  size_t getNumGroups() const { return numGroups; }
+
+  //! Number of temperatures in the table.
+  size_t getNumTemperatures() const { return numTemperatures; }
+
+  //! Lowest tabulated temperature.
+  double getTmin() const { return Tmin; }
+
+  //! Highest tabulated temperature.
+  double getTmax() const { return Tmax; }
+
+  //! Largest interpolation error found at the interval midpoints during construction.
+  double getMaxError() const { return maxError; }
+
+  //! Group Planck and Rosseland integrals at one temperature (either output may be null).
+  void integrate(double const T, double *const planck, double *const rosseland) const;
+
+  //! Group Planck and Rosseland integrals for a batch of cells, stored [cell][group].
+  void integrate(size_t const numCells, double const *const T, double *const planck,
+                 double *const rosseland) const;
+
+private:
+  // IMPLEMENTATION
+
+  //! Exact group integrals and their ln(T) derivatives at one temperature.
+  void evaluate(double const T, double *const planck, double *const dPlanck,
+                double *const rosseland, double *const dRosseland) const;
+
+  //! Sample the integrals on numTemperatures nodes.
+  void tabulate();
+
+  //! Largest difference between the interpolant and the exact integrals at interval midpoints.
+  double midpointError() const;
+
+  // DATA
+
+  //! Frequency group boundaries (size numGroups + 1).
+  std::vector<double> bounds;
+
+  size_t numGroups;
+
+  //! CDI::getExtend() when the table was built.
+  bool extend;
+
+  double Tmin;
+  double Tmax;
+  double logTmin;
+
+  //! Number of nodes, node spacing in ln(T) and its inverse.
+  size_t numTemperatures = 0;
+  double spacing = 0.0;
+  double invSpacing = 0.0;
+
+  double maxError = 0.0;
+
+  //! Per node: planck, d(planck)/dlnT, rosseland, d(rosseland)/dlnT, each numGroups long.
+  std::vector<double> nodes;
+};
+
+} // end namespace rtt_cdi
+
+#endif // rtt_cdi_Planck_Rosseland_Table_hh
+
+//------------------------------------------------------------------------------------------------//
+// end of cdi/Planck_Rosseland_Table.hh
+//------------------------------------------------------------------------------------------------//
@@ -0,0 +1,168 @@
+//--------------------------------------------*-C++-*---------------------------------------------//
+/*!
+ * \file   cdi/test/tPlanck_Arrays.cc
+ * \author agent
+ * \date   Fri Oct 16 2026
+ * \brief  Compare the array and scalar forms of the Planckian integrators.
+ * \note   Copyright (C) 2026 Triad National Security, LLC., All rights reserved. */
+//------------------------------------------------------------------------------------------------//
+
+#include "cdi/CDI.hh"
+#include "ds++/Release.hh"
+#include "ds++/ScalarUnitTest.hh"
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+using namespace std;
+
+//------------------------------------------------------------------------------------------------//
+// HELPERS
+//------------------------------------------------------------------------------------------------//
+
+//! Number of representable doubles between a and b (both finite or both the same infinity).
+uint64_t ulp_distance(double const a, double const b) {
+  int64_t ia(0);
+  int64_t ib(0);
+  memcpy(&ia, &a, sizeof(double));
+  memcpy(&ib, &b, sizeof(double));
+  // Map the sign-magnitude bit patterns onto a monotonic integer scale.
+  ia = ia < 0 ? numeric_limits<int64_t>::min() - ia : ia;
+  ib = ib < 0 ? numeric_limits<int64_t>::min() - ib : ib;
+  return ia > ib ? static_cast<uint64_t>(ia) - static_cast<uint64_t>(ib)
+                 : static_cast<uint64_t>(ib) - static_cast<uint64_t>(ia);
+}
+
+//! Scaled frequencies covering every branch of the scalar integrators.
+vector<double> scaled_frequencies() {
+  vector<double> x = {0.0,   1.0e-300, 1.0e-6, 1.0e-5, 9.999999e-6, 2.06192398071289,
+                      44.0,  50.0,     745.0,  746.0,  1.0e3,       1.0e15,
+                      1.0e77, 1.2e77,  1.0e100, 1.0e101, 1.0e200,   numeric_limits<double>::max()};
+  size_t const n = 20000;
+  for (size_t i = 0; i < n; ++i)
+    x.push_back(1.0e-8 * pow(1.0e11, static_cast<double>(i) / static_cast<double>(n - 1)));
+  return x;
+}
+
+//------------------------------------------------------------------------------------------------//
+// TESTS
+//------------------------------------------------------------------------------------------------//
+
+void test_scaled_arrays(rtt_dsxx::UnitTest &ut) {
+  uint64_t const tol = rtt_cdi::planck_array_ulp_tolerance;
+  vector<double> const x = scaled_frequencies();
+  size_t const n = x.size();
+
+  vector<double> planck(n);
+  vector<double> diff(n);
+  vector<double> planck2(n);
+  vector<double> rosseland(n);
+  rtt_cdi::integrate_planck(n, x.data(), planck.data());
+  rtt_cdi::Planck2Rosseland(n, x.data(), diff.data());
+  rtt_cdi::integrate_planck_rosseland(n, x.data(), planck2.data(), rosseland.data());
+
+  uint64_t worst(0);
+  for (size_t i = 0; i < n; ++i) {
+    double p(0.0);
+    double r(0.0);
+    rtt_cdi::integrate_planck_rosseland(x[i], exp(-x[i]), p, r);
+    worst = max(worst, ulp_distance(planck[i], rtt_cdi::integrate_planck(x[i])));
+    worst = max(worst, ulp_distance(diff[i], rtt_cdi::Planck2Rosseland(x[i], exp(-x[i]))));
+    worst = max(worst, ulp_distance(planck2[i], p));
+    worst = max(worst, ulp_distance(rosseland[i], r));
+  }
+  FAIL_IF_NOT(worst <= tol);
+
+  // The arrays may alias.
+  vector<double> in_place(x);
+  rtt_cdi::integrate_planck(n, in_place.data(), in_place.data());
+  bool same(true);
+  for (size_t i = 0; i < n; ++i)
+    same = same && ulp_distance(in_place[i], planck[i]) == 0;
+  FAIL_IF_NOT(same);
+
+  if (ut.numFails == 0) {
+    ostringstream msg;
+    msg << "Scaled-frequency arrays match the scalar integrators to " << worst << " ULP.";
+    PASSMSG(msg.str());
+  }
+}
+
+//------------------------------------------------------------------------------------------------//
+void test_spectrum_array(rtt_dsxx::UnitTest &ut) {
+  size_t const n = 5000;
+  vector<double> low(n);
+  vector<double> high(n);
+  vector<double> T(n);
+  for (size_t i = 0; i < n; ++i) {
+    double const f = fmod(0.6180339887498949 * static_cast<double>(i), 1.0);
+    low[i] = i % 7 == 0 ? 0.0 : 1.0e-3 * pow(1.0e5, f);
+    high[i] = low[i] * (1.0 + 3.0 * f) + 1.0e-3;
+    T[i] = i % 11 == 0 ? 0.0 : 1.0e-2 * pow(1.0e4, 1.0 - f);
+  }
+  T[1] = 1.0e-320; // cold relative to high
+
+  vector<double> integral(n);
+  rtt_cdi::integratePlanckSpectrum(n, low.data(), high.data(), T.data(), integral.data());
+
+  uint64_t worst(0);
+  for (size_t i = 0; i < n; ++i) {
+    double const scalar = rtt_cdi::integratePlanckSpectrum(low[i], high[i], T[i]);
+    worst = max(worst, ulp_distance(integral[i], scalar));
+  }
+  FAIL_IF_NOT(worst <= rtt_cdi::planck_array_ulp_tolerance);
+
+  if (ut.numFails == 0)
+    PASSMSG("integratePlanckSpectrum array matches the scalar form.");
+}
+
+//------------------------------------------------------------------------------------------------//
+void benchmark_arrays(rtt_dsxx::UnitTest &ut) {
+  size_t const n = 200000;
+  vector<double> x(n);
+  for (size_t i = 0; i < n; ++i)
+    x[i] = 1.0e-3 * pow(1.0e5, fmod(0.6180339887498949 * static_cast<double>(i), 1.0));
+
+  vector<double> planck(n);
+  vector<double> rosseland(n);
+  auto const t0 = chrono::steady_clock::now();
+  for (size_t i = 0; i < n; ++i)
+    rtt_cdi::integrate_planck_rosseland(x[i], exp(-x[i]), planck[i], rosseland[i]);
+  auto const t1 = chrono::steady_clock::now();
+  vector<double> planck2(n);
+  vector<double> rosseland2(n);
+  rtt_cdi::integrate_planck_rosseland(n, x.data(), planck2.data(), rosseland2.data());
+  auto const t2 = chrono::steady_clock::now();
+
+  double const scalar = chrono::duration<double>(t1 - t0).count();
+  double const array = chrono::duration<double>(t2 - t1).count();
+  cout << "\nintegrate_planck_rosseland, " << n << " frequencies: scalar " << scalar
+       << " s, array " << array << " s (speedup " << scalar / array << ")\n"
+       << endl;
+
+  uint64_t worst(0);
+  for (size_t i = 0; i < n; ++i)
+    worst = max(worst, max(ulp_distance(planck[i], planck2[i]),
+                           ulp_distance(rosseland[i], rosseland2[i])));
+  FAIL_IF_NOT(worst <= rtt_cdi::planck_array_ulp_tolerance);
+
+  if (ut.numFails == 0)
+    PASSMSG("Array benchmark completed.");
+}
+
+//------------------------------------------------------------------------------------------------//
+int main(int argc, char *argv[]) {
+  rtt_dsxx::ScalarUnitTest ut(argc, argv, rtt_dsxx::release);
+  try {
+    test_scaled_arrays(ut);
+    test_spectrum_array(ut);
+    benchmark_arrays(ut);
+  }
+  UT_EPILOG(ut);
+}
+
+//------------------------------------------------------------------------------------------------//
+// end of tPlanck_Arrays.cc
+//------------------------------------------------------------------------------------------------//
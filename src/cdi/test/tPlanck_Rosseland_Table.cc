@@ -0,0 +1,192 @@
+//--------------------------------------------*-C++-*---------------------------------------------//
+/*!
+ * \file   cdi/test/tPlanck_Rosseland_Table.cc
+ * \author agent
+ * \date   Fri Oct 16 2026
+ * \brief  Tests of the tabulated Planck and Rosseland group integrals.
+ * \note   Copyright (C) 2026 Triad National Security, LLC., All rights reserved. */
+//------------------------------------------------------------------------------------------------//
+
+#include "DummyMultigroupOpacity.hh"
+#include "cdi/CDI.hh"
+#include "cdi/Planck_Rosseland_Table.hh"
+#include "ds++/Release.hh"
+#include "ds++/ScalarUnitTest.hh"
+#include "ds++/Soft_Equivalence.hh"
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+
+using namespace std;
+
+using rtt_cdi::CDI;
+using rtt_cdi::Planck_Rosseland_Table;
+using rtt_dsxx::soft_equiv;
+
+//------------------------------------------------------------------------------------------------//
+// HELPERS
+//------------------------------------------------------------------------------------------------//
+
+//! Logarithmically spaced group boundaries from 0 (if zero_first) or lo to hi keV.
+vector<double> log_bounds(size_t const groups, double const lo, double const hi,
+                          bool const zero_first) {
+  vector<double> bounds(groups + 1);
+  for (size_t g = 0; g <= groups; ++g)
+    bounds[g] = lo * pow(hi / lo, static_cast<double>(g) / static_cast<double>(groups));
+  if (zero_first)
+    bounds[0] = 0.0;
+  return bounds;
+}
+
+//! Largest difference between the table and CDI's exact integrals at temperatures in T.
+double max_error(Planck_Rosseland_Table const &table, vector<double> const &bounds,
+                 vector<double> const &T) {
+  size_t const G = bounds.size() - 1;
+  vector<double> planck(T.size() * G);
+  vector<double> rosseland(T.size() * G);
+  table.integrate(T.size(), T.data(), planck.data(), rosseland.data());
+
+  vector<double> exactP;
+  vector<double> exactR;
+  double error(0.0);
+  for (size_t c = 0; c < T.size(); ++c) {
+    CDI::integrate_Rosseland_Planckian_Spectrum(bounds, T[c], exactP, exactR);
+    for (size_t g = 0; g < G; ++g) {
+      error = max(error, abs(planck[c * G + g] - exactP[g]));
+      error = max(error, abs(rosseland[c * G + g] - exactR[g]));
+    }
+  }
+  return error;
+}
+
+//! Temperatures spread irregularly over [lo, hi].
+vector<double> sample_temperatures(size_t const n, double const lo, double const hi) {
+  vector<double> T(n);
+  for (size_t i = 0; i < n; ++i) {
+    double const f = fmod(0.6180339887498949 * static_cast<double>(i), 1.0);
+    T[i] = lo * pow(hi / lo, f);
+  }
+  return T;
+}
+
+//------------------------------------------------------------------------------------------------//
+// TESTS
+//------------------------------------------------------------------------------------------------//
+
+void test_table_accuracy(rtt_dsxx::UnitTest &ut) {
+  vector<double> const bounds = log_bounds(40, 1.0e-3, 1.0e2, true);
+  for (double const tolerance : {1.0e-6, 1.0e-9}) {
+    Planck_Rosseland_Table const table(bounds, 1.0e-3, 1.0e1, tolerance);
+    FAIL_IF_NOT(table.getNumGroups() == 40);
+    FAIL_IF_NOT(table.getMaxError() <= 0.5 * tolerance);
+
+    double const error = max_error(table, bounds, sample_temperatures(2000, 1.0e-3, 1.0e1));
+    FAIL_IF_NOT(error <= tolerance);
+    cout << "tolerance " << tolerance << ": " << table.getNumTemperatures()
+         << " temperatures, max error " << error << endl;
+  }
+
+  // Tabulated endpoints and temperatures outside the table agree with the exact integrals.
+  Planck_Rosseland_Table const table(bounds, 1.0e-2, 1.0, 1.0e-8);
+  FAIL_IF_NOT(max_error(table, bounds, {1.0e-2, 1.0}) <= 1.0e-12);
+  FAIL_IF_NOT(max_error(table, bounds, {0.0, 1.0e-5, 5.0e-3, 2.0, 1.0e3}) <= 1.0e-15);
+
+  // Either output may be omitted.
+  double const T = 0.3;
+  vector<double> planck(40);
+  vector<double> rosseland(40);
+  vector<double> both(40);
+  table.integrate(T, planck.data(), nullptr);
+  table.integrate(T, nullptr, rosseland.data());
+  table.integrate(T, both.data(), nullptr);
+  FAIL_IF_NOT(soft_equiv(planck.begin(), planck.end(), both.begin(), both.end()));
+
+  if (ut.numFails == 0)
+    PASSMSG("Planck_Rosseland_Table meets its tolerance.");
+}
+
+//------------------------------------------------------------------------------------------------//
+void test_cdi_batch(rtt_dsxx::UnitTest &ut) {
+  // Register a multigroup opacity to set the group structure.
+  CDI cdi;
+  size_t const G = 8;
+  cdi.setMultigroupOpacity(make_shared<rtt_cdi_test::DummyMultigroupOpacity>(
+      rtt_cdi::ABSORPTION, rtt_cdi::ROSSELAND, G + 1));
+  vector<double> const bounds = CDI::getFrequencyGroupBoundaries();
+  FAIL_IF_NOT(bounds.size() == G + 1);
+  FAIL_IF(CDI::getPlanckRosselandTable());
+
+  size_t const numCells = 20000;
+  vector<double> const T = sample_temperatures(numCells, 1.0e-2, 1.0e1);
+  vector<double> exactP(numCells * G);
+  vector<double> exactR(numCells * G);
+  auto const t0 = chrono::steady_clock::now();
+  CDI::integrate_Rosseland_Planckian_Spectrum(numCells, T.data(), exactP.data(), exactR.data());
+  auto const t1 = chrono::steady_clock::now();
+
+  CDI::tabulatePlanckRosseland(1.0e-2, 1.0e1, 1.0e-8);
+  FAIL_IF_NOT(CDI::getPlanckRosselandTable());
+  vector<double> planck(numCells * G);
+  vector<double> rosseland(numCells * G);
+  auto const t2 = chrono::steady_clock::now();
+  CDI::integrate_Rosseland_Planckian_Spectrum(numCells, T.data(), planck.data(), rosseland.data());
+  auto const t3 = chrono::steady_clock::now();
+
+  double error(0.0);
+  for (size_t i = 0; i < numCells * G; ++i)
+    error = max(error, max(abs(planck[i] - exactP[i]), abs(rosseland[i] - exactR[i])));
+  FAIL_IF_NOT(error <= 1.0e-8);
+
+  double const exact = chrono::duration<double>(t1 - t0).count();
+  double const tabulated = chrono::duration<double>(t3 - t2).count();
+  cout << "\n" << numCells << " cells x " << G << " groups: exact " << exact << " s, tabulated "
+       << tabulated << " s, max error " << error << "\n" << endl;
+
+  // reset() discards the table along with the group structure.
+  cdi.reset();
+  FAIL_IF(CDI::getPlanckRosselandTable());
+
+  if (ut.numFails == 0)
+    PASSMSG("Batched CDI integration matches with and without a table.");
+}
+
+//------------------------------------------------------------------------------------------------//
+//! Runs last because CDI::setExtend() cannot be undone.
+void test_extend(rtt_dsxx::UnitTest &ut) {
+  vector<double> const bounds = log_bounds(12, 1.0e-2, 1.0e1, false);
+
+  Planck_Rosseland_Table const plain(bounds, 1.0e-3, 1.0e2, 1.0e-8);
+  CDI::setExtend();
+  Planck_Rosseland_Table const extended(bounds, 1.0e-3, 1.0e2, 1.0e-8);
+
+  vector<double> const T = sample_temperatures(500, 1.0e-3, 1.0e2);
+  FAIL_IF_NOT(max_error(extended, bounds, T) <= 1.0e-8);
+
+  // The extended fractions sum to one; the plain table still omits the tails.
+  vector<double> planck(12);
+  vector<double> rosseland(12);
+  extended.integrate(1.0e-3, planck.data(), rosseland.data());
+  FAIL_IF_NOT(soft_equiv(accumulate(planck.begin(), planck.end(), 0.0), 1.0, 1.0e-8));
+  FAIL_IF_NOT(soft_equiv(accumulate(rosseland.begin(), rosseland.end(), 0.0), 1.0, 1.0e-8));
+  plain.integrate(1.0e-3, planck.data(), rosseland.data());
+  FAIL_IF(accumulate(planck.begin(), planck.end(), 0.0) > 0.5);
+
+  if (ut.numFails == 0)
+    PASSMSG("Extended tables include the spectral tails.");
+}
+
+//------------------------------------------------------------------------------------------------//
+int main(int argc, char *argv[]) {
+  rtt_dsxx::ScalarUnitTest ut(argc, argv, rtt_dsxx::release);
+  try {
+    test_table_accuracy(ut);
+    test_cdi_batch(ut);
+    test_extend(ut);
+  }
+  UT_EPILOG(ut);
+}
+
+//------------------------------------------------------------------------------------------------//
+// end of tPlanck_Rosseland_Table.cc
+//------------------------------------------------------------------------------------------------//
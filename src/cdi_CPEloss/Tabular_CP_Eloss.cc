@@ -10,6 +10,7 @@
 #include "Tabular_CP_Eloss.hh"
 #include "ds++/DracoStrings.hh"
 #include "ds++/Interpolate.hh"
+#include <algorithm>
 #include <utility>
 
 namespace rtt_cdi_cpeloss {
@@ -36,10 +37,14 @@ using std::experimental::layout_left;
  * \param[in] projectile_in transporting particle zaid
  * \param[in] model_angle_cutoff_in rtt_cdi::CPModelAngleCutoff the angle separating the stopping
  *                 power approximation from analog scattering
+ * \param[in] storage where the stopping power table is held; Table_Storage::node_shared keeps one
+ *                 copy per shared-memory node and makes this constructor collective over
+ *                 rtt_c4::communicator
  */
 Tabular_CP_Eloss::Tabular_CP_Eloss(std::string filename_in, rtt_cdi::CParticle target_in,
                                    rtt_cdi::CParticle projectile_in,
-                                   rtt_cdi::CPModelAngleCutoff model_angle_cutoff_in)
+                                   rtt_cdi::CPModelAngleCutoff model_angle_cutoff_in,
+                                   rtt_c4::Table_Storage storage)
     : rtt_cdi::CPEloss(target_in, projectile_in, rtt_cdi::CPModelType::TABULAR_ETYPE,
                        model_angle_cutoff_in),
       filename(std::move(filename_in)) {
@@ -107,7 +112,8 @@ Tabular_CP_Eloss::Tabular_CP_Eloss(std::string filename_in, rtt_cdi::CParticle t
     temperatures[n] = exp(min_log_temperature + n * d_log_temperature);
   }
 
-  stopping_data_1d.resize(n_energy * n_density * n_temperature);
+  // Parsed values are staged on every rank, then copied once per table.
+  std::vector<double> stopping_values(n_energy * n_density * n_temperature);
 
   bool target_found = false;
   nlines = (n_energy * n_density * n_temperature + max_entries - 1) /
@@ -119,7 +125,7 @@ Tabular_CP_Eloss::Tabular_CP_Eloss(std::string filename_in, rtt_cdi::CParticle t
     for (uint32_t n = 0; n < nlines; n++) {
       line_entries = read_line();
       for (std::string const &entry : line_entries) {
-        stopping_data_1d[nentry++] = stod(entry);
+        stopping_values[nentry++] = stod(entry);
       }
     }
   } else {
@@ -138,7 +144,7 @@ Tabular_CP_Eloss::Tabular_CP_Eloss(std::string filename_in, rtt_cdi::CParticle t
         for (uint32_t n = 0; n < nlines; n++) {
           line_entries = read_line();
           for (std::string const &entry : line_entries) {
-            stopping_data_1d[nentry] = stod(entry);
+            stopping_values[nentry] = stod(entry);
             nentry++;
           }
         }
@@ -154,9 +160,13 @@ Tabular_CP_Eloss::Tabular_CP_Eloss(std::string filename_in, rtt_cdi::CParticle t
   Insist(target_found, "Error finding target ZAID \"" + std::to_string(target.get_zaid()) +
                            "\" in DEDX file \"" + filename + "\"");
 
+  stopping_data_1d = rtt_c4::Node_Shared_Table<double>(stopping_values.size(), storage);
+  stopping_data_1d.fill([&stopping_values](double *entries) {
+    std::copy(stopping_values.begin(), stopping_values.end(), entries);
+  });
   stopping_data =
-      basic_mdspan<double, extents<dynamic_extent, dynamic_extent, dynamic_extent>, layout_left>(
-          stopping_data_1d.data(), n_energy, n_density, n_temperature);
+      basic_mdspan<double const, extents<dynamic_extent, dynamic_extent, dynamic_extent>,
+                   layout_left>(stopping_data_1d.data(), n_energy, n_density, n_temperature);
 
   // Convert units on table to match those of getEloss:
   //
@@ -11,6 +11,7 @@
 #ifndef cdi_CPEloss_Tabular_CP_Eloss_hh
 #define cdi_CPEloss_Tabular_CP_Eloss_hh
 
+#include "c4/Node_Shared_Table.hh"
 #include "cdi/CPCommon.hh"
 #include "cdi/CPEloss.hh"
 #include "ds++/Assert.hh"
@@ -69,10 +70,10 @@ private:
   // Note that after unit conversions, *_energy is really *_speed
 
   // Multidimensional view of stored tabulated data
-  stdex::basic_mdspan<double, dynamic_extents_3, std::experimental::layout_left> stopping_data;
+  stdex::basic_mdspan<double const, dynamic_extents_3, stdex::layout_left> stopping_data;
 
-  // Storage for tabulated data
-  std::vector<double> stopping_data_1d;
+  // Storage for tabulated data (optionally one copy per shared-memory node)
+  rtt_c4::Node_Shared_Table<double> stopping_data_1d;
 
   // Utility for skipping lines
   void skip_lines(uint32_t nlines);
@@ -84,7 +85,8 @@ public:
   // Constructor
   Tabular_CP_Eloss(std::string filename_in, rtt_cdi::CParticle target_in,
                    rtt_cdi::CParticle projectile_in,
-                   rtt_cdi::CPModelAngleCutoff model_angle_cutoff_in);
+                   rtt_cdi::CPModelAngleCutoff model_angle_cutoff_in,
+                   rtt_c4::Table_Storage storage = rtt_c4::Table_Storage::heap);
 
   // >>> ACCESSORS
 
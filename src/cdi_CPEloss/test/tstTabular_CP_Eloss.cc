@@ -20,7 +20,7 @@ using rtt_cdi_cpeloss::Tabular_CP_Eloss;
 // TESTS
 //------------------------------------------------------------------------------------------------//
 
-void dedx_table_test(rtt_dsxx::UnitTest &ut) {
+void dedx_table_test(rtt_dsxx::UnitTest &ut, rtt_c4::Table_Storage const storage) {
 
   // Datatable filename
   std::string filename_in = ut.getTestSourcePath() + "001-H-001";
@@ -33,8 +33,9 @@ void dedx_table_test(rtt_dsxx::UnitTest &ut) {
   double proton_mass = 1.6726219e-24;
   rtt_cdi::CParticle projectile_in(proton_zaid, proton_mass);
 
+  // The node_shared policy falls back to the heap in this scalar test; results must not change.
   Tabular_CP_Eloss eloss_mod(filename_in, target_in, projectile_in,
-                             rtt_cdi::CPModelAngleCutoff::NONE);
+                             rtt_cdi::CPModelAngleCutoff::NONE, storage);
 
   // Model type better be tabular:
   FAIL_IF_NOT(eloss_mod.getModelType() == rtt_cdi::CPModelType::TABULAR_ETYPE);
@@ -94,7 +95,8 @@ void dedx_table_test(rtt_dsxx::UnitTest &ut) {
 int main(int argc, char *argv[]) {
   rtt_dsxx::ScalarUnitTest ut(argc, argv, rtt_dsxx::release);
   try {
-    dedx_table_test(ut);
+    dedx_table_test(ut, rtt_c4::Table_Storage::heap);
+    dedx_table_test(ut, rtt_c4::Table_Storage::node_shared);
   }
   UT_EPILOG(ut);
 }
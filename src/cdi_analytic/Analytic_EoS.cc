@@ -489,6 +489,50 @@ double Analytic_EoS::getIonTemperature(double rho, double Uic, double Tguess) co
   return T_new;
 }
 
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Return the electron temperatures of n cells given their densities and specific electron
+ *        energies.
+ *
+ * The analytic model solves all cells together where it can (see
+ * Analytic_EoS_Model::calculate_elec_temperature).
+ *
+ * \param n number of cells
+ * \param rho densities in g/cm^3 (size n)
+ * \param Ue specific electron energies in kJ/g (size n)
+ * \param Tguess electron temperature guesses in keV (size n) or nullptr
+ * \param T electron temperatures in keV (size n)
+ */
+void Analytic_EoS::getElectronTemperature(size_t n, double const *rho, double const *Ue,
+                                          double const *Tguess, double *T) const {
+  Require(n == 0 || (rho != nullptr && Ue != nullptr && T != nullptr));
+
+  analytic_model->calculate_elec_temperature(n, rho, Ue, Tguess, T, nullptr);
+
+  for (size_t i = 0; i < n; ++i)
+    Check(T[i] >= 0.0);
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Return the ion temperatures of n cells given their densities and specific ion energies.
+ *
+ * \param n number of cells
+ * \param rho densities in g/cm^3 (size n)
+ * \param Uic specific ion energies plus cold curve energy densities in kJ/g (size n)
+ * \param Tguess ion temperature guesses in keV (size n) or nullptr
+ * \param T ion temperatures in keV (size n)
+ */
+void Analytic_EoS::getIonTemperature(size_t n, double const *rho, double const *Uic,
+                                     double const *Tguess, double *T) const {
+  Require(n == 0 || (rho != nullptr && Uic != nullptr && T != nullptr));
+
+  analytic_model->calculate_ion_temperature(n, rho, Uic, Tguess, T, nullptr);
+
+  for (size_t i = 0; i < n; ++i)
+    Check(T[i] >= 0.0);
+}
+
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Pack an analytic EoS opacity.
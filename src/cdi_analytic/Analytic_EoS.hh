@@ -93,6 +93,16 @@ public:
   // Get the new Ti, given delta Uic, Ti0.
   double getIonTemperature(double /*rho*/, double Uic, double Tguess = 1.0) const override;
 
+  // >>> BATCHED INTERFACE
+
+  // Get the new Te of n cells, given Ue and optional guesses.
+  void getElectronTemperature(size_t n, double const *rho, double const *Ue, double const *Tguess,
+                              double *T) const;
+
+  // Get the new Ti of n cells, given Uic and optional guesses.
+  void getIonTemperature(size_t n, double const *rho, double const *Uic, double const *Tguess,
+                         double *T) const;
+
   // Pack the Analytic_EoS into a character string.
   sf_char pack() const override;
 };
@@ -11,13 +11,139 @@
 #include "ds++/Packing_Utils.hh"
 #include "roots/zbrac.hh"
 #include "roots/zbrent.hh"
+#include <algorithm>
+#include <limits>
 
 namespace rtt_cdi_analytic {
 
+namespace {
+
+//! Newton sweeps allowed before the remaining cells are handed to the scalar root finder.
+unsigned constexpr max_newton_iterations = 50;
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Solve \f$ a T + \frac{b}{c+1} T^{c+1} = U \f$ for the temperatures of n cells at once.
+ *
+ * For a, b >= 0 the energy is increasing and convex in T, and either term alone bounds the root
+ * from above, \f$ T \le \min(U/a, ((c+1)U/b)^{1/(c+1)}) \f$.  Each cell keeps a bracket that starts
+ * as [0, bound] and shrinks with the sign of every residual.  Newton steps use the analytic
+ * \f$ C_v = a + bT^c \f$; a step past the upper end of the bracket is replaced by that end, and one
+ * below the lower end, or not a number, by bisection.
+ * All unconverged cells advance together, one sweep per iteration, so the inner loop has no
+ * data-dependent control flow.
+ *
+ * Cells with U <= 0 get T = 0.  A cell is converged once its Newton step is below 4 epsilon
+ * relative to T; cells that are not (all of them if a or b is negative, or if a = b = 0) are left
+ * for the caller.
+ *
+ * \param[in]  Tguess     Starting temperatures or nullptr; guesses outside (0, bound) are ignored.
+ * \param[out] T          Temperatures (keV).
+ * \param[out] iterations Newton sweeps spent on each cell.
+ * \param[out] converged  Nonzero for cells that converged.
+ */
+void newton_polynomial_temperature(double const a, double const b, double const c, size_t const n,
+                                   double const *const U, double const *const Tguess,
+                                   double *const T, unsigned *const iterations,
+                                   char *const converged) {
+  double const huge = std::numeric_limits<double>::max();
+  double const tolerance = 4.0 * std::numeric_limits<double>::epsilon();
+  double const inv_c1 = 1.0 / (c + 1.0);
+
+  std::vector<double> lo(n, 0.0);
+  std::vector<double> hi(n);
+  std::vector<char> active(n);
+  bool const monotone = a >= 0.0 && b >= 0.0;
+  size_t remaining(0);
+  for (size_t i = 0; i < n; ++i) {
+    double const bound = std::min(a > 0.0 ? U[i] / a : huge,
+                                  b > 0.0 ? std::pow((c + 1.0) * U[i] / b, inv_c1) : huge);
+    double const guess = Tguess ? Tguess[i] : 0.0;
+    hi[i] = bound;
+    T[i] = U[i] > 0.0 ? (guess > 0.0 && guess < bound ? guess : bound) : 0.0;
+    iterations[i] = 0;
+    converged[i] = !(U[i] > 0.0);
+    active[i] = monotone && U[i] > 0.0 && bound < huge;
+    remaining += active[i] ? 1 : 0;
+  }
+
+  for (unsigned iteration = 0; iteration < max_newton_iterations && remaining > 0; ++iteration) {
+    remaining = 0;
+#ifdef OPENMP_FOUND
+#pragma omp simd reduction(+ : remaining)
+#endif
+    for (size_t i = 0; i < n; ++i) {
+      if (active[i]) {
+        double const Ti = T[i];
+        double const Ti_c = std::pow(Ti, c);
+        double const residual = a * Ti + b * Ti_c * Ti * inv_c1 - U[i];
+        double const Cv = a + b * Ti_c;
+        lo[i] = residual > 0.0 ? lo[i] : Ti;
+        hi[i] = residual > 0.0 ? Ti : hi[i];
+        double const newton = Ti - residual / Cv;
+        // Convexity keeps Newton iterates from above on that side of the root, so a step that
+        // overshoots from below is pulled back to the upper bracket rather than bisected.
+        double const Tn = newton >= lo[i] && newton <= hi[i]
+                              ? newton
+                              : (newton > hi[i] ? hi[i] : 0.5 * (lo[i] + hi[i]));
+        bool const done = std::abs(Tn - Ti) <= tolerance * Tn;
+        T[i] = Tn;
+        iterations[i] += 1;
+        converged[i] = done;
+        active[i] = !done;
+        remaining += done ? 0 : 1;
+      }
+    }
+  }
+}
+
+} // namespace
+
 //================================================================================================//
 // EOS_ANALYTIC_MODEL MEMBER DEFINITIONS
 //================================================================================================//
 
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \param[in]  n          Number of cells.
+ * \param[in]  rho        Densities (g/cm^3, size n).
+ * \param[in]  Ue         Electron internal energies (kJ/g, size n).
+ * \param[in]  Tguess     Starting temperatures (keV, size n) or nullptr for 1 keV.
+ * \param[out] T          Electron temperatures (keV, size n).
+ * \param[out] iterations Zero for every cell, if not null.
+ */
+size_t Analytic_EoS_Model::calculate_elec_temperature(size_t const n, double const *const rho,
+                                                      double const *const Ue,
+                                                      double const *const Tguess, double *const T,
+                                                      unsigned *const iterations) const {
+  Require(n == 0 || (rho != nullptr && Ue != nullptr && T != nullptr));
+  for (size_t i = 0; i < n; ++i) {
+    T[i] = calculate_elec_temperature(rho[i], Ue[i], Tguess ? Tguess[i] : 1.0);
+    if (iterations)
+      iterations[i] = 0;
+  }
+  return n;
+}
+
+//------------------------------------------------------------------------------------------------//
+//! Calculate the ion temperatures of n cells with the scalar calculate_ion_temperature().
+size_t Analytic_EoS_Model::calculate_ion_temperature(size_t const n, double const *const rho,
+                                                     double const *const Uic,
+                                                     double const *const Tguess, double *const T,
+                                                     unsigned *const iterations) const {
+  Require(n == 0 || (rho != nullptr && Uic != nullptr && T != nullptr));
+  for (size_t i = 0; i < n; ++i) {
+    T[i] = calculate_ion_temperature(rho[i], Uic[i], Tguess ? Tguess[i] : 1.0);
+    if (iterations)
+      iterations[i] = 0;
+  }
+  return n;
+}
+
+//================================================================================================//
+// POLYNOMIAL_SPECIFIC_HEAT_ANALYTIC_EOS_MODEL MEMBER DEFINITIONS
+//================================================================================================//
+
 /*!
  * \brief Calculate the electron temperature given density and Electron internal energy
  *
@@ -101,6 +227,74 @@ double Polynomial_Specific_Heat_Analytic_EoS_Model::calculate_ion_temperature(
   }
 }
 
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Calculate the electron temperatures of n cells given their electron internal energies.
+ *
+ * All cells are solved together by safeguarded Newton iteration (see
+ * newton_polynomial_temperature); the few that do not converge are solved by the scalar
+ * calculate_elec_temperature().
+ *
+ * \param[in]  n          Number of cells.
+ * \param[in]  rho        Densities (unused, may be null).
+ * \param[in]  Ue         Electron internal energies (kJ/g, size n).
+ * \param[in]  Te0        Starting temperatures (keV, size n) or nullptr.
+ * \param[out] Te         Electron temperatures (keV, size n).
+ * \param[out] iterations Newton iterations spent on each cell, if not null.
+ * \return The number of cells that were solved by the scalar root finder.
+ */
+size_t Polynomial_Specific_Heat_Analytic_EoS_Model::calculate_elec_temperature(
+    size_t const n, double const *const rho, double const *const Ue, double const *const Te0,
+    double *const Te, unsigned *const iterations) const {
+  Require(n == 0 || (Ue != nullptr && Te != nullptr));
+
+  std::vector<unsigned> count(n);
+  std::vector<char> converged(n);
+  newton_polynomial_temperature(a, b, c, n, Ue, Te0, Te, count.data(), converged.data());
+
+  size_t fallbacks(0);
+  for (size_t i = 0; i < n; ++i) {
+    if (!converged[i]) {
+      // Start from the last iterate, which is positive, rather than a guess that may be zero.
+      double const guess = Te[i] > 0.0 ? Te[i] : (Te0 ? Te0[i] : 1.0);
+      Te[i] = calculate_elec_temperature(rho ? rho[i] : 0.0, Ue[i], guess);
+      ++fallbacks;
+    }
+  }
+  if (iterations)
+    std::copy(count.begin(), count.end(), iterations);
+  return fallbacks;
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Calculate the ion temperatures of n cells given their ion internal energies.
+ *
+ * See the batched calculate_elec_temperature().
+ */
+size_t Polynomial_Specific_Heat_Analytic_EoS_Model::calculate_ion_temperature(
+    size_t const n, double const *const rho, double const *const Uic, double const *const Ti0,
+    double *const Ti, unsigned *const iterations) const {
+  Require(n == 0 || (Uic != nullptr && Ti != nullptr));
+
+  std::vector<unsigned> count(n);
+  std::vector<char> converged(n);
+  newton_polynomial_temperature(d, e, f, n, Uic, Ti0, Ti, count.data(), converged.data());
+
+  size_t fallbacks(0);
+  for (size_t i = 0; i < n; ++i) {
+    if (!converged[i]) {
+      // Start from the last iterate, which is positive, rather than a guess that may be zero.
+      double const guess = Ti[i] > 0.0 ? Ti[i] : (Ti0 ? Ti0[i] : 1.0);
+      Ti[i] = calculate_ion_temperature(rho ? rho[i] : 0.0, Uic[i], guess);
+      ++fallbacks;
+    }
+  }
+  if (iterations)
+    std::copy(count.begin(), count.end(), iterations);
+  return fallbacks;
+}
+
 //================================================================================================//
 // CONSTANT_ANALYTIC_MODEL MEMBER DEFINITIONS
 //================================================================================================//
@@ -348,6 +348,24 @@ public:
    *         temperature. */
   virtual double calculate_ion_temperature(double rho, double Uic, double Tguess) const = 0;
 
+  /*!
+   * \brief Calculate the electron temperatures of n cells given their densities, electron internal
+   *        energies and optional starting temperatures (Tguess may be null).
+   *
+   * The default calls the scalar calculate_elec_temperature() for each cell.  If iterations is not
+   * null it receives the number of batched iterations spent on each cell.
+   *
+   * \return The number of cells that were solved by the scalar root finder.
+   */
+  virtual size_t calculate_elec_temperature(size_t n, double const *rho, double const *Ue,
+                                            double const *Tguess, double *T,
+                                            unsigned *iterations) const;
+
+  //! Calculate the ion temperatures of n cells (see the batched calculate_elec_temperature()).
+  virtual size_t calculate_ion_temperature(size_t n, double const *rho, double const *Uic,
+                                           double const *Tguess, double *T,
+                                           unsigned *iterations) const;
+
   //! Return the model parameters.
   virtual sf_double get_parameters() const = 0;
 
@@ -500,6 +518,17 @@ public:
    *        temperature. */
   double calculate_ion_temperature(double const /*rho*/, double const Uic,
                                    double const Ti0) const override;
+
+  //! Calculate the electron temperatures of n cells by batched Newton iteration.
+  size_t calculate_elec_temperature(size_t n, double const *rho, double const *Ue,
+                                    double const *Te0, double *Te,
+                                    unsigned *iterations) const override;
+
+  //! Calculate the ion temperatures of n cells by batched Newton iteration.
+  size_t calculate_ion_temperature(size_t n, double const *rho, double const *Uic,
+                                   double const *Ti0, double *Ti,
+                                   unsigned *iterations) const override;
+
   //! Return the model parameters.
   sf_double get_parameters() const override;
 
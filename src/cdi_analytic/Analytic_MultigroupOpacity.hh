@@ -69,6 +69,9 @@ protected:
   // Get the packed size of the object
   unsigned packed_size() const;
 
+  // Group boundaries without the copy made by getGroupBoundaries().
+  sf_double const &group_bounds() const { return group_boundaries; }
+
 public:
   // >>> ACCESSORS
 
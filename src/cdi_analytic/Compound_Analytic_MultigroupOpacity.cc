@@ -9,6 +9,8 @@
 #include "Compound_Analytic_MultigroupOpacity.hh"
 #include "ds++/Packing_Utils.hh"
 #include "ds++/dbc.hh"
+#include <cmath>
+#include <typeinfo>
 
 namespace rtt_cdi_analytic {
 
@@ -42,6 +44,8 @@ Compound_Analytic_MultigroupOpacity::Compound_Analytic_MultigroupOpacity(
   Require(groups.size() - 1 == models.size());
   Require(rtt_dsxx::is_strict_monotonic_increasing(groups.begin(), groups.end()));
 
+  compile_plan();
+
   Ensure(check_class_invariant());
 }
 
@@ -57,7 +61,7 @@ Compound_Analytic_MultigroupOpacity::Compound_Analytic_MultigroupOpacity(
 Compound_Analytic_MultigroupOpacity::Compound_Analytic_MultigroupOpacity(const sf_char &packed)
     : Analytic_MultigroupOpacity(packed), group_models() {
   // get the number of group boundaries
-  size_t const num_groups = getGroupBoundaries().size() - 1;
+  size_t const num_groups = group_bounds().size() - 1;
   unsigned const base_size = Analytic_MultigroupOpacity::packed_size();
 
   // make an unpacker
@@ -105,11 +109,130 @@ Compound_Analytic_MultigroupOpacity::Compound_Analytic_MultigroupOpacity(const s
     Ensure(group_models[i]);
   }
 
+  compile_plan();
+
   Ensure(check_class_invariant());
 }
 //------------------------------------------------------------------------------------------------//
 bool Compound_Analytic_MultigroupOpacity::check_class_invariant() const {
-  return group_models.size() + 1 == getGroupBoundaries().size();
+  return group_models.size() + 1 == group_bounds().size() &&
+         plan.size() == 5 * group_models.size();
+}
+
+//------------------------------------------------------------------------------------------------//
+// COMPILED EVALUATION PLAN
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Flatten the group models into contiguous coefficient arrays.
+ *
+ * Constant_Analytic_Opacity_Model and Polynomial_Analytic_Opacity_Model are reduced to
+ *
+ * \f[
+ *   \sigma_g = a_g + (T/f_g)^{c_g} (\rho/g_g)^{d_g} S_g(T) K_g,
+ * \f]
+ *
+ * where \f$ K_g = (\nu_g/h)^e (b + j H(\nu_g - k)) \f$ depends only on the group's evaluation
+ * frequency \f$ \nu_g = \sqrt{\nu_0 \nu_1} \f$ (the frequency Polynomial_Analytic_Opacity_Model
+ * uses for a group) and \f$ S_g \f$ is the stimulated emission factor.  Groups usually share their
+ * temperature and density powers, so the distinct (c, f, d, g) tuples are stored once and their
+ * power laws are evaluated once per cell.  Any other model type, including classes derived from
+ * these two, is left to its virtual interface.
+ */
+void Compound_Analytic_MultigroupOpacity::compile_plan() {
+  size_t const numGroups = group_models.size();
+  sf_double const &nu = group_bounds();
+  Check(nu.size() == numGroups + 1);
+
+  plan.assign(5 * numGroups, 0.0);
+  plan_powers.clear();
+  virtual_groups.clear();
+  virtual_bounds.clear();
+  plan_needs_positive_T = false;
+
+  double *const a = plan.data();
+  double *const K = a + numGroups;
+  double *const nu_g = K + numGroups;
+  double *const stim = nu_g + numGroups;
+  double *const power_index = stim + numGroups;
+
+  for (size_t i = 0; i < numGroups; ++i) {
+    Check(group_models[i]);
+    Analytic_Opacity_Model const &group_model = *group_models[i];
+
+    // (c, f, d, g) = (0, 1, 0, 1) makes the power-law factor one.
+    sf_double powers = {0.0, 1.0, 0.0, 1.0};
+    if (typeid(group_model) == typeid(Constant_Analytic_Opacity_Model)) {
+      a[i] = group_model.get_parameters()[0];
+    } else if (typeid(group_model) == typeid(Polynomial_Analytic_Opacity_Model)) {
+      // a, b, c, d, e, f, g, h, i, j, k
+      sf_double const p = group_model.get_parameters();
+      Check(p.size() == 11);
+      Require(p[5] > 0.0 && p[6] > 0.0 && p[7] > 0.0);
+      double const nu_i = std::sqrt(nu[i] * nu[i + 1]);
+      a[i] = p[0];
+      K[i] = std::pow(nu_i / p[7], p[4]) * (p[1] + (nu_i >= p[10] ? p[9] : 0.0));
+      nu_g[i] = nu_i;
+      stim[i] = p[8] > 0.0 ? 1.0 : 0.0;
+      powers = {p[2], p[5], p[3], p[6]};
+      plan_needs_positive_T = plan_needs_positive_T || p[2] < 0.0 || p[8] > 0.0;
+    } else {
+      virtual_groups.push_back(i);
+      virtual_bounds.push_back(nu[i]);
+      virtual_bounds.push_back(nu[i + 1]);
+    }
+
+    // Reuse an identical tuple if there is one.
+    size_t t = 0;
+    size_t const numTuples = plan_powers.size() / 4;
+    while (t < numTuples && !std::equal(powers.begin(), powers.end(), &plan_powers[4 * t]))
+      ++t;
+    if (t == numTuples)
+      plan_powers.insert(plan_powers.end(), powers.begin(), powers.end());
+    power_index[i] = static_cast<double>(t);
+  }
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Evaluate the group opacities of one cell from the compiled plan.
+ *
+ * \param[in]  temperature   cell temperature in keV
+ * \param[in]  density       cell density in g/cm^3
+ * \param[out] power_factors scratch space for plan_powers.size()/4 values
+ * \param[out] opacity       group opacities in cm^2/g (size num_groups)
+ */
+void Compound_Analytic_MultigroupOpacity::evaluate_plan(double const temperature,
+                                                        double const density,
+                                                        double *const power_factors,
+                                                        double *const opacity) const {
+  Require(plan_needs_positive_T ? temperature > 0.0 : temperature >= 0.0);
+  Require(density >= 0.0);
+
+  size_t const numGroups = group_models.size();
+  size_t const numTuples = plan_powers.size() / 4;
+  for (size_t t = 0; t < numTuples; ++t) {
+    double const *const p = &plan_powers[4 * t];
+    power_factors[t] = std::pow(temperature / p[1], p[0]) * std::pow(density / p[3], p[2]);
+  }
+
+  double const *const a = plan.data();
+  double const *const K = a + numGroups;
+  double const *const nu = K + numGroups;
+  double const *const stim = nu + numGroups;
+  double const *const power_index = stim + numGroups;
+#ifdef OPENMP_FOUND
+#pragma omp simd
+#endif
+  for (size_t i = 0; i < numGroups; ++i) {
+    double const S = stim[i] > 0.0 ? 1.0 - std::exp(-nu[i] / temperature) : 1.0;
+    opacity[i] = a[i] + power_factors[static_cast<size_t>(power_index[i])] * S * K[i];
+  }
+
+  for (size_t v = 0; v < virtual_groups.size(); ++v) {
+    size_t const i = virtual_groups[v];
+    opacity[i] = group_models[i]->calculate_opacity(temperature, density, virtual_bounds[2 * v],
+                                                    virtual_bounds[2 * v + 1]);
+  }
 }
 
 //------------------------------------------------------------------------------------------------//
@@ -135,19 +258,11 @@ Compound_Analytic_MultigroupOpacity::getOpacity(double temperature, double densi
 
   // return opacities
   sf_double opacities(group_models.size(), 0.0);
+  sf_double power_factors(plan_powers.size() / 4);
+  evaluate_plan(temperature, density, power_factors.data(), opacities.data());
 
-  // loop through groups and get opacities
-  auto nu = getGroupBoundaries();
-  Check(nu.size() == group_models.size() + 1);
-
-  for (size_t i = 0; i < opacities.size(); ++i) {
-    Check(group_models[i]);
-
-    // assign the opacity based on the group model
-    opacities[i] = group_models[i]->calculate_opacity(temperature, density, nu[i], nu[i + 1]);
-
+  for (size_t i = 0; i < opacities.size(); ++i)
     Check(opacities[i] >= 0.0);
-  }
 
   return opacities;
 }
@@ -248,6 +363,34 @@ Compound_Analytic_MultigroupOpacity::getOpacity(double temperature,
   return opacities;
 }
 
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Fill a caller-owned buffer with the group opacities of a batch of cells.
+ *
+ * Returns the same values as getOpacity(temperature[c], density[c]) for each cell c, written to
+ * opacity[c * number of groups + g], without allocating a vector per cell.  Each cell evaluates its
+ * distinct power laws once and then all groups in one loop over the compiled plan.
+ *
+ * \param numCells number of cells
+ * \param temperature cell temperatures in keV [numCells]
+ * \param density cell densities in g/cm^3 [numCells]
+ * \param opacity caller-owned buffer for the group opacities in cm^2/g, indexed [cell][group]
+ */
+void Compound_Analytic_MultigroupOpacity::getOpacityBatch(size_t numCells,
+                                                          double const *temperature,
+                                                          double const *density,
+                                                          double *opacity) const {
+  size_t const numGroups = group_models.size();
+  sf_double power_factors(plan_powers.size() / 4);
+
+  for (size_t c = 0; c < numCells; ++c) {
+    double *const cell_opacity = opacity + c * numGroups;
+    evaluate_plan(temperature[c], density[c], power_factors.data(), cell_opacity);
+    for (size_t i = 0; i < numGroups; ++i)
+      Check(cell_opacity[i] >= 0.0);
+  }
+}
+
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Pack an analytic multigroup opacity.
@@ -78,6 +78,34 @@ private:
   // Analytic models for each group.
   sf_Analytic_Model group_models;
 
+  // >>> COMPILED EVALUATION PLAN (see compile_plan())
+
+  /*!
+   * Per-group coefficients, stored as five contiguous blocks of length num_groups: the constant a,
+   * the frequency factor (nu/h)^e (b + j H(nu - k)), the evaluation frequency nu, 1 if stimulated
+   * emission is on (else 0), and the index of the group's (c, f, d, g) tuple in plan_powers.
+   */
+  sf_double plan;
+
+  //! Unique (c, f, d, g) temperature and density power-law tuples, four entries each.
+  sf_double plan_powers;
+
+  //! Groups whose models are not built in; they are evaluated through their virtual interface.
+  std::vector<size_t> virtual_groups;
+
+  //! Lower and upper boundaries of each of the virtual_groups.
+  sf_double virtual_bounds;
+
+  //! True if some compiled group needs T > 0 (negative temperature power or stimulated emission).
+  bool plan_needs_positive_T = false;
+
+  // Flatten the group models into the plan.
+  void compile_plan();
+
+  // Evaluate the plan for one cell.
+  void evaluate_plan(double temperature, double density, double *power_factors,
+                     double *opacity) const;
+
 public:
   // Constructor.
   Compound_Analytic_MultigroupOpacity(const sf_double &groups, const sf_Analytic_Model &models,
@@ -104,6 +132,10 @@ public:
   // Get the group opacity fields given a field of densities.
   vf_double getOpacity(double temperature, const sf_double &density) const override;
 
+  // Fill a caller-owned (cell x group) buffer with the group opacities of each cell.
+  void getOpacityBatch(size_t numCells, double const *temperature, double const *density,
+                       double *opacity) const override;
+
   // Get the data description of the opacity.
   inline std_string getDataDescriptor() const override;
 
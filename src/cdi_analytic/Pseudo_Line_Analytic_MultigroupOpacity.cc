@@ -10,6 +10,7 @@
 #include "cdi/CDI.hh"
 #include "ds++/DracoMath.hh"
 #include "ds++/Packing_Utils.hh"
+#include "ds++/Soft_Equivalence.hh"
 #include "ode/quad.hh"
 #include "ode/rkqs.hh"
 
@@ -89,7 +90,58 @@ Pseudo_Line_Analytic_MultigroupOpacity::Pseudo_Line_Analytic_MultigroupOpacity(
     : Analytic_MultigroupOpacity(group_bounds_in, reaction_in),
       Pseudo_Line_Base(continuum, number_of_lines, line_peak, line_width, number_of_edges,
                        edge_ratio, Tref, Tpow, emin, emax, seed_in),
-      averaging_(averaging), qpoints_(qpoints) {}
+      averaging_(averaging), qpoints_(qpoints) {
+  compile_plan_();
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Precompute the group opacities when their temperature dependence factors out.
+ *
+ * The monochromatic opacity is baseOpacity(nu) * temperatureFactor(T).  Evaluation at the group
+ * center and the fixed-point averages (qpoints > 0) use one spectral weight for every point of a
+ * group, so the weight cancels and the group opacity is temperatureFactor(T) times a constant:
+ * the base opacity at the group center, the mean of the base opacities, or the harmonic mean of
+ * the base opacities.  Adaptive quadrature weights the spectrum by the Planckian, and the fuzz
+ * model draws a new random opacity on every call, so neither gets a plan.
+ */
+void Pseudo_Line_Analytic_MultigroupOpacity::compile_plan_() {
+  group_base_.clear();
+  if (!deterministic() || (averaging_ != NONE && qpoints_ == 0))
+    return;
+
+  sf_double const &group_bounds = this->getGroupBoundaries();
+  size_t const number_of_groups = group_bounds.size() - 1;
+  group_base_.resize(number_of_groups);
+
+  double g1 = group_bounds[0];
+  for (size_t g = 0; g < number_of_groups; ++g) {
+    double const g0 = g1;
+    g1 = group_bounds[g + 1];
+    switch (averaging_) {
+    case NONE:
+      group_base_[g] = baseOpacity(0.5 * (g0 + g1));
+      break;
+
+    case ROSSELAND: {
+      double t = 0.0;
+      for (unsigned ig = 0; ig < qpoints_; ++ig)
+        t += 1.0 / baseOpacity((ig + 0.5) * (g1 - g0) / qpoints_ + g0);
+      group_base_[g] = qpoints_ / t;
+    } break;
+
+    case PLANCK: {
+      double t = 0.0;
+      for (unsigned ig = 0; ig < qpoints_; ++ig)
+        t += baseOpacity((ig + 0.5) * (g1 - g0) / qpoints_ + g0);
+      group_base_[g] = t / qpoints_;
+    } break;
+
+    default:
+      Insist(false, "bad case");
+    }
+  }
+}
 
 //------------------------------------------------------------------------------------------------//
 //! Packing function
@@ -101,7 +153,42 @@ Analytic_MultigroupOpacity::sf_char Pseudo_Line_Analytic_MultigroupOpacity::pack
 }
 
 //------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Get the group opacities.
+ *
+ * Uses the precomputed group opacities when there are any.  Otherwise the opacities come from
+ * integrate_opacity_(); for adaptive quadrature the last temperature and its opacities are kept,
+ * since a caller commonly asks for the same temperature several times per cycle.
+ */
 sf_double Pseudo_Line_Analytic_MultigroupOpacity::getOpacity(double T, double /*rho*/) const {
+  if (!group_base_.empty()) {
+    double const factor = temperatureFactor(T);
+    sf_double Result(group_base_);
+    for (double &r : Result)
+      r *= factor;
+    return Result;
+  }
+
+  if (!deterministic())
+    return integrate_opacity_(T);
+
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    // exact match only (a NaN temperature never matches)
+    if (has_cache_ && soft_equiv(T, cached_T_, 0.0))
+      return cached_opacity_;
+  }
+  sf_double Result = integrate_opacity_(T);
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  cached_T_ = T;
+  cached_opacity_ = Result;
+  has_cache_ = true;
+  return Result;
+}
+
+//------------------------------------------------------------------------------------------------//
+//! Compute the group opacities at T by averaging the monochromatic opacity over each group.
+sf_double Pseudo_Line_Analytic_MultigroupOpacity::integrate_opacity_(double T) const {
   sf_double const &group_bounds = this->getGroupBoundaries();
   size_t const number_of_groups = group_bounds.size() - 1;
   sf_double Result(number_of_groups, 0.0);
@@ -216,6 +303,36 @@ vf_double Pseudo_Line_Analytic_MultigroupOpacity::getOpacity(double const T,
   return {rho.size(), getOpacity(T, rho[0])};
 }
 
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Fill a caller-owned (cell x group) buffer with the group opacities of each cell.
+ *
+ * With precomputed group opacities each cell is a single scaling of group_base_; otherwise this
+ * falls back on getOpacity(T, rho) cell by cell.
+ */
+void Pseudo_Line_Analytic_MultigroupOpacity::getOpacityBatch(size_t numCells,
+                                                             double const *targetTemperature,
+                                                             double const *targetDensity,
+                                                             double *opacity) const {
+  if (group_base_.empty()) {
+    Analytic_MultigroupOpacity::getOpacityBatch(numCells, targetTemperature, targetDensity,
+                                                opacity);
+    return;
+  }
+
+  size_t const numGroups = group_base_.size();
+  double const *const base = group_base_.data();
+  for (size_t c = 0; c < numCells; ++c) {
+    double const factor = temperatureFactor(targetTemperature[c]);
+    double *const cell_opacity = opacity + c * numGroups;
+#ifdef OPENMP_FOUND
+#pragma omp simd
+#endif
+    for (size_t g = 0; g < numGroups; ++g)
+      cell_opacity[g] = factor * base[g];
+  }
+}
+
 //------------------------------------------------------------------------------------------------//
 std::string Pseudo_Line_Analytic_MultigroupOpacity::getDataDescriptor() const {
   std::string descriptor;
@@ -11,6 +11,7 @@
 
 #include "Analytic_MultigroupOpacity.hh"
 #include "Pseudo_Line_Base.hh"
+#include <mutex>
 
 namespace rtt_cdi_analytic {
 using rtt_parser::Expression;
@@ -34,6 +35,25 @@ private:
   //! value of 0 indicates to use adaptive Romberg integration
   unsigned qpoints_;
 
+  /*!
+   * Group opacities at T = Tref when they can be computed once at construction (see
+   * compile_plan_()); the opacity at T is then temperatureFactor(T) times this.  Empty for adaptive
+   * quadrature and for the fuzz model.
+   */
+  sf_double group_base_;
+
+  //! Guards the adaptive-quadrature cache below.
+  mutable std::mutex cache_mutex_;
+  //! True once cached_T_ and cached_opacity_ hold an adaptive-quadrature evaluation.
+  mutable bool has_cache_ = false;
+  //! Temperature of the last adaptive-quadrature evaluation.
+  mutable double cached_T_ = 0.0;
+  //! Group opacities from the last adaptive-quadrature evaluation.
+  mutable sf_double cached_opacity_;
+
+  void compile_plan_();
+  sf_double integrate_opacity_(double T) const;
+
   friend class PLR_Functor; //!< used in calculation of Rosseland averages
   friend class PLP_Functor; //!< used in calculation of Planck averages
 
@@ -58,6 +78,10 @@ public:
   //! Get the group opacity fields given a field of densities.
   vf_double getOpacity(double targetTemperature, const sf_double &targetDensity) const override;
 
+  //! Fill a caller-owned (cell x group) buffer with the group opacities of each cell.
+  void getOpacityBatch(size_t numCells, double const *targetTemperature,
+                       double const *targetDensity, double *opacity) const override;
+
   //! Get the data description of the opacity.
   std::string getDataDescriptor() const override;
 
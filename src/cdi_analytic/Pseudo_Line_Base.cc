@@ -197,7 +197,7 @@ vector<char> Pseudo_Line_Base::pack() const {
 }
 
 //------------------------------------------------------------------------------------------------//
-double Pseudo_Line_Base::monoOpacity(double const x, double const T) const {
+double Pseudo_Line_Base::baseOpacity(double const x) const {
 
   int const number_of_lines = number_of_lines_;
   double const width = line_width_;
@@ -236,10 +236,6 @@ double Pseudo_Line_Base::monoOpacity(double const x, double const T) const {
       Result += edge_factor_[i] * cube(nu0 / x);
     }
   }
-  // if the power is ~0, then pow(a,0) == 1.0.
-  if (!rtt_dsxx::soft_equiv(Tpow_, 0.0, std::numeric_limits<double>::epsilon())) {
-    Result *= pow(T / Tref_, Tpow_);
-  }
   return Result;
 }
 
@@ -9,8 +9,11 @@
 #ifndef rtt_cdi_analytic_Pseudo_Line_Base_hh
 #define rtt_cdi_analytic_Pseudo_Line_Base_hh
 
+#include "ds++/Soft_Equivalence.hh"
 #include "parser/Expression.hh"
+#include <cmath>
 #include <cstdio>
+#include <limits>
 
 namespace rtt_cdi_analytic {
 using rtt_parser::Expression;
@@ -111,7 +114,23 @@ public:
   vector<char> pack() const;
 
   //! Compute a monochromatic opacity
-  double monoOpacity(double nu, double T) const;
+  double monoOpacity(double nu, double T) const {
+    return baseOpacity(nu) * temperatureFactor(T);
+  }
+
+  //! The temperature-independent part of monoOpacity (random for the fuzz model).
+  double baseOpacity(double nu) const;
+
+  //! The temperature dependence of monoOpacity, \f$ (T/T_{ref})^{T_{pow}} \f$.
+  double temperatureFactor(double T) const {
+    // if the power is ~0, then pow(a,0) == 1.0.
+    if (rtt_dsxx::soft_equiv(Tpow_, 0.0, std::numeric_limits<double>::epsilon()))
+      return 1.0;
+    return std::pow(T / Tref_, Tpow_);
+  }
+
+  //! True if baseOpacity is a fixed function of frequency (false for the fuzz model).
+  bool deterministic() const { return number_of_lines_ >= 0; }
 
   static double BB(double const T, double const x) {
     double const e = expm1(x / T);
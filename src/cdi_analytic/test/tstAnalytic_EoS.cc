@@ -11,6 +11,8 @@
 #include "cdi_analytic/Analytic_EoS.hh"
 #include "ds++/Release.hh"
 #include "ds++/ScalarUnitTest.hh"
+#include <chrono>
+#include <numeric>
 
 using namespace std;
 
@@ -449,6 +451,106 @@ void packing_test(rtt_dsxx::UnitTest &ut) {
   return;
 }
 
+//------------------------------------------------------------------------------------------------//
+//! Compare the batched temperature inversion with the scalar root finder and report iterations.
+void batched_temperature_test(rtt_dsxx::UnitTest &ut) {
+  using Polynomial_Model = Polynomial_Specific_Heat_Analytic_EoS_Model;
+
+  // Su-Olson electrons (a = 0), a mixed power law, and constant-Cv ions.
+  vector<shared_ptr<Polynomial_Model>> const models = {
+      make_shared<Polynomial_Model>(0.0, 54880.0, 3.0, 0.2, 0.0, 0.0),
+      make_shared<Polynomial_Model>(0.1, 2.0, 1.5, 0.3, 0.05, 2.5)};
+
+  size_t const n = 20000;
+  vector<double> const rho(n, 1.0);
+  for (auto const &model : models) {
+    // Temperatures from 1e-6 to 100 keV; guesses within 30%, absent, or absurd.
+    vector<double> T(n);
+    vector<double> Ue(n);
+    vector<double> Ui(n);
+    vector<double> guess(n);
+    for (size_t i = 0; i < n; ++i) {
+      double const x = static_cast<double>(i) / static_cast<double>(n - 1);
+      T[i] = i % 101 == 0 ? 0.0 : 1.0e-6 * pow(1.0e8, x);
+      Ue[i] = model->calculate_electron_internal_energy(T[i], rho[i]);
+      Ui[i] = model->calculate_ion_internal_energy(T[i], rho[i]);
+      guess[i] = i % 7 == 0 ? 0.0 : (i % 13 == 0 ? 4.0e43 : T[i] * (1.0 + 0.3 * sin(1.0e3 * x)));
+    }
+
+    vector<double> Te(n);
+    vector<double> Ti(n);
+    vector<unsigned> its(n);
+    vector<unsigned> its_i(n);
+    auto const t0 = chrono::steady_clock::now();
+    size_t fallbacks =
+        model->calculate_elec_temperature(n, rho.data(), Ue.data(), guess.data(), Te.data(),
+                                          its.data());
+    auto const t1 = chrono::steady_clock::now();
+    fallbacks +=
+        model->calculate_ion_temperature(n, rho.data(), Ui.data(), guess.data(), Ti.data(),
+                                         its_i.data());
+    FAIL_IF_NOT(fallbacks == 0);
+
+    // The exact temperatures are recovered.  The scalar root finder agrees wherever it can bracket
+    // the root (it cannot from a zero guess unless T is tiny), to within its absolute tolerance.
+    FAIL_IF_NOT(soft_equiv(Te.begin(), Te.end(), T.begin(), T.end(), 1.0e-12));
+    FAIL_IF_NOT(soft_equiv(Ti.begin(), Ti.end(), T.begin(), T.end(), 1.0e-12));
+    size_t mismatches(0);
+    auto const t2 = chrono::steady_clock::now();
+    for (size_t i = 0; i < n; ++i) {
+      if (guess[i] > 0.0) {
+        double const Te_scalar = model->calculate_elec_temperature(rho[i], Ue[i], guess[i]);
+        mismatches += soft_equiv(Te[i], Te_scalar, 1.0e-9) ? 0 : 1;
+      }
+    }
+    auto const t3 = chrono::steady_clock::now();
+    FAIL_IF_NOT(mismatches == 0);
+
+    // Without guesses the solve starts from the upper bound on T.
+    vector<double> Te_noguess(n);
+    vector<unsigned> its_noguess(n);
+    fallbacks = model->calculate_elec_temperature(n, rho.data(), Ue.data(), nullptr,
+                                                  Te_noguess.data(), its_noguess.data());
+    FAIL_IF_NOT(fallbacks == 0);
+    FAIL_IF_NOT(soft_equiv(Te_noguess.begin(), Te_noguess.end(), T.begin(), T.end(), 1.0e-12));
+
+    auto const mean = [n](vector<unsigned> const &v) {
+      return static_cast<double>(accumulate(v.begin(), v.end(), size_t(0))) /
+             static_cast<double>(n);
+    };
+    double const batched = chrono::duration<double>(t1 - t0).count();
+    double const scalar = chrono::duration<double>(t3 - t2).count();
+    cout << "\nBatched Newton inversion of " << n << " cells (a, b, c = "
+         << model->get_parameters()[0] << ", " << model->get_parameters()[1] << ", "
+         << model->get_parameters()[2] << "):\n"
+         << "  electrons with guesses: mean " << mean(its) << ", max "
+         << *max_element(its.begin(), its.end()) << " iterations\n"
+         << "  electrons, no guesses:  mean " << mean(its_noguess) << ", max "
+         << *max_element(its_noguess.begin(), its_noguess.end()) << " iterations\n"
+         << "  ions with guesses:      mean " << mean(its_i) << ", max "
+         << *max_element(its_i.begin(), its_i.end()) << " iterations\n"
+         << "  electron time: batched " << batched << " s, scalar Brent " << scalar
+         << " s (speedup " << scalar / batched << ")" << endl;
+  }
+
+  // Analytic_EoS forwards the batch to its model and matches its scalar interface.
+  Analytic_EoS const eos(models[1]);
+  vector<double> const U = {0.0, 1.0e-12, 1.0e-3, 0.5, 2.0, 1.0e4};
+  vector<double> const rho6(U.size(), 2.0);
+  vector<double> Te(U.size());
+  vector<double> Ti(U.size());
+  eos.getElectronTemperature(U.size(), rho6.data(), U.data(), nullptr, Te.data());
+  eos.getIonTemperature(U.size(), rho6.data(), U.data(), nullptr, Ti.data());
+  for (size_t i = 0; i < U.size(); ++i) {
+    FAIL_IF_NOT(soft_equiv(Te[i], eos.getElectronTemperature(rho6[i], U[i]), 1.0e-12));
+    FAIL_IF_NOT(soft_equiv(Ti[i], eos.getIonTemperature(rho6[i], U[i]), 1.0e-12));
+  }
+  FAIL_IF_NOT(soft_equiv(Te[0], 0.0, 1.0e-40));
+
+  if (ut.numFails == 0)
+    PASSMSG("Batched temperature inversion matches the scalar root finder.");
+}
+
 //------------------------------------------------------------------------------------------------//
 int main(int argc, char *argv[]) {
   rtt_dsxx::ScalarUnitTest ut(argc, argv, rtt_dsxx::release);
@@ -457,6 +559,7 @@ int main(int argc, char *argv[]) {
     analytic_eos_test(ut);
     CDI_test(ut);
     packing_test(ut);
+    batched_temperature_test(ut);
   }
   UT_EPILOG(ut);
 }
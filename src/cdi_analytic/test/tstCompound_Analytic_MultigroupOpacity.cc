@@ -13,6 +13,7 @@
 #include "cdi_analytic/Compound_Analytic_MultigroupOpacity.hh"
 #include "ds++/Release.hh"
 #include "ds++/ScalarUnitTest.hh"
+#include <chrono>
 #include <memory>
 #include <sstream>
 
@@ -359,6 +360,104 @@ void packing_test(rtt_dsxx::UnitTest &ut) {
   }
 }
 
+//------------------------------------------------------------------------------------------------//
+void batch_test(rtt_dsxx::UnitTest &ut) {
+  vector<double> groups = {0.05, 0.5, 5.0, 50.0};
+  vector<shared_ptr<Analytic_Opacity_Model>> models(3);
+  models[0] = std::make_shared<rtt_cdi_analytic_test::Marshak_Model>(100.0);
+  models[1] = std::make_shared<Polynomial_Analytic_Opacity_Model>(1.5, 0.5, 1.0, 0.0);
+  models[2] = std::make_shared<Constant_Analytic_Opacity_Model>(3.0);
+  shared_ptr<const MultigroupOpacity> opacity =
+      std::make_shared<const Compound_Analytic_MultigroupOpacity>(groups, models,
+                                                                  rtt_cdi::ABSORPTION);
+  size_t const ng = opacity->getNumGroups();
+
+  // a mesh worth of cell temperatures and densities
+  size_t const ncells = 100000;
+  vector<double> T(ncells);
+  vector<double> rho(ncells);
+  for (size_t c = 0; c < ncells; ++c) {
+    T[c] = 0.1 + 0.001 * static_cast<double>(c % 997);
+    rho[c] = 1.0 + 0.01 * static_cast<double>(c % 101);
+  }
+
+  // one vector allocated per cell
+  auto const t0 = chrono::steady_clock::now();
+  vector<vector<double>> per_cell(ncells);
+  for (size_t c = 0; c < ncells; ++c)
+    per_cell[c] = opacity->getOpacity(T[c], rho[c]);
+  auto const t1 = chrono::steady_clock::now();
+
+  // one caller-owned buffer for the whole mesh
+  vector<double> batch(ncells * ng, -1.0);
+  opacity->getOpacityBatch(ncells, T.data(), rho.data(), batch.data());
+  auto const t2 = chrono::steady_clock::now();
+
+  for (size_t c = 0; c < ncells; ++c)
+    for (size_t g = 0; g < ng; ++g)
+      if (!soft_equiv(batch[c * ng + g], per_cell[c][g]))
+        ITFAILS;
+
+  cout << "\nOpacities for " << ncells << " cells x " << ng << " groups:"
+       << "\n  getOpacity per cell (" << ncells
+       << " allocations): " << chrono::duration<double>(t1 - t0).count() << " s"
+       << "\n  getOpacityBatch (1 allocation): " << chrono::duration<double>(t2 - t1).count()
+       << " s\n"
+       << endl;
+
+  if (ut.numFails == 0)
+    PASSMSG("Batched compound opacities match the per cell opacities.");
+}
+
+//------------------------------------------------------------------------------------------------//
+//! A Polynomial model with its own group opacity, which the compiled plan must not bypass.
+class Doubled_Polynomial_Model : public Polynomial_Analytic_Opacity_Model {
+public:
+  Doubled_Polynomial_Model() : Polynomial_Analytic_Opacity_Model(0.5, 1.0, 2.0, 1.0) {}
+  using Polynomial_Analytic_Opacity_Model::calculate_opacity;
+  double calculate_opacity(double T, double rho, double nu0, double nu1) const override {
+    return 2.0 * Polynomial_Analytic_Opacity_Model::calculate_opacity(T, rho, nu0, nu1);
+  }
+};
+
+void plan_test(rtt_dsxx::UnitTest &ut) {
+  // groups mixing every built-in form with user models; several share a temperature power law
+  vector<double> groups = {0.01, 0.1, 0.3, 1.0, 3.0, 10.0, 30.0, 100.0, 300.0};
+  vector<shared_ptr<Analytic_Opacity_Model>> models(8);
+  models[0] = std::make_shared<Polynomial_Analytic_Opacity_Model>(0.1, 2.0, -3.0, 1.0, -3.0, 0.5,
+                                                                  2.0, 1.5, 1.0);
+  models[1] = std::make_shared<Constant_Analytic_Opacity_Model>(7.0);
+  models[2] = std::make_shared<Polynomial_Analytic_Opacity_Model>(0.0, 2.0, -3.0, 1.0, -3.0, 0.5,
+                                                                  2.0, 1.5, 1.0, 5.0, 2.0);
+  models[3] = std::make_shared<rtt_cdi_analytic_test::Marshak_Model>(10.0);
+  models[4] = std::make_shared<Polynomial_Analytic_Opacity_Model>(1.0, 0.5, 1.0, 0.0);
+  models[5] = std::make_shared<Doubled_Polynomial_Model>();
+  models[6] = std::make_shared<Polynomial_Analytic_Opacity_Model>(0.0, 2.0, -3.0, 1.0, -3.0, 0.5,
+                                                                  2.0, 1.5, 1.0, 5.0, 2.0);
+  models[7] = std::make_shared<Polynomial_Analytic_Opacity_Model>(0.2, 3.0, 0.5, -1.0, 1.0, 2.0,
+                                                                  0.5, 10.0, 0.0, 1.0, 50.0);
+  Compound_Analytic_MultigroupOpacity const opacity(groups, models, rtt_cdi::TOTAL);
+  size_t const ng = models.size();
+
+  vector<double> const T = {1.0e-3, 0.05, 1.0, 2.5, 40.0};
+  vector<double> const rho = {1.0e-3, 1.0e-2, 1.0, 3.0, 100.0};
+  vector<double> batch(T.size() * ng);
+  opacity.getOpacityBatch(T.size(), T.data(), rho.data(), batch.data());
+
+  for (size_t c = 0; c < T.size(); ++c) {
+    vector<double> const sigma = opacity.getOpacity(T[c], rho[c]);
+    FAIL_IF_NOT(sigma.size() == ng);
+    for (size_t g = 0; g < ng; ++g) {
+      double const direct = models[g]->calculate_opacity(T[c], rho[c], groups[g], groups[g + 1]);
+      FAIL_IF_NOT(soft_equiv(sigma[g], direct, 1.0e-13));
+      FAIL_IF_NOT(soft_equiv(batch[c * ng + g], direct, 1.0e-13));
+    }
+  }
+
+  if (ut.numFails == 0)
+    PASSMSG("Compiled plan matches the group models for mixed, stimulated and edge models.");
+}
+
 //------------------------------------------------------------------------------------------------//
 
 int main(int argc, char *argv[]) {
@@ -368,6 +467,8 @@ int main(int argc, char *argv[]) {
     multigroup_test(ut);
     test_CDI(ut);
     packing_test(ut);
+    batch_test(ut);
+    plan_test(ut);
   }
   UT_EPILOG(ut);
 }
@@ -143,11 +143,100 @@ void tstPseudo_Line_Analytic_MultigroupOpacity(UnitTest &ut) {
   }
 }
 
+//------------------------------------------------------------------------------------------------//
+void tstPseudo_Line_plan(UnitTest &ut) {
+  unsigned const NG = 64;
+  unsigned const qpoints = 3;
+  double const Tref = 2.0;
+  double const Tpow = -1.5;
+  double const emin = 0.0;
+  double const emax = 10.0; // keV
+
+  std::shared_ptr<Expression const> continuum;
+  {
+    map<string, pair<unsigned, Unit>> variables;
+    variables["x"] = pair<unsigned, Unit>(0, raw);
+
+    String_Token_Stream expr("1.0e-2 + 20/(x+1)^3 + 1e-4*x*x*x*x");
+    continuum = Expression::parse(1, variables, expr);
+  }
+
+  vector<double> group_bounds(NG + 1);
+  for (unsigned i = 0; i <= NG; i++)
+    group_bounds[i] = i * (emax - emin) / NG + emin;
+
+  vector<double> const T = {0.1, 0.5, 2.0, 7.0};
+
+  // Fixed-point averages scale a precomputed base with temperature.
+  for (auto const averaging : {NONE, ROSSELAND, PLANCK}) {
+    Pseudo_Line_Analytic_MultigroupOpacity model(group_bounds, rtt_cdi::ABSORPTION, continuum, 20,
+                                                 1e1, 0.02, 10, 10.0, Tref, Tpow, emin, emax,
+                                                 averaging, qpoints, 1);
+
+    vector<double> batch(T.size() * NG);
+    model.getOpacityBatch(T.size(), T.data(), T.data(), batch.data());
+
+    for (size_t c = 0; c < T.size(); ++c) {
+      vector<double> const sigma = model.getOpacity(T[c], 1.0);
+      FAIL_IF_NOT(sigma.size() == NG);
+      for (unsigned g = 0; g < NG; ++g) {
+        double const g0 = group_bounds[g];
+        double const g1 = group_bounds[g + 1];
+        double expected(0.0);
+        if (averaging == NONE) {
+          expected = model.monoOpacity(0.5 * (g0 + g1), T[c]);
+        } else {
+          double t = 0.0;
+          for (unsigned ig = 0; ig < qpoints; ++ig) {
+            double const mono = model.monoOpacity((ig + 0.5) * (g1 - g0) / qpoints + g0, T[c]);
+            t += averaging == PLANCK ? mono : 1.0 / mono;
+          }
+          expected = averaging == PLANCK ? t / qpoints : qpoints / t;
+        }
+        FAIL_IF_NOT(soft_equiv(sigma[g], expected, 1.0e-13));
+        FAIL_IF_NOT(soft_equiv(batch[c * NG + g], sigma[g]));
+      }
+    }
+  }
+  if (ut.numFails == 0)
+    PASSMSG("Precomputed pseudo line opacities match direct averages.");
+
+  // Adaptive quadrature keeps the last temperature.
+  {
+    vector<double> const coarse = {emin, 0.5, 1.0, 2.0, 5.0, emax};
+    Pseudo_Line_Analytic_MultigroupOpacity cached(coarse, rtt_cdi::ABSORPTION, continuum, 20, 1e1,
+                                                  0.02, 10, 10.0, Tref, Tpow, emin, emax, PLANCK,
+                                                  0, 1);
+    Pseudo_Line_Analytic_MultigroupOpacity fresh(coarse, rtt_cdi::ABSORPTION, continuum, 20, 1e1,
+                                                 0.02, 10, 10.0, Tref, Tpow, emin, emax, PLANCK, 0,
+                                                 1);
+
+    // An empty cache never matches, whatever the temperature.
+    FAIL_IF_NOT(cached.getOpacity(-1.0, 1.0).size() == coarse.size() - 1);
+
+    vector<double> const first = cached.getOpacity(0.5, 1.0);
+    vector<double> const repeat = cached.getOpacity(0.5, 2.0);
+    vector<double> const other = cached.getOpacity(2.0, 1.0);
+    FAIL_IF_NOT(first == repeat);
+    FAIL_IF_NOT(soft_equiv(other, fresh.getOpacity(2.0, 1.0)));
+    FAIL_IF_NOT(soft_equiv(cached.getOpacity(0.5, 1.0), first));
+    FAIL_IF_NOT(!soft_equiv(first, other, 1.0e-6));
+
+    // A NaN temperature is evaluated rather than matched against the cached temperature.
+    vector<double> const nan_sigma = cached.getOpacity(numeric_limits<double>::quiet_NaN(), 1.0);
+    FAIL_IF_NOT(nan_sigma.size() == coarse.size() - 1);
+    FAIL_IF(nan_sigma == first);
+  }
+  if (ut.numFails == 0)
+    PASSMSG("Adaptive pseudo line opacities are cached by temperature.");
+}
+
 //------------------------------------------------------------------------------------------------//
 int main(int argc, char *argv[]) {
   rtt_c4::ParallelUnitTest ut(argc, argv, release);
   try {
     tstPseudo_Line_Analytic_MultigroupOpacity(ut);
+    tstPseudo_Line_plan(ut);
   }
   UT_EPILOG(ut);
 }
@@ -143,9 +143,9 @@ void Eospac::printTableInformation(EOS_INTEGER const tableType, std::ostream &ou
 //------------------------------------------------------------------------------------------------//
 double Eospac::getSpecificElectronInternalEnergy(double temperature, double density) const {
   EOS_INTEGER const returnType = EOS_Ue_DT; // ES4enelc;
-  // Convert temperatures from keV to degrees Kelvin.
-  double vtempsKelvin = keV2K(temperature);
-  return getF(dbl_v1(density), dbl_v1(vtempsKelvin), returnType, ETDD_VALUE)[0];
+  double energy(0.0);
+  interpolate(returnType, 1, &density, &temperature, keV2K(1.0), &energy, nullptr, nullptr);
+  return energy;
 }
 
 //------------------------------------------------------------------------------------------------//
@@ -153,10 +153,8 @@ std::vector<double>
 Eospac::getSpecificElectronInternalEnergy(std::vector<double> const &vtemperature,
                                           std::vector<double> const &vdensity) const {
   EOS_INTEGER const returnType = EOS_Ue_DT; // ES4enelc;
-  // Convert temperatures from keV to degrees Kelvin.
-  std::vector<double> vtempsKelvin = vtemperature;
-  std::transform(vtemperature.begin(), vtemperature.end(), vtempsKelvin.begin(), keV2K);
-  return getF(vdensity, vtempsKelvin, returnType, ETDD_VALUE);
+  // Temperatures are converted from keV to degrees Kelvin by getF().
+  return getF(vdensity, vtemperature, returnType, ETDD_VALUE, keV2K(1.0));
 }
 
 //------------------------------------------------------------------------------------------------//
@@ -164,14 +162,12 @@ double Eospac::getElectronHeatCapacity(double temperature, double density) const
   // specific Heat capacity is dE/dT at constant pressure.  To obtain the specific electron heat
   // capacity we load the specific electron internal energy (E) and it's first derivative w.r.t
   // temperature.
-
-  // Convert temperatures from keV to degrees Kelvin.
-  double vtempsKelvin = keV2K(temperature);
   EOS_INTEGER const returnType = EOS_Ue_DT; // ES4enelc
-  std::vector<double> Cve = getF(dbl_v1(density), dbl_v1(vtempsKelvin), returnType, ETDD_DFDY);
+  double energy(0.0);
+  double Cve(0.0);
+  interpolate(returnType, 1, &density, &temperature, keV2K(1.0), &energy, nullptr, &Cve);
   // Convert back to Temperature units in keV
-  std::transform(Cve.begin(), Cve.end(), Cve.begin(), keV2K);
-  return Cve[0];
+  return keV2K(Cve);
 }
 
 //------------------------------------------------------------------------------------------------//
@@ -180,12 +176,8 @@ std::vector<double> Eospac::getElectronHeatCapacity(std::vector<double> const &v
   // specific Heat capacity is dE/dT at constant pressure.  To obtain the specific electron heat
   // capacity we load the specific electron internal energy (E) and it's first derivative w.r.t
   // temperature.
-
-  // Convert temperatures from keV to degrees Kelvin.
-  std::vector<double> vtempsKelvin = vtemperature;
-  std::transform(vtemperature.begin(), vtemperature.end(), vtempsKelvin.begin(), keV2K);
   EOS_INTEGER const returnType = EOS_Ue_DT; // ES4enelc;
-  std::vector<double> Cve = getF(vdensity, vtempsKelvin, returnType, ETDD_DFDY);
+  std::vector<double> Cve = getF(vdensity, vtemperature, returnType, ETDD_DFDY, keV2K(1.0));
   // Convert back to Temperature units in keV
   std::transform(Cve.begin(), Cve.end(), Cve.begin(), keV2K);
   return Cve;
@@ -194,21 +186,18 @@ std::vector<double> Eospac::getElectronHeatCapacity(std::vector<double> const &v
 //------------------------------------------------------------------------------------------------//
 double Eospac::getSpecificIonInternalEnergy(double temperature, double density) const {
   EOS_INTEGER const returnType = EOS_Uic_DT; // ES4enion;
-
-  // Convert temperatures from keV to degrees Kelvin.
-  double vtempsKelvin = keV2K(temperature);
-  return getF(dbl_v1(density), dbl_v1(vtempsKelvin), returnType, ETDD_VALUE)[0];
+  double energy(0.0);
+  interpolate(returnType, 1, &density, &temperature, keV2K(1.0), &energy, nullptr, nullptr);
+  return energy;
 }
 
 //------------------------------------------------------------------------------------------------//
 std::vector<double>
 Eospac::getSpecificIonInternalEnergy(std::vector<double> const &vtemperature,
                                      std::vector<double> const &vdensity) const {
-  // Convert temperatures from keV to degrees Kelvin.
-  std::vector<double> vtempsKelvin = vtemperature;
-  std::transform(vtemperature.begin(), vtemperature.end(), vtempsKelvin.begin(), keV2K);
   EOS_INTEGER const returnType = EOS_Uic_DT; //ES4enion;
-  return getF(vdensity, vtemperature, returnType, ETDD_VALUE);
+  // Temperatures are converted from keV to degrees Kelvin by getF().
+  return getF(vdensity, vtemperature, returnType, ETDD_VALUE, keV2K(1.0));
 }
 
 //------------------------------------------------------------------------------------------------//
@@ -216,14 +205,12 @@ double Eospac::getIonHeatCapacity(double temperature, double density) const {
   // specific Heat capacity is dE/dT at constant pressure.  To obtain the specific electron heat
   // capacity we load the specific electron internal energy (E) and it's first derivative w.r.t
   // temperature.
-
-  // Convert temperatures from keV to degrees Kelvin.
-  double vtempsKelvin = keV2K(temperature);
   EOS_INTEGER const returnType = EOS_Uic_DT; //ES4enion;
-  std::vector<double> Cvi = getF(dbl_v1(density), dbl_v1(vtempsKelvin), returnType, ETDD_DFDY);
+  double energy(0.0);
+  double Cvi(0.0);
+  interpolate(returnType, 1, &density, &temperature, keV2K(1.0), &energy, nullptr, &Cvi);
   // Convert back to Temperature units in keV
-  std::transform(Cvi.begin(), Cvi.end(), Cvi.begin(), keV2K);
-  return Cvi[0];
+  return keV2K(Cvi);
 }
 
 //------------------------------------------------------------------------------------------------//
@@ -232,12 +219,8 @@ std::vector<double> Eospac::getIonHeatCapacity(std::vector<double> const &vtempe
   // specific Heat capacity is dE/dT at constant pressure.  To obtain the specific electron heat
   // capacity we load the specific electron internal energy (E) and it's first derivative w.r.t
   // temperature.
-
-  // Convert temperatures from keV to degrees Kelvin.
-  std::vector<double> vtempsKelvin = vtemperature;
-  std::transform(vtemperature.begin(), vtemperature.end(), vtempsKelvin.begin(), keV2K);
   EOS_INTEGER const returnType = EOS_Uic_DT; //ES4enion;
-  std::vector<double> Cvi = getF(vdensity, vtempsKelvin, returnType, ETDD_DFDY);
+  std::vector<double> Cvi = getF(vdensity, vtemperature, returnType, ETDD_DFDY, keV2K(1.0));
   // Convert back to Temperature units in keV
   std::transform(Cvi.begin(), Cvi.end(), Cvi.begin(), keV2K);
   return Cvi;
@@ -245,39 +228,33 @@ std::vector<double> Eospac::getIonHeatCapacity(std::vector<double> const &vtempe
 
 //------------------------------------------------------------------------------------------------//
 double Eospac::getNumFreeElectronsPerIon(double temperature, double density) const {
-  // Convert temperatures from keV to degrees Kelvin.
-  double vtempsKelvin = keV2K(temperature);
   EOS_INTEGER const returnType = EOS_Zfc_DT; // ES4zfree3; // (zfree3)
-  return getF(dbl_v1(density), dbl_v1(vtempsKelvin), returnType, ETDD_VALUE)[0];
+  double nfree(0.0);
+  interpolate(returnType, 1, &density, &temperature, keV2K(1.0), &nfree, nullptr, nullptr);
+  return nfree;
 }
 
 //------------------------------------------------------------------------------------------------//
 std::vector<double> Eospac::getNumFreeElectronsPerIon(std::vector<double> const &vtemperature,
                                                       std::vector<double> const &vdensity) const {
-  // Convert temperatures from keV to degrees Kelvin.
-  std::vector<double> vtempsKelvin = vtemperature;
-  std::transform(vtemperature.begin(), vtemperature.end(), vtempsKelvin.begin(), keV2K);
   EOS_INTEGER const returnType = EOS_Zfc_DT; //ES4zfree3; // (zfree3)
-  return getF(vdensity, vtempsKelvin, returnType, ETDD_VALUE);
+  return getF(vdensity, vtemperature, returnType, ETDD_VALUE, keV2K(1.0));
 }
 
 //------------------------------------------------------------------------------------------------//
 double Eospac::getElectronThermalConductivity(double temperature, double density) const {
-  // Convert temperatures from keV to degrees Kelvin.
-  double vtempsKelvin = keV2K(temperature);
   EOS_INTEGER const returnType = EOS_Ktc_DT; //ES4tconde; // (tconde)
-  return getF(dbl_v1(density), dbl_v1(vtempsKelvin), returnType, ETDD_VALUE)[0];
+  double chie(0.0);
+  interpolate(returnType, 1, &density, &temperature, keV2K(1.0), &chie, nullptr, nullptr);
+  return chie;
 }
 
 //------------------------------------------------------------------------------------------------//
 std::vector<double>
 Eospac::getElectronThermalConductivity(std::vector<double> const &vtemperature,
                                        std::vector<double> const &vdensity) const {
-  // Convert temperatures from keV to degrees Kelvin.
-  std::vector<double> vtempsKelvin = vtemperature;
-  std::transform(vtemperature.begin(), vtemperature.end(), vtempsKelvin.begin(), keV2K);
   EOS_INTEGER const returnType = EOS_Ktc_DT; //ES4tconde; // (tconde)
-  return getF(vdensity, vtempsKelvin, returnType, ETDD_VALUE);
+  return getF(vdensity, vtemperature, returnType, ETDD_VALUE, keV2K(1.0));
 }
 
 //------------------------------------------------------------------------------------------------//
@@ -286,10 +263,9 @@ double Eospac::getElectronTemperature(     // keV
     double SpecificElectronInternalEnergy, // kJ/g
     double /*Tguess*/) const               // keV
 {
-  EOS_INTEGER const returnType = EOS_T_DUe;
-  double Te_K =
-      getF(dbl_v1(density), dbl_v1(SpecificElectronInternalEnergy), returnType, ETDD_VALUE)[0];
-  return Te_K / keV2K(1.0); // Convert from K back to keV.
+  double Te(0.0);
+  getElectronTemperature(1, &density, &SpecificElectronInternalEnergy, &Te);
+  return Te;
 }
 
 //------------------------------------------------------------------------------------------------//
@@ -298,10 +274,80 @@ double Eospac::getIonTemperature(     // keV
     double SpecificIonInternalEnergy, // kJ/g
     double /*Tguess*/) const          // keV
 {
+  double Ti(0.0);
+  getIonTemperature(1, &density, &SpecificIonInternalEnergy, &Ti);
+  return Ti;
+}
+
+// ----------------- //
+// Batched accessors //
+// ----------------- //
+
+//------------------------------------------------------------------------------------------------//
+void Eospac::getSpecificElectronInternalEnergy(size_t const n, double const *const temperature,
+                                               double const *const density, double *const energy,
+                                               double *const heatCapacity) const {
+  EOS_INTEGER const returnType = EOS_Ue_DT; // ES4enelc;
+  interpolate(returnType, n, density, temperature, keV2K(1.0), energy, nullptr, heatCapacity);
+  // dUe/dT was returned per Kelvin; convert to per keV.
+  if (heatCapacity)
+    std::transform(heatCapacity, heatCapacity + n, heatCapacity, keV2K);
+}
+
+//------------------------------------------------------------------------------------------------//
+void Eospac::getSpecificIonInternalEnergy(size_t const n, double const *const temperature,
+                                          double const *const density, double *const energy,
+                                          double *const heatCapacity) const {
+  EOS_INTEGER const returnType = EOS_Uic_DT; // ES4enion;
+  interpolate(returnType, n, density, temperature, keV2K(1.0), energy, nullptr, heatCapacity);
+  // dUi/dT was returned per Kelvin; convert to per keV.
+  if (heatCapacity)
+    std::transform(heatCapacity, heatCapacity + n, heatCapacity, keV2K);
+}
+
+//------------------------------------------------------------------------------------------------//
+void Eospac::getNumFreeElectronsPerIon(size_t const n, double const *const temperature,
+                                       double const *const density, double *const nfree) const {
+  EOS_INTEGER const returnType = EOS_Zfc_DT; // ES4zfree3; // (zfree3)
+  interpolate(returnType, n, density, temperature, keV2K(1.0), nfree, nullptr, nullptr);
+}
+
+//------------------------------------------------------------------------------------------------//
+void Eospac::getElectronThermalConductivity(size_t const n, double const *const temperature,
+                                            double const *const density, double *const chie) const {
+  EOS_INTEGER const returnType = EOS_Ktc_DT; // ES4tconde; // (tconde)
+  interpolate(returnType, n, density, temperature, keV2K(1.0), chie, nullptr, nullptr);
+}
+
+//------------------------------------------------------------------------------------------------//
+void Eospac::getElectronTemperature(size_t const n, double const *const density,
+                                    double const *const energy, double *const temperature,
+                                    double *const dTdU) const {
+  EOS_INTEGER const returnType = EOS_T_DUe;
+  interpolate(returnType, n, density, energy, 1.0, temperature, nullptr, dTdU);
+  // Convert from K back to keV.
+  double const K2keV = 1.0 / keV2K(1.0);
+  for (size_t i = 0; i < n; ++i)
+    temperature[i] *= K2keV;
+  if (dTdU)
+    for (size_t i = 0; i < n; ++i)
+      dTdU[i] *= K2keV;
+}
+
+//------------------------------------------------------------------------------------------------//
+void Eospac::getIonTemperature(size_t const n, double const *const density,
+                               double const *const energy, double *const temperature,
+                               double *const dTdU) const {
   EOS_INTEGER const returnType = EOS_T_DUic;
   // EOS_INTEGER const returnType = EOS_T_DUiz; - I think I need the DUic version!
-  double Te_K = getF(dbl_v1(density), dbl_v1(SpecificIonInternalEnergy), returnType, ETDD_VALUE)[0];
-  return Te_K / keV2K(1.0); // Convert from K back to keV.
+  interpolate(returnType, n, density, energy, 1.0, temperature, nullptr, dTdU);
+  // Convert from K back to keV.
+  double const K2keV = 1.0 / keV2K(1.0);
+  for (size_t i = 0; i < n; ++i)
+    temperature[i] *= K2keV;
+  if (dTdU)
+    for (size_t i = 0; i < n; ++i)
+      dTdU[i] *= K2keV;
 }
 
 // ------- //
@@ -324,105 +370,144 @@ std::vector<char> Eospac::pack() const { return SesTabs.pack(); }
 // Implementation //
 // -------------- //
 
+namespace {
+
+//! Per-thread eos_Interpolate arguments and unrequested outputs, grown as needed and never shrunk.
+struct Interpolate_Scratch {
+  std::vector<EOS_REAL> x;
+  std::vector<EOS_REAL> y;
+  std::vector<EOS_REAL> dFx;
+  std::vector<EOS_REAL> dFy;
+
+  void reserve(size_t const n) {
+    if (x.size() < n) {
+      x.resize(n);
+      y.resize(n);
+      dFx.resize(n);
+      dFy.resize(n);
+    }
+  }
+};
+
+Interpolate_Scratch &interpolate_scratch() {
+  static thread_local Interpolate_Scratch scratch;
+  return scratch;
+}
+
+} // namespace
+
 //------------------------------------------------------------------------------------------------//
 /*! \brief Retrieves the EoS data associated with the returnType specified and the given (density,
  *         temperature) tuples.
  */
 std::vector<double> Eospac::getF(std::vector<double> const &vdensity,
                                  std::vector<double> const &vtemperature,
-                                 EOS_INTEGER const returnType,
-                                 EosTableDataDerivative const etdd) const {
+                                 EOS_INTEGER const returnType, EosTableDataDerivative const etdd,
+                                 double const yScale) const {
   // The density and vector parameters must be a tuple.
   Require(vtemperature.size() == vdensity.size());
-
-  unsigned returnTypeTableIndex(tableIndex(returnType));
+  Insist(etdd == ETDD_VALUE || etdd == ETDD_DFDX || etdd == ETDD_DFDY,
+         "Bad value for EosTableDataDerivative.");
 
   // There is one piece of returned information for each (density, temperature) tuple.
-  Check(vtemperature.size() < INT32_MAX);
-  auto returnSize = static_cast<EOS_INTEGER>(vtemperature.size());
+  size_t const n(vtemperature.size());
+  std::vector<double> returnVals(n);
+  std::vector<double> derivative(etdd == ETDD_VALUE ? 0 : n);
+  interpolate(returnType, n, vdensity.data(), vtemperature.data(), yScale, returnVals.data(),
+              etdd == ETDD_DFDX ? derivative.data() : nullptr,
+              etdd == ETDD_DFDY ? derivative.data() : nullptr);
+  return etdd == ETDD_VALUE ? returnVals : derivative;
+}
 
-  std::vector<double> returnVals(returnSize);
-  std::vector<double> dFx(returnSize);
-  std::vector<double> dFy(returnSize);
-  EOS_INTEGER errorCode = 0;
-  std::vector<double> nc_vx(vdensity);
-  std::vector<double> nc_vy(vtemperature);
+//------------------------------------------------------------------------------------------------//
+/*!
+ * The inputs are copied (and y scaled) into this thread's scratch buffers because eos_Interpolate
+ * takes non-const arguments; derivatives that were not requested are also written there.  Once
+ * the buffers have grown to n entries the call does not allocate.
+ */
+void Eospac::interpolate(EOS_INTEGER const returnType, size_t const n, double const *const density,
+                         double const *const y, double const yScale, double *const value,
+                         double *const dFdx, double *const dFdy) const {
+  Require(n == 0 || (density != nullptr && y != nullptr && value != nullptr));
+
+  // Throws if returnType has not been loaded, even for an empty request.
+  unsigned const index(tableIndex(returnType));
+  if (n == 0)
+    return;
+
+  Check(n < INT32_MAX);
+  auto returnSize = static_cast<EOS_INTEGER>(n);
+
+  Interpolate_Scratch &scratch = interpolate_scratch();
+  scratch.reserve(n);
+  for (size_t i = 0; i < n; ++i) {
+    scratch.x[i] = density[i];
+    scratch.y[i] = yScale * y[i];
+  }
 
-  eos_Interpolate(&tableHandles[returnTypeTableIndex], &returnSize, &nc_vx[0], &nc_vy[0],
-                  &returnVals[0], &dFx[0], &dFy[0], &errorCode);
+  EOS_INTEGER errorCode = 0;
+  eos_Interpolate(&tableHandles[index], &returnSize, scratch.x.data(), scratch.y.data(), value,
+                  dFdx ? dFdx : scratch.dFx.data(), dFdy ? dFdy : scratch.dFy.data(), &errorCode);
 
-  if (errorCode != 0) {
-    std::ostringstream outputString;
-    std::array<EOS_CHAR, EOS_MaxErrMsgLen> errorMessage{};
-    eos_GetErrorMessage(&errorCode, errorMessage.data());
+  if (errorCode != 0)
+    throwInterpolateError(index, returnType, returnSize, scratch.x.data(), scratch.y.data(),
+                          errorCode);
+}
 
-    outputString << "\n\tAn unsuccessful request for EOSPAC data was made by eos_Interpolate() "
-                 << "from within getF().\n\tThe requested returnType was \"" << returnType
-                 << "\" (see eos_Interface.h for type)\n\tThe error code returned was \""
-                 << errorCode << "\".\n\tThe associated error message is:\n\t\""
-                 << std::string(errorMessage.data()) << "\"\n";
-
-    if (errorCode == EOS_INTERP_EXTRAPOLATED) {
-      // If the EOS_INTERP_EXTRAPOLATED error code is returned by either eos_Interpolate or eos_Mix,
-      // then the eos_CheckExtrap routine allows the user to determine which (x,y) pairs caused
-      // extrapolation and in which direction (high or low), it occurred. The units of the xVals,
-      // and yVals arguments listed below are determined by the units listed for each tableType in
-      // APPENDIX B and APPENDIX C.
-
-      std::vector<EOS_INTEGER> xyBounds(returnSize);
-
-      eos_CheckExtrap(&tableHandles[returnTypeTableIndex], &returnSize, &nc_vx[0], &nc_vy[0],
-                      &xyBounds[0], &errorCode);
-
-      for (int i = 0; i < returnSize; ++i) {
-        if (xyBounds[i] == EOS_OK)
-          continue;
-        outputString << "\tThe specific extrapolation error for entry "
-                     << "i = " << i << " is: ";
-        if (xyBounds[i] == EOS_xHi_yHi)
-          outputString << "\"Both the x and y arguments were high.\"";
-        if (xyBounds[i] == EOS_xHi_yOk)
-          outputString << "\"The x argument was high.\"";
-        if (xyBounds[i] == EOS_xHi_yLo)
-          outputString << "\"The x argument was high, the y argument was low.\"";
-        if (xyBounds[i] == EOS_xOk_yLo)
-          outputString << "\"The y argument was low.\"";
-        if (xyBounds[i] == EOS_xLo_yLo)
-          outputString << "\"The x argument was low, the y argument was low.\"";
-        if (xyBounds[i] == EOS_xLo_yOk)
-          outputString << "\"The x argument was low.\"";
-        if (xyBounds[i] == EOS_xLo_yHi)
-          outputString << "\"The x argument was low, the y argument was high\"";
-        if (xyBounds[i] == EOS_xOk_yHi)
-          outputString << "\"The y argument was high\"";
-        outputString << "\t(x,y) = ( " << nc_vx[0] << ", " << nc_vy[0] << " )\n";
-      }
+//------------------------------------------------------------------------------------------------//
+void Eospac::throwInterpolateError(unsigned const index, EOS_INTEGER const returnType,
+                                   EOS_INTEGER returnSize, double *const x, double *const y,
+                                   EOS_INTEGER errorCode) const {
+  std::ostringstream outputString;
+  std::array<EOS_CHAR, EOS_MaxErrMsgLen> errorMessage{};
+  eos_GetErrorMessage(&errorCode, errorMessage.data());
+
+  outputString << "\n\tAn unsuccessful request for EOSPAC data was made by eos_Interpolate() "
+               << "from within interpolate().\n\tThe requested returnType was \"" << returnType
+               << "\" (see eos_Interface.h for type)\n\tThe error code returned was \""
+               << errorCode << "\".\n\tThe associated error message is:\n\t\""
+               << std::string(errorMessage.data()) << "\"\n";
+
+  if (errorCode == EOS_INTERP_EXTRAPOLATED) {
+    // If the EOS_INTERP_EXTRAPOLATED error code is returned by either eos_Interpolate or eos_Mix,
+    // then the eos_CheckExtrap routine allows the user to determine which (x,y) pairs caused
+    // extrapolation and in which direction (high or low), it occurred. The units of the xVals,
+    // and yVals arguments listed below are determined by the units listed for each tableType in
+    // APPENDIX B and APPENDIX C.
+
+    std::vector<EOS_INTEGER> xyBounds(returnSize);
+
+    eos_CheckExtrap(&tableHandles[index], &returnSize, x, y, &xyBounds[0], &errorCode);
+
+    for (int i = 0; i < returnSize; ++i) {
+      if (xyBounds[i] == EOS_OK)
+        continue;
+      outputString << "\tThe specific extrapolation error for entry "
+                   << "i = " << i << " is: ";
+      if (xyBounds[i] == EOS_xHi_yHi)
+        outputString << "\"Both the x and y arguments were high.\"";
+      if (xyBounds[i] == EOS_xHi_yOk)
+        outputString << "\"The x argument was high.\"";
+      if (xyBounds[i] == EOS_xHi_yLo)
+        outputString << "\"The x argument was high, the y argument was low.\"";
+      if (xyBounds[i] == EOS_xOk_yLo)
+        outputString << "\"The y argument was low.\"";
+      if (xyBounds[i] == EOS_xLo_yLo)
+        outputString << "\"The x argument was low, the y argument was low.\"";
+      if (xyBounds[i] == EOS_xLo_yOk)
+        outputString << "\"The x argument was low.\"";
+      if (xyBounds[i] == EOS_xLo_yHi)
+        outputString << "\"The x argument was low, the y argument was high\"";
+      if (xyBounds[i] == EOS_xOk_yHi)
+        outputString << "\"The y argument was high\"";
+      outputString << "\t(x,y) = ( " << x[i] << ", " << y[i] << " )\n";
     }
-
-    // This is a fatal exception right now.  It might be useful to throw a specific exception that
-    // is derived from EospacException.  The host code could theoretically catch such an exception,
-    // fix the problem and then continue.
-    throw EospacException(outputString.str());
   }
 
-  switch (etdd) {
-  case ETDD_VALUE: {
-    break;
-  } // return returnVals
-  case ETDD_DFDX: {
-    returnVals = dFx;
-    break;
-  }
-  case ETDD_DFDY: {
-    returnVals = dFy;
-    break;
-  }
-  default: {
-    Insist(etdd == ETDD_VALUE || etdd == ETDD_DFDX || etdd == ETDD_DFDY,
-           "Bad value for EosTableDataDerivative.");
-  }
-  }
-  return returnVals;
+  // This is a fatal exception right now.  It might be useful to throw a specific exception that
+  // is derived from EospacException.  The host code could theoretically catch such an exception,
+  // fix the problem and then continue.
+  throw EospacException(outputString.str());
 }
 
 //------------------------------------------------------------------------------------------------//
@@ -523,8 +608,8 @@ unsigned Eospac::tableIndex(EOS_INTEGER returnType) const {
   // Throw an exception if the required return type has not been loaded by Eospac.
   if (!typeFound(returnType)) {
     std::ostringstream outputString;
-    outputString << "\n\tA request was made for data by getF() for which EOSPAC does not have an\n"
-                 << "\tassociated material identifier.\n\tRequested returnType = \""
+    outputString << "\n\tA request was made for data by interpolate() for which EOSPAC does not "
+                 << "have an\n\tassociated material identifier.\n\tRequested returnType = \""
                  << SesTabs.tableName[returnType] << " (" << SesTabs.tableDescription[returnType]
                  << ")\"\n";
     throw EospacUnknownDataType(outputString.str());
@@ -324,6 +324,76 @@ public:
   double getIonTemperature(double density, double SpecificIonInternalEnergy,
                            double Tguess = 1.0) const override;
 
+  // ----------------- //
+  // Batched accessors //
+  // ----------------- //
+
+  // Each of these evaluates n cells of this material with a single eos_Interpolate call.  Results
+  // are written to caller-provided arrays (which may alias the inputs) and the EOSPAC arguments are
+  // staged in per-thread scratch buffers that are reused from call to call, so no memory is
+  // allocated once a thread's buffers have grown to n entries.
+
+  /*!
+   * \brief Retrieve specific electron internal energies and, optionally, electron heat capacities.
+   *
+   * \param[in]  n            Number of cells.
+   * \param[in]  temperature  Temperatures in keV (size n).
+   * \param[in]  density      Densities in g/cm^3 (size n).
+   * \param[out] energy       Specific electron internal energies in kJ/g (size n).
+   * \param[out] heatCapacity If not null, electron heat capacities in kJ/g/keV (size n).
+   */
+  void getSpecificElectronInternalEnergy(size_t const n, double const *const temperature,
+                                         double const *const density, double *const energy,
+                                         double *const heatCapacity = nullptr) const;
+
+  /*!
+   * \brief Retrieve specific ion internal energies and, optionally, ion heat capacities.
+   *
+   * \param[in]  n            Number of cells.
+   * \param[in]  temperature  Temperatures in keV (size n).
+   * \param[in]  density      Densities in g/cm^3 (size n).
+   * \param[out] energy       Specific ion internal energies in kJ/g (size n).
+   * \param[out] heatCapacity If not null, ion heat capacities in kJ/g/keV (size n).
+   */
+  void getSpecificIonInternalEnergy(size_t const n, double const *const temperature,
+                                    double const *const density, double *const energy,
+                                    double *const heatCapacity = nullptr) const;
+
+  //! Retrieve the number of free electrons per ion for n (temperature [keV], density) cells.
+  void getNumFreeElectronsPerIon(size_t const n, double const *const temperature,
+                                 double const *const density, double *const nfree) const;
+
+  //! Retrieve electron thermal conductivities (1/s/cm) for n (temperature [keV], density) cells.
+  void getElectronThermalConductivity(size_t const n, double const *const temperature,
+                                      double const *const density, double *const chie) const;
+
+  /*!
+   * \brief Retrieve electron temperatures and, optionally, their derivatives with respect to the
+   *        specific electron internal energy.
+   *
+   * \param[in]  n           Number of cells.
+   * \param[in]  density     Densities in g/cm^3 (size n).
+   * \param[in]  energy      Specific electron internal energies in kJ/g (size n).
+   * \param[out] temperature Electron temperatures in keV (size n).
+   * \param[out] dTdU        If not null, dTe/dUe in keV/(kJ/g) (size n).
+   */
+  void getElectronTemperature(size_t const n, double const *const density,
+                              double const *const energy, double *const temperature,
+                              double *const dTdU = nullptr) const;
+
+  /*!
+   * \brief Retrieve ion temperatures and, optionally, their derivatives with respect to the
+   *        specific ion internal energy.
+   *
+   * \param[in]  n           Number of cells.
+   * \param[in]  density     Densities in g/cm^3 (size n).
+   * \param[in]  energy      Specific ion internal energies in kJ/g (size n).
+   * \param[out] temperature Ion temperatures in keV (size n).
+   * \param[out] dTdU        If not null, dTi/dUi in keV/(kJ/g) (size n).
+   */
+  void getIonTemperature(size_t const n, double const *const density, double const *const energy,
+                         double *const temperature, double *const dTdU = nullptr) const;
+
   /*!
    * \brief Interface for packing a derived EoS object.
    *
@@ -342,18 +412,40 @@ private:
    * \brief Retrieves the EoS data associated with the returnType specified and the given (density,
    *        temperature) tuples.
    *
-   * Each of the public access functions calls either getF() or getdFdT() after assigning the
-   * correct value to "returnType".
+   * The vector access functions call getF() after assigning the correct value to "returnType".
    *
    * \param vdensity A vector of independent values (e.g. temperature or density).
    * \param vtemperature A vector of independent values (e.g. temperature or density).
    * \param returnType The integer index that corresponds to the type of data being retrieved from
    *           the EoS tables.
    * \param etdd Eos Table Derivative
+   * \param yScale Factor applied to vtemperature before the lookup (e.g. keV2K(1.0)).
    */
   std::vector<double> getF(std::vector<double> const &vdensity,
                            std::vector<double> const &vtemperature, EOS_INTEGER const returnType,
-                           EosTableDataDerivative const etdd) const;
+                           EosTableDataDerivative const etdd, double const yScale = 1.0) const;
+
+  /*!
+   * \brief Interpolate the table for returnType at n (density, y) tuples with one eos_Interpolate
+   *        call, staging the arguments in this thread's scratch buffers.
+   *
+   * \param[in]  returnType EOSPAC table type.
+   * \param[in]  n          Number of tuples.
+   * \param[in]  density    Densities (the EOSPAC x values, size n).
+   * \param[in]  y          Temperatures or energies (size n), scaled by yScale before the lookup.
+   * \param[in]  yScale     Unit conversion for y (keV2K(1.0) for temperatures in keV).
+   * \param[out] value      Table values (size n, may alias the inputs).
+   * \param[out] dFdx       If not null, derivatives with respect to density (size n).
+   * \param[out] dFdy       If not null, derivatives with respect to scaled y (size n).
+   */
+  void interpolate(EOS_INTEGER const returnType, size_t const n, double const *const density,
+                   double const *const y, double const yScale, double *const value,
+                   double *const dFdx, double *const dFdy) const;
+
+  //! Throw an EospacException that describes a failed eos_Interpolate call.
+  [[noreturn]] void throwInterpolateError(unsigned const index, EOS_INTEGER const returnType,
+                                          EOS_INTEGER returnSize, double *const x, double *const y,
+                                          EOS_INTEGER errorCode) const;
 
   /*!
    * \brief This member function examines the contents of the data member "SesTabs" and then calls
@@ -375,9 +467,6 @@ private:
   //! Initialize descriptions of available table info items
   static std::vector<std::string> initializeInfoItemDescriptions();
 
-  //! Converts a double to a length one vector.
-  static inline std::vector<double> dbl_v1(double const dbl) { return {dbl}; }
-
   /*!
    * \brief keV2K converts keV temperatures into degrees Kelvin.  libeospac.a requires input
    *        temperatures to use degrees Kelvin.
@@ -386,7 +475,7 @@ private:
    *
    * keV2K = 1.1604412e+7 Kelvin/keV
    *
-   * This is only used in getF() and getdFdT().
+   * Temperatures are converted on their way into interpolate().
    */
   static inline double keV2K(double tempKeV) {
     const double c = 1.1604412E+7; // Kelvin per keV
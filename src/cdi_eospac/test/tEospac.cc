@@ -436,6 +436,83 @@ void cdi_eospac_tpack(rtt_dsxx::UnitTest &ut) {
   return;
 }
 
+//------------------------------------------------------------------------------------------------//
+//! Compare the batched accessors with the scalar and vector forms.
+void cdi_eospac_batched(rtt_dsxx::UnitTest &ut) {
+  std::cout << "\nTest the batched accessors for cdi_eospac.\n" << std::endl;
+
+  int const Al3717 = 3717;
+  int const Al23714 = 23714;
+  rtt_cdi_eospac::SesameTables AlSt;
+  AlSt.Ue_DT(Al3717).Uic_DT(Al3717).Zfc_DT(Al23714).Ktc_DT(Al23714);
+  AlSt.T_DUe(Al3717).T_DUic(Al3717);
+  rtt_cdi_eospac::Eospac const eos(AlSt);
+
+  // Distinct (density, temperature) tuples so that a misaligned result would be noticed.
+  size_t const n = 64;
+  std::vector<double> T(n);
+  std::vector<double> rho(n);
+  for (size_t i = 0; i < n; ++i) {
+    T[i] = 0.05 + 0.01 * static_cast<double>(i);   // keV
+    rho[i] = 1.0 + 0.1 * static_cast<double>(n - i); // g/cm^3
+  }
+  double const tol(1.0e-12);
+
+  std::vector<double> Ue(n);
+  std::vector<double> Cve(n);
+  std::vector<double> Ui(n);
+  std::vector<double> Cvi(n);
+  std::vector<double> nfree(n);
+  std::vector<double> chie(n);
+  eos.getSpecificElectronInternalEnergy(n, T.data(), rho.data(), Ue.data(), Cve.data());
+  eos.getSpecificIonInternalEnergy(n, T.data(), rho.data(), Ui.data(), Cvi.data());
+  eos.getNumFreeElectronsPerIon(n, T.data(), rho.data(), nfree.data());
+  eos.getElectronThermalConductivity(n, T.data(), rho.data(), chie.data());
+
+  bool scalar_ok(true);
+  for (size_t i = 0; i < n; ++i) {
+    scalar_ok = scalar_ok && soft_equiv(Ue[i], eos.getSpecificElectronInternalEnergy(T[i], rho[i]),
+                                        tol);
+    scalar_ok = scalar_ok && soft_equiv(Cve[i], eos.getElectronHeatCapacity(T[i], rho[i]), tol);
+    scalar_ok = scalar_ok && soft_equiv(Ui[i], eos.getSpecificIonInternalEnergy(T[i], rho[i]), tol);
+    scalar_ok = scalar_ok && soft_equiv(Cvi[i], eos.getIonHeatCapacity(T[i], rho[i]), tol);
+    scalar_ok = scalar_ok && soft_equiv(nfree[i], eos.getNumFreeElectronsPerIon(T[i], rho[i]), tol);
+    scalar_ok =
+        scalar_ok && soft_equiv(chie[i], eos.getElectronThermalConductivity(T[i], rho[i]), tol);
+  }
+  FAIL_IF_NOT(scalar_ok);
+
+  // The vector forms agree too (getSpecificIonInternalEnergy used to skip the keV to K conversion).
+  std::vector<double> const vUi = eos.getSpecificIonInternalEnergy(T, rho);
+  std::vector<double> const vCve = eos.getElectronHeatCapacity(T, rho);
+  FAIL_IF_NOT(soft_equiv(vUi.begin(), vUi.end(), Ui.begin(), Ui.end(), tol));
+  FAIL_IF_NOT(soft_equiv(vCve.begin(), vCve.end(), Cve.begin(), Cve.end(), tol));
+
+  // Invert the energies; the temperatures should be recovered and dT/dU = 1/Cv.
+  std::vector<double> Te(n);
+  std::vector<double> dTedUe(n);
+  std::vector<double> Ti(n);
+  eos.getElectronTemperature(n, rho.data(), Ue.data(), Te.data(), dTedUe.data());
+  eos.getIonTemperature(n, rho.data(), Ui.data(), Ti.data());
+  bool inverse_ok(true);
+  for (size_t i = 0; i < n; ++i) {
+    inverse_ok = inverse_ok && soft_equiv(Te[i], eos.getElectronTemperature(rho[i], Ue[i]), tol);
+    inverse_ok = inverse_ok && soft_equiv(Ti[i], eos.getIonTemperature(rho[i], Ui[i]), tol);
+    inverse_ok = inverse_ok && soft_equiv(Te[i], T[i], 1.0e-2);
+    inverse_ok = inverse_ok && soft_equiv(dTedUe[i] * Cve[i], 1.0, 1.0e-1);
+  }
+  FAIL_IF_NOT(inverse_ok);
+
+  // Outputs may overwrite the inputs, and empty batches are allowed.
+  std::vector<double> inPlace(T);
+  eos.getNumFreeElectronsPerIon(n, inPlace.data(), rho.data(), inPlace.data());
+  FAIL_IF_NOT(soft_equiv(inPlace.begin(), inPlace.end(), nfree.begin(), nfree.end(), tol));
+  eos.getNumFreeElectronsPerIon(0, nullptr, nullptr, nullptr);
+
+  if (ut.numFails == 0)
+    PASSMSG("Batched Eospac accessors match the scalar forms.");
+}
+
 } // end of namespace rtt_cdi_eospac_test
 
 //------------------------------------------------------------------------------------------------//
@@ -446,6 +523,7 @@ int main(int argc, char *argv[]) {
     rtt_cdi_eospac_test::cdi_eospac_test(ut);
     rtt_cdi_eospac_test::cdi_eospac_except_test(ut);
     rtt_cdi_eospac_test::cdi_eospac_tpack(ut);
+    rtt_cdi_eospac_test::cdi_eospac_batched(ut);
   }
   UT_EPILOG(ut);
 }
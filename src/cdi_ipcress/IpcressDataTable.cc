@@ -12,6 +12,7 @@
 #include "IpcressFile.hh"
 #include "cdi/OpacityCommon.hh"
 #include "ds++/Assert.hh"
+#include <algorithm>
 #include <cmath> // we need to define log(double)
 
 // ------------------------- //
@@ -50,34 +51,39 @@ double unary_log(double x) { return std::log(x); }
  *     GanolfFile object should exist for each IPCRESS file.  Many
  *     IpcressOpacity (and thus IpcressDataTable) objects may point to the
  *     same IpcressFile object.
+ * \param storage Where the opacity table is held.  Table_Storage::node_shared keeps one copy per
+ *     shared-memory node and makes this constructor collective over rtt_c4::communicator; such
+ *     tables are loaded immediately, other tables on first use.
  */
 IpcressDataTable::IpcressDataTable(std::string in_opacityEnergyDescriptor,
                                    rtt_cdi::Model in_opacityModel,
                                    rtt_cdi::Reaction in_opacityReaction,
                                    std::vector<std::string> const &in_fieldNames, size_t in_matID,
-                                   std::shared_ptr<const IpcressFile> const &spIpcressFile)
+                                   std::shared_ptr<const IpcressFile> const &in_spIpcressFile,
+                                   rtt_c4::Table_Storage in_storage)
     : ipcressDataTypeKey(""), dataDescriptor(""),
       opacityEnergyDescriptor(std::move(in_opacityEnergyDescriptor)), opacityModel(in_opacityModel),
       opacityReaction(in_opacityReaction), fieldNames(in_fieldNames), matID(in_matID),
       logTemperatures(), temperatures(), logDensities(), densities(), groupBoundaries(),
-      logOpacities() {
+      logOpacities(), spIpcressFile(in_spIpcressFile), storage(in_storage) {
   // Obtain the Ipcress keyword for the opacity data type specified by the
   // EnergyPolicy, opacityModel and the opacityReaction.  Valid keywords are:
   // {ramg, rsmg, rtmg, pmg, rgray, ragray, rsgray, pgray} This function also
   // ensures that the requested data type is available in the IPCRESS file.
   setIpcressDataTypeKey();
 
-  // Retrieve the data set and resize the vector containers.
-  temperatures = spIpcressFile->getData(matID, "tgrid");
-  densities = spIpcressFile->getData(matID, "rgrid");
-  groupBoundaries = spIpcressFile->getData(matID, "hnugrid");
-
-  // Retrieve table data (temperatures, densities, group boundaries and
-  // opacities.  These are stored as logorithmic values.
-  loadDataTable(spIpcressFile);
+  // Collective loads cannot wait for the first (rank-local) use of the table.
+  if (storage == rtt_c4::Table_Storage::node_shared)
+    load();
 
 } // end of IpcressDataTable constructor.
 
+//------------------------------------------------------------------------------------------------//
+IpcressDataTable::~IpcressDataTable() {
+  if (auto const file = budgetFile.lock())
+    file->removeTableBytes(tableBytes);
+}
+
 // ----------------- //
 // PRIVATE FUNCTIONS //
 // ----------------- //
@@ -182,7 +188,14 @@ void IpcressDataTable::setIpcressDataTypeKey() const {
  *     tables from the IPCRESS file.  Convert all tables (except energy
  *     boundaries) to log values.
  */
-void IpcressDataTable::loadDataTable(std::shared_ptr<const IpcressFile> const &spIpcressFile) {
+void IpcressDataTable::loadDataTable() const {
+  Require(spIpcressFile);
+
+  // Retrieve the data set and resize the vector containers.
+  temperatures = spIpcressFile->getData(matID, "tgrid");
+  densities = spIpcressFile->getData(matID, "rgrid");
+  groupBoundaries = spIpcressFile->getData(matID, "hnugrid");
+
   // The interpolation routines expect everything to be in log form so we only
   // store the logorithmic temperature, density and opacity data.
   logTemperatures.resize(temperatures.size());
@@ -190,9 +203,35 @@ void IpcressDataTable::loadDataTable(std::shared_ptr<const IpcressFile> const &s
   logDensities.resize(densities.size());
   std::transform(densities.begin(), densities.end(), logDensities.begin(), unary_log);
 
+  // Uniform log grids can be bracketed without a search.
+  auto const inverseUniformSpacing = [](std::vector<double> const &logGrid) {
+    size_t const n = logGrid.size();
+    if (n < 2)
+      return 0.0;
+    double const dx = (logGrid[n - 1] - logGrid[0]) / static_cast<double>(n - 1);
+    if (!(dx > 0.0))
+      return 0.0;
+    for (size_t i = 0; i + 1 < n; ++i)
+      if (std::abs(logGrid[i + 1] - logGrid[i] - dx) > 1.0e-8 * dx)
+        return 0.0;
+    return 1.0 / dx;
+  };
+  logTemperatureInvSpacing = inverseUniformSpacing(logTemperatures);
+  logDensityInvSpacing = inverseUniformSpacing(logDensities);
+
   std::vector<double> opacities = spIpcressFile->getData(matID, ipcressDataTypeKey);
-  logOpacities.resize(opacities.size());
-  std::transform(opacities.begin(), opacities.end(), logOpacities.begin(), unary_log);
+  logOpacities = rtt_c4::Node_Shared_Table<double>(opacities.size(), storage);
+  logOpacities.fill([&opacities](double *logOpac) {
+    std::transform(opacities.begin(), opacities.end(), logOpac, unary_log);
+  });
+
+  // The tables are complete; count them against the file's cache budget and release the file.
+  tableBytes = (logTemperatures.size() + temperatures.size() + logDensities.size() +
+                densities.size() + groupBoundaries.size() + logOpacities.size()) *
+               sizeof(double);
+  spIpcressFile->addTableBytes(tableBytes);
+  budgetFile = spIpcressFile;
+  spIpcressFile.reset();
 }
 
 //------------------------------------------------------------------------------------------------//
@@ -212,117 +251,187 @@ bool IpcressDataTable::key_available(T const &key, std::vector<T> const &keys) c
 
 //------------------------------------------------------------------------------------------------//
 /*!
- * \brief Calculate and return an interpolated opacity value.
+ * \brief Find the lower bracketing index of a value in a log grid.
  *
- * \param[in] targetTemperature
- * \param[in] targetDensity
- * \param[in] group Group index
- * \return An interpolated opacity value.
+ * Returns the largest i with logGrid[i] <= logx (0 if logx is below the grid).  For a value that
+ * has been clamped to the grid this is the interval [logGrid[i], logGrid[i+1]) that contains logx,
+ * or the last grid index when logx equals the last grid value.
  *
- * \note The opacity array is a 1D array.  group id is the fastest moving index
- *       and temperatures are the slowest moving index.
+ * When the grid is uniform (invSpacing > 0) the index is computed directly and then corrected by
+ * at most a step for round-off; otherwise a binary search is used.
+ *
+ * \param[in] logx value to bracket
+ * \param[in] logGrid monotonically increasing grid
+ * \param[in] invSpacing inverse grid spacing for uniform grids, zero otherwise
+ * \return lower bracketing index
  */
-double IpcressDataTable::interpOpac(double const targetTemperature, double const targetDensity,
-                                    size_t const group) const {
-  double logT = std::log(targetTemperature);
-  double logrho = std::log(targetDensity);
+size_t IpcressDataTable::bracket(double const logx, std::vector<double> const &logGrid,
+                                 double const invSpacing) {
+  size_t const n = logGrid.size();
+  Check(n > 1);
+  if (invSpacing > 0.0) {
+    double const x = (logx - logGrid[0]) * invSpacing;
+    size_t i = x > 0.0 ? std::min(static_cast<size_t>(x), n - 1) : 0;
+    while (i + 1 < n && logGrid[i + 1] <= logx)
+      ++i;
+    while (i > 0 && logGrid[i] > logx)
+      --i;
+    return i;
+  }
+  auto const upper = std::upper_bound(logGrid.begin(), logGrid.end(), logx);
+  return upper == logGrid.begin() ? 0 : static_cast<size_t>(upper - logGrid.begin()) - 1;
+}
 
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Locate a (T, rho) point in the table.
+ *
+ * We don't allow extrapolation, so the target temperature and density are moved to the table
+ * boundary when they are off the table.  The interpolation fractions are zero when the point is
+ * on the high side of the table.
+ *
+ * \param[in] targetTemperature
+ * \param[in] targetDensity
+ * \param[out] iT lower bracketing temperature index
+ * \param[out] irho lower bracketing density index
+ * \param[out] fracT interpolation fraction in log(T)
+ * \param[out] fracRho interpolation fraction in log(rho)
+ */
+void IpcressDataTable::locate(double const targetTemperature, double const targetDensity,
+                              size_t &iT, size_t &irho, double &fracT, double &fracRho) const {
   size_t const numrho = logDensities.size();
   size_t const numT = logTemperatures.size();
-  size_t const ng = opacityEnergyDescriptor == std::string("gray") ? 1 : groupBoundaries.size() - 1;
-
-  // Check if we are off the table boundaries.  We don't allow extrapolation,
-  // so move the target temperature or density to the table boundary.
   Check(numT > 1);
   Check(numrho > 1);
-  if (targetTemperature < temperatures[0])
-    logT = std::log(temperatures[0]);
-  if (targetTemperature > temperatures[numT - 1])
-    logT = std::log(temperatures[numT - 1]);
-  if (targetDensity < densities[0])
-    logrho = std::log(densities[0]);
-  if (targetDensity > densities[numrho - 1])
-    logrho = std::log(densities[numrho - 1]);
-
-  /*
-   * The grid looks like this:
-   *
-   *      |   T1     |   T      |   T2
-   * -----------------------------------------
-   * rho1 |   sig11  |          |   sig13
-   * -----------------------------------------
-   * rho  |   sig21  |  sig22   |   sig23
-   * -----------------------------------------
-   * rho2 |   sig31  |          |   sig33
-   *
-   * - rho1, rho2, T1 and T2 are table values.
-   * - sig11, sig13, sig31 and sig33 are table values.
-   *
-   * Use linear interploation wrt log(rho) to find sig21 and sig23, then use
-   * linear interpolation wrt log(T) to find sig22.
-   */
+
+  // The table grids are stored as logs, so only in-table values need a call to log().
+  double const logT = targetTemperature < temperatures[0]         ? logTemperatures[0]
+                      : targetTemperature > temperatures[numT - 1] ? logTemperatures[numT - 1]
+                                                                   : std::log(targetTemperature);
+  double const logrho = targetDensity < densities[0]           ? logDensities[0]
+                        : targetDensity > densities[numrho - 1] ? logDensities[numrho - 1]
+                                                                : std::log(targetDensity);
 
   // Find the bracketing table values (T1, T2) and (rho1, rho2) for rho and T.
-  size_t irho = logDensities.size() - 1;
-  size_t iT = logTemperatures.size() - 1;
-  for (size_t i = 0; i < numT - 1; ++i) {
-    if (logT >= logTemperatures[i] && logT < logTemperatures[i + 1]) {
-      iT = i;
-      break;
-    }
-  }
-  for (size_t i = 0; i < numrho - 1; ++i) {
-    if (logrho >= logDensities[i] && logrho < logDensities[i + 1]) {
-      irho = i;
-      break;
-    }
-  }
+  iT = bracket(logT, logTemperatures, logTemperatureInvSpacing);
+  irho = bracket(logrho, logDensities, logDensityInvSpacing);
+
+  fracT = iT + 1 < numT ? (logT - logTemperatures[iT]) /
+                              (logTemperatures[iT + 1] - logTemperatures[iT])
+                        : 0.0;
+  fracRho = irho + 1 < numrho
+                ? (logrho - logDensities[irho]) / (logDensities[irho + 1] - logDensities[irho])
+                : 0.0;
+}
 
-  // Perform the linear interpolation.
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Interpolate log(opacity) for one group at a located (T, rho) point.
+ *
+ * The grid looks like this:
+ *
+ * \verbatim
+ *      |   T1     |   T      |   T2
+ * -----------------------------------------
+ * rho1 |   sig11  |          |   sig13
+ * -----------------------------------------
+ * rho  |   sig21  |  sig22   |   sig23
+ * -----------------------------------------
+ * rho2 |   sig31  |          |   sig33
+ * \endverbatim
+ *
+ * - rho1, rho2, T1 and T2 are table values.
+ * - sig11, sig13, sig31 and sig33 are table values.
+ *
+ * Use linear interploation wrt log(rho) to find sig21 and sig23, then use linear interpolation wrt
+ * log(T) to find sig22.
+ *
+ * \param[in] iT lower bracketing temperature index
+ * \param[in] irho lower bracketing density index
+ * \param[in] fracT interpolation fraction in log(T)
+ * \param[in] fracRho interpolation fraction in log(rho)
+ * \param[in] ng number of opacity values per (T, rho) table entry
+ * \param[in] group Group index
+ * \return An interpolated log(opacity) value.
+ *
+ * \note The opacity array is a 1D array.  group id is the fastest moving index and temperatures are
+ *       the slowest moving index.
+ */
+double IpcressDataTable::interpLogOpac(size_t const iT, size_t const irho, double const fracT,
+                                       double const fracRho, size_t const ng,
+                                       size_t const group) const {
+  size_t const numrho = logDensities.size();
+  size_t const numT = logTemperatures.size();
 
   // index of cell with lower T and lower rho bound
-  size_t i = (iT * numrho + irho) * ng + group;
-  size_t k = i + ng * numrho; // index for cell with higher T value
+  size_t const i = (iT * numrho + irho) * ng + group;
+  size_t const k = i + ng * numrho; // index for cell with higher T value
 
-  // If we are on the edge of the opacity table, return the edge values.  So
-  // there are 4 cases:
-  double logOpacity(0.0);
+  // If we are on the edge of the opacity table, return the edge values.  So there are 4 cases:
 
   // 1. Normal path
   if (irho + 1 < numrho && iT + 1 < numT) {
-    double logsig12 = logOpacities[i] + (logrho - logDensities[irho]) /
-                                            (logDensities[irho + 1] - logDensities[irho]) *
-                                            (logOpacities[i + ng] - logOpacities[i]);
-
-    double logsig32 = logOpacities[k] + (logrho - logDensities[irho]) /
-                                            (logDensities[irho + 1] - logDensities[irho]) *
-                                            (logOpacities[k + ng] - logOpacities[k]);
-
-    logOpacity = logsig12 + (logT - logTemperatures[iT]) /
-                                (logTemperatures[iT + 1] - logTemperatures[iT]) *
-                                (logsig32 - logsig12);
+    double const logsig12 = logOpacities[i] + fracRho * (logOpacities[i + ng] - logOpacities[i]);
+    double const logsig32 = logOpacities[k] + fracRho * (logOpacities[k + ng] - logOpacities[k]);
+    return logsig12 + fracT * (logsig32 - logsig12);
   }
 
   // 2. rho is at high side of table, T is in the table
-  else if (irho + 1 >= numrho && iT + 1 < numT) {
-    logOpacity = logOpacities[i] + (logT - logTemperatures[iT]) /
-                                       (logTemperatures[iT + 1] - logTemperatures[iT]) *
-                                       (logOpacities[k] - logOpacities[i]);
-  }
+  if (iT + 1 < numT)
+    return logOpacities[i] + fracT * (logOpacities[k] - logOpacities[i]);
 
   // 3. T is at high side of table, rho is in the table
-  else if (irho + 1 < numrho && iT + 1 >= numT) {
-    logOpacity = logOpacities[i] + (logrho - logDensities[irho]) /
-                                       (logDensities[irho + 1] - logDensities[irho]) *
-                                       (logOpacities[i + ng] - logOpacities[i]);
-  }
+  if (irho + 1 < numrho)
+    return logOpacities[i] + fracRho * (logOpacities[i + ng] - logOpacities[i]);
 
   // 4. Both T and rho are on the high side of the table.
-  else if (irho + 1 >= numrho && iT + 1 >= numT) {
-    logOpacity = logOpacities[i];
-  }
+  return logOpacities[i];
+}
 
-  return std::exp(logOpacity);
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Calculate and return an interpolated opacity value.
+ *
+ * \param[in] targetTemperature
+ * \param[in] targetDensity
+ * \param[in] group Group index
+ * \return An interpolated opacity value.
+ */
+double IpcressDataTable::interpOpac(double const targetTemperature, double const targetDensity,
+                                    size_t const group) const {
+  load();
+  size_t iT(0), irho(0);
+  double fracT(0.0), fracRho(0.0);
+  locate(targetTemperature, targetDensity, iT, irho, fracT, fracRho);
+  return std::exp(interpLogOpac(iT, irho, fracT, fracRho, getNumOpacityValues(), group));
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Interpolate the opacities of all groups for a batch of (T, rho) points.
+ *
+ * Each point is located in the table once and the bracketing indices and interpolation fractions
+ * are shared by all of its groups.  The results are identical to calling interpOpac(T, rho, g) for
+ * every point and group.
+ *
+ * \param[in] numPoints number of (T, rho) points
+ * \param[in] T temperatures [numPoints]
+ * \param[in] rho densities [numPoints]
+ * \param[out] opacities interpolated opacities [numPoints][getNumOpacityValues()]
+ */
+void IpcressDataTable::interpOpac(size_t const numPoints, double const *const T,
+                                  double const *const rho, double *const opacities) const {
+  Require(numPoints == 0 || (T != nullptr && rho != nullptr && opacities != nullptr));
+  load();
+  size_t const ng = getNumOpacityValues();
+  for (size_t p = 0; p < numPoints; ++p) {
+    size_t iT(0), irho(0);
+    double fracT(0.0), fracRho(0.0);
+    locate(T[p], rho[p], iT, irho, fracT, fracRho);
+    double *const opacity = opacities + p * ng;
+    for (size_t g = 0; g < ng; ++g)
+      opacity[g] = std::exp(interpLogOpac(iT, irho, fracT, fracRho, ng, g));
+  }
 }
 
 } // end namespace rtt_cdi_ipcress
@@ -12,8 +12,10 @@
 #define rtt_cdi_ipcress_IpcressDataTable_hh
 
 #include "IpcressFile.hh"
+#include "c4/Node_Shared_Table.hh"
 #include "cdi/OpacityCommon.hh"
 #include <memory>
+#include <mutex>
 
 namespace rtt_cdi_ipcress {
 
@@ -29,6 +31,12 @@ namespace rtt_cdi_ipcress {
  * that is loaded is specified by the combination of { opacityModel,
  * opacityReaction and the opacityEnergyDescriptor }.
  *
+ * The constructor only checks that the requested table exists.  The grids and the opacity table are
+ * read from the IpcressFile on first use (the first interpolation or grid query), so opacities
+ * created for materials that a run never touches cost no I/O and little memory.  Tables held in
+ * node-shared storage are read by the constructor because loading them is collective.  Once loaded,
+ * the tables count against the cache budget of the IpcressFile until this object is destroyed.
+ *
  * Additional data about keywords and the IPCRESS format is available in
  * - Judd, B., Fontes, C.J., and Zhang, H.L. Gandolf : Interface Routines for
  *   IPCRESS Files," Los Alamos Technical Report LA-UR-01-5543, 2001.
@@ -88,8 +96,29 @@ class IpcressDataTable {
   //! The energy group boundary grid for this data set.
   std::vector<double> mutable groupBoundaries;
 
-  //! The opacity data table.
-  std::vector<double> mutable logOpacities;
+  /*!
+   * \brief The opacity data table.  This is by far the largest member; it may be stored once per
+   *     shared-memory node (see rtt_c4::Node_Shared_Table). */
+  rtt_c4::Node_Shared_Table<double> mutable logOpacities;
+
+  /*!
+   * \brief Inverse spacing of the log temperature and log density grids when they are uniform
+   *     (zero otherwise).  Uniform grids are bracketed by a direct index computation. */
+  double mutable logTemperatureInvSpacing = 0.0;
+  double mutable logDensityInvSpacing = 0.0;
+
+  //! The file that the tables are read from; released once they are loaded.
+  std::shared_ptr<const IpcressFile> mutable spIpcressFile;
+
+  //! The file whose cache budget counts the loaded tables (tableBytes of them).
+  std::weak_ptr<const IpcressFile> mutable budgetFile;
+  size_t mutable tableBytes = 0;
+
+  //! Where the opacity table is held.
+  rtt_c4::Table_Storage const storage;
+
+  //! Guards the one-time load of the tables.
+  std::once_flag mutable tablesLoaded;
 
 public:
   // CREATORS
@@ -98,27 +127,49 @@ public:
   IpcressDataTable(std::string in_opacityEnergyDescriptor, rtt_cdi::Model in_opacityModel,
                    rtt_cdi::Reaction in_opacityReaction,
                    std::vector<std::string> const &in_fieldNames, size_t in_matID,
-                   std::shared_ptr<const IpcressFile> const &spIpcressFile);
+                   std::shared_ptr<const IpcressFile> const &spIpcressFile,
+                   rtt_c4::Table_Storage storage = rtt_c4::Table_Storage::heap);
+
+  //! Stop counting the tables against the file's cache budget.
+  ~IpcressDataTable();
 
   // ACCESSORS
 
   //! Retrieve the size of the temperature grid.
-  size_t getNumTemperatures() const { return temperatures.size(); }
+  size_t getNumTemperatures() const {
+    load();
+    return temperatures.size();
+  }
 
   //! Retrieve the size of the density grid.
-  size_t getNumDensities() const { return densities.size(); }
+  size_t getNumDensities() const {
+    load();
+    return densities.size();
+  }
 
   //! Retrieve the size of the energy boundary grid.
-  size_t getNumGroupBoundaries() const { return groupBoundaries.size(); }
+  size_t getNumGroupBoundaries() const {
+    load();
+    return groupBoundaries.size();
+  }
 
   //! Retrieve the logarithmic temperature grid.
-  std::vector<double> const &getTemperatures() const { return temperatures; }
+  std::vector<double> const &getTemperatures() const {
+    load();
+    return temperatures;
+  }
 
   //! Retrieve the logarithmic density grid.
-  std::vector<double> const &getDensities() const { return densities; }
+  std::vector<double> const &getDensities() const {
+    load();
+    return densities;
+  }
 
   //! Retrieve the energy boundary grid.
-  std::vector<double> const &getGroupBoundaries() const { return groupBoundaries; }
+  std::vector<double> const &getGroupBoundaries() const {
+    load();
+    return groupBoundaries;
+  }
 
   //! Return a "plain English" description of the data table.
   std::string const &getDataDescriptor() const { return dataDescriptor; }
@@ -126,6 +177,16 @@ public:
   //! Perform linear interploation of log(opacity) values.
   double interpOpac(double const T, double const rho, size_t const group = 0) const;
 
+  //! Interpolate the opacities of all groups for a batch of (T, rho) points.
+  void interpOpac(size_t const numPoints, double const *const T, double const *const rho,
+                  double *const opacities) const;
+
+  //! Retrieve the number of opacity values per (T, rho) point (1 for gray data).
+  size_t getNumOpacityValues() const {
+    load();
+    return opacityEnergyDescriptor == "gray" ? 1 : groupBoundaries.size() - 1;
+  }
+
 private:
   /*!
    * \brief This function sets both "ipcressDataTypeKey" and "dataDescriptor" based on the values
@@ -137,7 +198,24 @@ private:
    * \brief Load the temperature, density, energy boundary and opacity opacity tables from the
    *     IPCRESS file.  Convert all tables (except energy boundaries) to log values.
    */
-  void loadDataTable(std::shared_ptr<const IpcressFile> const &spIpcressFile);
+  void loadDataTable() const;
+
+  //! Load the tables on first use.
+  void load() const {
+    std::call_once(tablesLoaded, [this]() { loadDataTable(); });
+  }
+
+  //! Find the lower bracketing index of logx in a log grid.
+  static size_t bracket(double const logx, std::vector<double> const &logGrid,
+                        double const invSpacing);
+
+  //! Clamp (T, rho) to the table and find the bracketing indices and interpolation fractions.
+  void locate(double const T, double const rho, size_t &iT, size_t &irho, double &fracT,
+              double &fracRho) const;
+
+  //! Interpolate log(opacity) for one group at a located (T, rho) point.
+  double interpLogOpac(size_t const iT, size_t const irho, double const fracT,
+                       double const fracRho, size_t const ng, size_t const group) const;
 
   //! Search "keys" for "key".  If found return true, otherwise return false.
   template <typename T> bool key_available(const T &key, const std::vector<T> &keys) const;
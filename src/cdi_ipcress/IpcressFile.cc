@@ -11,9 +11,16 @@
 #include "IpcressFile.t.hh"
 #include "ds++/Assert.hh"
 #include "ds++/Endian.hh"
+#include <numeric>
 
 namespace rtt_cdi_ipcress {
 
+//! Records of a material separated by at most this many words are read with a single I/O.
+constexpr size_t max_read_gap_words = 512;
+
+//------------------------------------------------------------------------------------------------//
+constexpr size_t IpcressFile::defaultCacheBudget;
+
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief The standard IpcressFile constructor.
@@ -24,17 +31,22 @@ namespace rtt_cdi_ipcress {
  * \param[in] ipcressDataFilename A string that contains the name of the Ipcress data file in 
  *     IPCRESS format.  The f77 Ipcress vendor library expects a name with 80 characters or less. If
  *     the filename is longer than 80 characters the library will not be able to open the file.
+ * \param[in] cacheBudgetBytes Memory budget of the cache of material field data and of the tables
+ *     loaded from it.  Materials are read on first use and the least recently used ones are dropped
+ *     when the budget is exceeded.
  *
  * 1. Set some defaults (bytes per word, number of fields in the TOC).
  * 2. Try to open the file
  * 3. Load the title keys to verify that this is an ipcress file.
  * 4. Load the TOC.
+ * 5. Load the list of fields of each material (the field values are read on demand).
  */
-IpcressFile::IpcressFile(const std::string &ipcressDataFilename)
+IpcressFile::IpcressFile(const std::string &ipcressDataFilename, size_t cacheBudgetBytes)
     : dataFilename(locateIpcressFile(ipcressDataFilename)),
       ipcress_word_size(8),            // bytes per entry in file.
       ipcressFileHandle(), toc(24, 0), // 24 records in the table of contents
-      matIDs(), dfo(), ds(), materialData() {
+      matIDs(), dfo(), ds(), fieldRecords(), materialData(), cachedMaterials(),
+      cacheBudget(cacheBudgetBytes) {
 
   Require(rtt_dsxx::has_ieee_float_representation());
   Require(rtt_dsxx::fileExists(dataFilename));
@@ -112,14 +124,15 @@ IpcressFile::IpcressFile(const std::string &ipcressDataFilename)
 
   // Resize the list of material IDs.
   this->matIDs.resize(nummat);
+  this->fieldRecords.resize(nummat);
   this->materialData.resize(nummat);
 
   // Now read the list of material IDs.
   byte_offset = ipcress_word_size * (dfo[0] + 1);
   read_v(byte_offset, this->matIDs);
 
-  // Load the field data for each material and save to materialData[] vector.
-  this->loadFieldData();
+  // Load the list of fields for each material and their locations in the file.
+  this->loadFieldIndex();
 
   // Close the file
   ipcressFileHandle.close();
@@ -135,6 +148,99 @@ bool IpcressFile::materialFound(size_t matid) const {
   return std::find(matIDs.begin(), matIDs.end(), matid) != matIDs.end();
 }
 
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Provide a list of data field names for the requested material.
+ *
+ * \param[in] matid material identifier
+ */
+std::vector<std::string> IpcressFile::listDataFieldNames(size_t const matid) const {
+  Require(materialFound(matid));
+  std::vector<FieldRecord> const &records = fieldRecords[getMatIndex(matid)];
+  std::vector<std::string> names(records.size());
+  for (size_t i = 0; i < records.size(); ++i)
+    names[i] = records[i].name;
+  return names;
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Provide access to data arrays.
+ *
+ * The first request for any field of a material reads all of the material's fields from the file.
+ *
+ * \param[in] matid material identifier
+ * \param[in] fieldName name of the field (e.g.: tgrid, rtmg)
+ */
+std::vector<double> IpcressFile::getData(size_t const matid, std::string const &fieldName) const {
+  Require(materialFound(matid));
+  size_t const matidx = getMatIndex(matid);
+  std::lock_guard<std::mutex> lock(cacheMutex);
+  cacheMaterial(matidx);
+  return materialData[matidx].data(fieldName);
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Change the memory budget of the material cache.
+ *
+ * \param[in] cacheBudgetBytes New budget; cached materials are evicted (least recently used first)
+ *     until the cached data fits.
+ */
+void IpcressFile::setCacheBudget(size_t const cacheBudgetBytes) {
+  std::lock_guard<std::mutex> lock(cacheMutex);
+  cacheBudget = cacheBudgetBytes;
+  evictMaterials(0);
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Count the tables of an IpcressDataTable against the cache budget.
+ *
+ * Tables are not evicted; cached materials are dropped (least recently used first) until the
+ * material data and the counted tables fit the budget again.
+ *
+ * \param[in] bytes size of the tables held by the IpcressDataTable
+ */
+void IpcressFile::addTableBytes(size_t const bytes) const {
+  std::lock_guard<std::mutex> lock(cacheMutex);
+  tableBytes += bytes;
+  evictMaterials(0);
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Release bytes counted by addTableBytes when their IpcressDataTable is destroyed.
+ *
+ * \param[in] bytes value previously passed to addTableBytes
+ */
+void IpcressFile::removeTableBytes(size_t const bytes) const {
+  std::lock_guard<std::mutex> lock(cacheMutex);
+  Require(bytes <= tableBytes);
+  tableBytes -= bytes;
+}
+
+//------------------------------------------------------------------------------------------------//
+size_t IpcressFile::getTableBytes() const {
+  std::lock_guard<std::mutex> lock(cacheMutex);
+  return tableBytes;
+}
+
+//------------------------------------------------------------------------------------------------//
+size_t IpcressFile::getCachedBytes() const {
+  std::lock_guard<std::mutex> lock(cacheMutex);
+  return cachedBytes;
+}
+
+//------------------------------------------------------------------------------------------------//
+bool IpcressFile::isMaterialCached(size_t const matid) const {
+  Require(materialFound(matid));
+  size_t const matidx = getMatIndex(matid);
+  std::lock_guard<std::mutex> lock(cacheMutex);
+  return std::find(cachedMaterials.begin(), cachedMaterials.end(), matidx) !=
+         cachedMaterials.end();
+}
+
 //------------------------------------------------------------------------------------------------//
 std::string IpcressFile::locateIpcressFile(std::string const &ipcressFile) {
   std::string foundFile;
@@ -177,27 +283,23 @@ void IpcressFile::read_strings(size_t const byte_offset, std::vector<std::string
 }
 
 //------------------------------------------------------------------------------------------------//
-//! Populate the materialData member data container.
-void IpcressFile::loadFieldData() {
+//! Populate the fieldRecords member data container.
+void IpcressFile::loadFieldIndex() {
   // Attempt to open the ipcress file.
   Insist(ipcressFileHandle.is_open(), "getKeys: Unable to open ipcress file.");
 
   // number of fields for the material (trid, rgrid, ...)
   size_t const numFields(toc[14]);
 
-  // read the data from the file.  each entry is 24 bytes (3 words).
-  size_t byte_offset = toc[10] * ipcress_word_size;
-  // container for three 8-byte words.
-  std::vector<std::string> thirdofkey(3);
+  // Read the whole table of data fields at once.  Each entry is 9 words: three 24 byte keys, the
+  // material id and the field name are the first two.
+  std::vector<std::string> keys(9 * numFields);
+  read_strings(toc[10] * ipcress_word_size, keys);
 
   for (size_t i = 1; i < numFields; ++i) {
     // Note i=0 case is {'mats','fill',fill'}.  We skip this case by starting at
     // i=1.
-
-    // read three 8-byte words.
-    read_strings(byte_offset + 9 * i * ipcress_word_size, thirdofkey);
-    // store result into 'keys'
-    std::string field = thirdofkey[0] + thirdofkey[1] + thirdofkey[2];
+    std::string field = keys[9 * i] + keys[9 * i + 1] + keys[9 * i + 2];
 
     // find associated material index
     size_t id = atoi(field.c_str());
@@ -209,23 +311,83 @@ void IpcressFile::loadFieldData() {
         break;
       }
 
-    // read three 8-byte words.
-    read_strings(byte_offset + 3 * (3 * i + 1) * ipcress_word_size, thirdofkey);
-    // store result into 'keys'
-    field = thirdofkey[0] + thirdofkey[1] + thirdofkey[2];
+    field = keys[9 * i + 3] + keys[9 * i + 4] + keys[9 * i + 5];
 
-    // Read and save all values at this time.
-    std::vector<double> value(ds[i], 0);
-    read_v(dfo[i] * ipcress_word_size, value);
+    // Remove white space from the field name.
+    // NOTE: ::isspace forces the use of c namespace rather than std::isspace
+    field.erase(std::remove_if(field.begin(), field.end(), ::isspace), field.end());
 
-    materialData[matid].add_field(field, value);
+    // A field that is listed again replaces the earlier record.
+    std::vector<FieldRecord> &records = fieldRecords[matid];
+    auto itr = std::find_if(records.begin(), records.end(),
+                            [&field](FieldRecord const &r) { return r.name == field; });
+    if (itr == records.end())
+      records.push_back(FieldRecord{field, dfo[i], ds[i]});
+    else
+      *itr = FieldRecord{field, dfo[i], ds[i]};
+  }
+  return;
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Read all fields of one material.
+ *
+ * The records are sorted by disk address and records that are close together are merged into one
+ * sequential read, so a material usually costs a single seek.
+ *
+ * \param[in] matidx index of the material in matIDs
+ */
+void IpcressFile::loadMaterial(size_t const matidx) const {
+  std::vector<FieldRecord> const &records = fieldRecords[matidx];
+  std::vector<size_t> order(records.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(),
+            [&records](size_t a, size_t b) { return records[a].offset < records[b].offset; });
+
+  ipcressFileHandle.open(dataFilename.c_str(), std::ios::in | std::ios::binary);
+  Insist(ipcressFileHandle.is_open(), "IpcressFile: Unable to open ipcress file.");
+
+  std::vector<std::vector<double>> values(records.size());
+  std::vector<char> memblock;
+  size_t first = 0;
+  while (first < order.size()) {
+    // Extend the run while the next record starts within the allowed gap.
+    size_t const runBegin = records[order[first]].offset;
+    size_t runEnd = runBegin + records[order[first]].size;
+    size_t last = first + 1;
+    while (last < order.size() && records[order[last]].offset <= runEnd + max_read_gap_words) {
+      runEnd = std::max(runEnd, records[order[last]].offset + records[order[last]].size);
+      ++last;
+    }
+
+    memblock.resize(ipcress_word_size * (runEnd - runBegin));
+    if (!memblock.empty()) {
+      ipcressFileHandle.seekg(ipcress_word_size * runBegin, std::ios::beg);
+      ipcressFileHandle.read(memblock.data(), static_cast<std::streamsize>(memblock.size()));
+      Insist(ipcressFileHandle.good(), "IpcressFile: Unable to read ipcress file.");
+    }
+    for (size_t k = first; k < last; ++k) {
+      FieldRecord const &record = records[order[k]];
+      values[order[k]].resize(record.size);
+      decode_words(memblock.data() + ipcress_word_size * (record.offset - runBegin),
+                   values[order[k]]);
+    }
+    first = last;
+  }
+  ipcressFileHandle.close();
+
+  IpcressMaterial &material = materialData[matidx];
+  for (size_t i = 0; i < records.size(); ++i) {
+    std::string field = records[i].name;
+    material.add_field(field, values[i]);
 
     // Special treatment for comp
     if (field.substr(0, 4) == std::string("comp")) {
       double z, a;
-      if (ds[i] > 0) {
-        z = value[0];
-        a = value[1];
+      if (records[i].size > 0) {
+        z = values[i][0];
+        a = values[i][1];
         if (a <= 0.0) // support pre-7/2005 values
           a = 2.0 * z;
       } else {
@@ -233,12 +395,45 @@ void IpcressFile::loadFieldData() {
         z = 0.5;
       }
       double zoa = z / a;
-      materialData[matid].set_zoa(zoa);
+      material.set_zoa(zoa);
     }
   }
   return;
 }
 
+//------------------------------------------------------------------------------------------------//
+//! Make matidx the most recently used material, reading it and trimming the cache if needed.
+void IpcressFile::cacheMaterial(size_t const matidx) const {
+  auto itr = std::find(cachedMaterials.begin(), cachedMaterials.end(), matidx);
+  if (itr != cachedMaterials.end()) {
+    cachedMaterials.splice(cachedMaterials.begin(), cachedMaterials, itr);
+    return;
+  }
+  loadMaterial(matidx);
+  cachedMaterials.push_front(matidx);
+  cachedBytes += materialBytes(matidx);
+  evictMaterials(1);
+}
+
+//------------------------------------------------------------------------------------------------//
+//! Drop least recently used materials while over budget, but keep at least keep materials.
+void IpcressFile::evictMaterials(size_t const keep) const {
+  while (cachedBytes + tableBytes > cacheBudget && cachedMaterials.size() > keep) {
+    size_t const matidx = cachedMaterials.back();
+    cachedMaterials.pop_back();
+    cachedBytes -= materialBytes(matidx);
+    materialData[matidx] = IpcressMaterial();
+  }
+}
+
+//------------------------------------------------------------------------------------------------//
+size_t IpcressFile::materialBytes(size_t const matidx) const {
+  size_t words(0);
+  for (auto const &record : fieldRecords[matidx])
+    words += record.size;
+  return words * sizeof(double);
+}
+
 } // end namespace rtt_cdi_ipcress
 
 //------------------------------------------------------------------------------------------------//
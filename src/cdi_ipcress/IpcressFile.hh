@@ -12,6 +12,8 @@
 #define rtt_cdi_ipcress_IpcressFile_hh
 
 #include "IpcressMaterial.hh"
+#include <list>
+#include <mutex>
 
 namespace rtt_cdi_ipcress {
 
@@ -57,6 +59,13 @@ namespace rtt_cdi_ipcress {
  * dfo[2]          rgrid's values can be loaded from this address.
  * \endcode
  *
+ * Only the table of contents and the list of fields are read by the constructor.  The values of a
+ * material are read the first time one of its fields is requested (all of its fields at once, with
+ * nearby records merged into one sequential read) and kept in a least-recently-used cache.  The
+ * cache is bounded by a memory budget (defaultCacheBudget unless set).  The tables held by the
+ * IpcressDataTable objects loaded from this file count against the same budget.  Those tables are
+ * never evicted, so the cached material data shrinks to make room for them.
+ *
  * \example cdi_ipcress/test/tIpcressFile.cc
  * Example of IpcressFile use independent of IpcressOpacity or CDI.
  */
@@ -119,16 +128,57 @@ class IpcressFile {
   //! This array holds the length of each data set (how many entries in tgrid).
   std::vector<size_t> ds;
 
+  //! Name and disk location (in words) of one field of a material.
+  struct FieldRecord {
+    std::string name;
+    size_t offset;
+    size_t size;
+  };
+
+  //! The fields of each material, in the order they appear in the table of data fields.
+  std::vector<std::vector<FieldRecord>> fieldRecords;
+
   /*!
    * \brief A vector of containers.  Each contains all field data (tgrid,
-   *        ramg,...) for one material as loaded from the IPCRESS file. */
-  std::vector<IpcressMaterial> materialData;
+   *        ramg,...) for one material as loaded from the IPCRESS file.  Materials that are not in
+   *        the cache are empty. */
+  std::vector<IpcressMaterial> mutable materialData;
+
+  //! Indices of the cached materials, most recently used first.
+  std::list<size_t> mutable cachedMaterials;
+
+  //! Bytes of field data held by the cached materials.
+  size_t mutable cachedBytes = 0;
+
+  //! Bytes of the IpcressDataTable tables loaded from this file that are still alive.
+  size_t mutable tableBytes = 0;
+
+  //! Upper bound on cachedBytes + tableBytes; the most recently used material is always kept.
+  size_t cacheBudget;
+
+  //! Serializes access to the cache and the file handle.
+  std::mutex mutable cacheMutex;
 
 public:
+  //! Default memory budget of the material cache (256 MiB).
+  static constexpr size_t defaultCacheBudget = size_t(256) << 20U;
+
   // CREATORS
 
   //! Standard IpcressFile constructor.
-  explicit IpcressFile(std::string const &ipcressDataFilename);
+  explicit IpcressFile(std::string const &ipcressDataFilename,
+                       size_t cacheBudgetBytes = defaultCacheBudget);
+
+  // MANIPULATORS
+
+  //! Change the memory budget of the material cache, evicting materials as needed.
+  void setCacheBudget(size_t const cacheBudgetBytes);
+
+  //! Count a table loaded from this file against the cache budget.
+  void addTableBytes(size_t const bytes) const;
+
+  //! Stop counting a table that has been released.
+  void removeTableBytes(size_t const bytes) const;
 
   // ACCESSORS
 
@@ -153,19 +203,23 @@ public:
     return pos;
   }
 
-  //! Provide a list of loaded data field names for matid.
-  std::vector<std::string> listDataFieldNames(size_t const matid) const {
-    Require(materialFound(matid));
-    size_t matidx = getMatIndex(matid);
-    return materialData[matidx].listDataFieldNames();
-  }
+  //! Provide a list of data field names for matid.
+  std::vector<std::string> listDataFieldNames(size_t const matid) const;
 
-  //! Provide access to data arrays
-  std::vector<double> getData(size_t const matid, std::string const &fieldName) const {
-    Require(materialFound(matid));
-    size_t matidx = getMatIndex(matid);
-    return materialData[matidx].data(fieldName);
-  }
+  //! Provide access to data arrays, reading the material from the file if it is not cached.
+  std::vector<double> getData(size_t const matid, std::string const &fieldName) const;
+
+  //! Memory budget of the material cache (bytes).
+  size_t getCacheBudget() const { return cacheBudget; }
+
+  //! Bytes of field data currently held in the material cache.
+  size_t getCachedBytes() const;
+
+  //! Bytes of the IpcressDataTable tables counted against the cache budget.
+  size_t getTableBytes() const;
+
+  //! Indicate if the field data of matid is currently cached.
+  bool isMaterialCached(size_t const matid) const;
 
   //! Print a summary of the Ipcress file
   void printSummary(std::ostream &out = std::cout) const;
@@ -177,15 +231,27 @@ private:
   //! Attempt to locate the requested ipcress file.
   static std::string locateIpcressFile(std::string const &ipcressFile);
 
-  /*!
-   * \brief Load the list of field data names and the associated data arrays for
-   *        the requested material from the Ipcress file and save them into the
-   *        IpcressMaterial container. */
-  void loadFieldData();
+  //! Read the table of data fields and build the list of field records for each material.
+  void loadFieldIndex();
+
+  //! Read all fields of one material from the file into materialData.
+  void loadMaterial(size_t const matidx) const;
+
+  //! Make matidx the most recently used cached material, loading it if needed.
+  void cacheMaterial(size_t const matidx) const;
+
+  //! Evict least recently used materials until the budget is met or only keep remain.
+  void evictMaterials(size_t const keep) const;
+
+  //! Bytes of field data of one material.
+  size_t materialBytes(size_t const matidx) const;
 
   //! Read an array of integers or doubles from the ipcress file.
   template <typename T> void read_v(size_t const offset_bytes, std::vector<T> &vdata) const;
 
+  //! Convert big-endian 8-byte words to integers or doubles.
+  template <typename T> void decode_words(char const *words, std::vector<T> &vdata) const;
+
   //! Read strings from the binary file
   void read_strings(size_t const offset_bytes, std::vector<std::string> &vdata) const;
 };
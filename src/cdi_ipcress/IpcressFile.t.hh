@@ -39,17 +39,28 @@ void IpcressFile::read_v(size_t const byte_offset, std::vector<T> &vdata) const
   // Read the data
   ipcressFileHandle.read(&memblock[0], ipcress_word_size * nitems);
 
-  // Copy data into vector<int> container
+  decode_words(memblock.data(), vdata);
+  return;
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Convert 8-byte words read from the binary file
+ *
+ * \param[in]     words raw file data, vdata.size() words
+ * \param[in,out] vdata return value (sized by the caller)
+ */
+template <typename T>
+void IpcressFile::decode_words(char const *words, std::vector<T> &vdata) const {
   double ddata;
-  for (size_t i = 0; i < nitems; ++i) {
+  for (size_t i = 0; i < vdata.size(); ++i) {
     // cast raw char data to double and perform a byte swap
-    std::memcpy(&ddata, &memblock[i * ipcress_word_size], ipcress_word_size);
+    std::memcpy(&ddata, words + i * ipcress_word_size, ipcress_word_size);
     if (!rtt_dsxx::is_big_endian())
       rtt_dsxx::byte_swap(ddata);
-    // Save to the vector<int>
+    // Save to the vector<T>
     vdata[i] = static_cast<T>(ddata);
   }
-  return;
 }
 
 } // end namespace rtt_cdi_ipcress
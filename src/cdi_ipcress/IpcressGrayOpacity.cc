@@ -22,7 +22,8 @@ namespace rtt_cdi_ipcress {
 //! Constructor for IpcressGrayOpacity object.
 IpcressGrayOpacity::IpcressGrayOpacity(std::shared_ptr<IpcressFile const> const &spIpcressFile,
                                        size_t in_materialID, rtt_cdi::Model in_opacityModel,
-                                       rtt_cdi::Reaction in_opacityReaction)
+                                       rtt_cdi::Reaction in_opacityReaction,
+                                       rtt_c4::Table_Storage storage)
     : ipcressFilename(spIpcressFile->getDataFilename()), materialID(in_materialID), fieldNames(),
       opacityModel(in_opacityModel), opacityReaction(in_opacityReaction),
       energyPolicyDescriptor("gray"), spIpcressDataTable() {
@@ -37,7 +38,8 @@ IpcressGrayOpacity::IpcressGrayOpacity(std::shared_ptr<IpcressFile const> const
 
   // Create the data table object and fill it with the table data from the IPCRESS file.
   spIpcressDataTable = std::make_shared<IpcressDataTable>(
-      energyPolicyDescriptor, opacityModel, opacityReaction, fieldNames, materialID, spIpcressFile);
+      energyPolicyDescriptor, opacityModel, opacityReaction, fieldNames, materialID, spIpcressFile,
+      storage);
 
 } // end of IpcressData constructor
 
@@ -167,6 +169,21 @@ std::vector<double> IpcressGrayOpacity::getOpacity(double targetTemperature,
   return opacity;
 }
 
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Cell-batched opacity accessor that fills a caller-owned buffer.
+ *
+ * \param[in] numCells number of cells
+ * \param[in] targetTemperature cell temperatures [numCells]
+ * \param[in] targetDensity cell densities [numCells]
+ * \param[out] opacity caller-owned buffer of numCells opacities
+ */
+void IpcressGrayOpacity::getOpacityBatch(size_t numCells, double const *targetTemperature,
+                                         double const *targetDensity, double *opacity) const {
+  Require(spIpcressDataTable->getNumOpacityValues() == 1);
+  spIpcressDataTable->interpOpac(numCells, targetTemperature, targetDensity, opacity);
+}
+
 // ------- //
 // Packing //
 // ------- //
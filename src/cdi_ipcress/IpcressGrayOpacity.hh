@@ -147,9 +147,12 @@ public:
    *     found in the specified IPCRESS file.
    * \param in_opacityModel The physics model that the current data set is based on.
    * \param in_opacityReaction The type of reaction rate that the current data set represents.
+   * \param storage Where the opacity table is held.  Table_Storage::node_shared keeps one copy per
+   *     shared-memory node; the constructor is then collective over rtt_c4::communicator.
    */
   IpcressGrayOpacity(std::shared_ptr<IpcressFile const> const &spIpcressFile, size_t in_materialID,
-                     rtt_cdi::Model in_opacityModel, rtt_cdi::Reaction in_opacityReaction);
+                     rtt_cdi::Model in_opacityModel, rtt_cdi::Reaction in_opacityReaction,
+                     rtt_c4::Table_Storage storage = rtt_c4::Table_Storage::heap);
 
   /*!
    * \brief Unpacking constructor.
@@ -278,6 +281,10 @@ public:
   std::vector<double> getOpacity(double targetTemperature,
                                  std::vector<double> const &targetDensity) const override;
 
+  //! Cell-batched opacity accessor that fills a caller-owned buffer.
+  void getOpacityBatch(size_t numCells, double const *targetTemperature,
+                       double const *targetDensity, double *opacity) const override;
+
   //! Query whether the data is in tables or functional form.
   bool data_in_tabular_form() const override { return true; }
 
@@ -12,6 +12,7 @@
 #include "IpcressFile.hh"
 #include "ds++/Assert.hh"
 #include "ds++/Packing_Utils.hh"
+#include <algorithm>
 #include <cmath>
 #include <memory>
 
@@ -25,7 +26,8 @@ namespace rtt_cdi_ipcress {
 //! Constructor for IpcressMultigroupOpacity object.
 IpcressMultigroupOpacity::IpcressMultigroupOpacity(
     std::shared_ptr<IpcressFile const> const &spIpcressFile, size_t in_materialID,
-    rtt_cdi::Model in_opacityModel, rtt_cdi::Reaction in_opacityReaction)
+    rtt_cdi::Model in_opacityModel, rtt_cdi::Reaction in_opacityReaction,
+    rtt_c4::Table_Storage storage)
     : ipcressFilename(spIpcressFile->getDataFilename()), materialID(in_materialID), fieldNames(),
       opacityModel(in_opacityModel), opacityReaction(in_opacityReaction),
       energyPolicyDescriptor("mg"), spIpcressDataTable() {
@@ -40,7 +42,8 @@ IpcressMultigroupOpacity::IpcressMultigroupOpacity(
 
   // Create the data table object and fill it with the table data from the IPCRESS file.
   spIpcressDataTable = std::make_shared<IpcressDataTable>(
-      energyPolicyDescriptor, opacityModel, opacityReaction, fieldNames, materialID, spIpcressFile);
+      energyPolicyDescriptor, opacityModel, opacityReaction, fieldNames, materialID, spIpcressFile,
+      storage);
 
 } // end of IpcressData constructor
 
@@ -138,11 +141,9 @@ std::vector<double> IpcressMultigroupOpacity::getOpacity(double targetTemperatur
   // copied into the opacityIterator.
   std::vector<double> opacity(numGroups, -99.0);
 
-  // logarithmic interpolation:
-  for (size_t g = 0; g < numGroups; ++g) {
-    opacity[g] = spIpcressDataTable->interpOpac(targetTemperature, targetDensity, g);
-    Check(opacity[g] >= 0.0);
-  }
+  // logarithmic interpolation (the table is searched once for all groups):
+  spIpcressDataTable->interpOpac(1, &targetTemperature, &targetDensity, opacity.data());
+  Ensure(std::all_of(opacity.begin(), opacity.end(), [](double x) { return x >= 0.0; }));
   return opacity;
 }
 
@@ -176,6 +177,24 @@ IpcressMultigroupOpacity::getOpacity(double targetTemperature,
   return opacity;
 }
 
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Cell-batched opacity accessor that fills a caller-owned (cell x group) buffer.
+ *
+ * Each cell is located in the table once for all of its groups and no memory is allocated.
+ *
+ * \param[in] numCells number of cells
+ * \param[in] targetTemperature cell temperatures [numCells]
+ * \param[in] targetDensity cell densities [numCells]
+ * \param[out] opacity caller-owned buffer of numCells * getNumGroups() opacities
+ */
+void IpcressMultigroupOpacity::getOpacityBatch(size_t numCells, double const *targetTemperature,
+                                               double const *targetDensity,
+                                               double *opacity) const {
+  Require(spIpcressDataTable->getNumOpacityValues() == getNumGroups());
+  spIpcressDataTable->interpOpac(numCells, targetTemperature, targetDensity, opacity);
+}
+
 // ------- //
 // Packing //
 // ------- //
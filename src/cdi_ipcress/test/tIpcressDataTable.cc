@@ -0,0 +1,178 @@
+//--------------------------------------------*-C++-*---------------------------------------------//
+/*!
+ * \file   cdi_ipcress/test/tIpcressDataTable.cc
+ * \author agent
+ * \brief  IpcressDataTable interpolation tests and batched lookup benchmark.
+ * \note   Copyright (C) 2026 Triad National Security, LLC., All rights reserved. */
+//------------------------------------------------------------------------------------------------//
+
+#include "cdi_ipcress_test.hh"
+#include "cdi_ipcress/IpcressDataTable.hh"
+#include "ds++/Release.hh"
+#include "ds++/Soft_Equivalence.hh"
+#include <chrono>
+#include <cmath>
+
+using namespace std;
+
+using rtt_cdi_ipcress::IpcressDataTable;
+using rtt_cdi_ipcress::IpcressFile;
+using rtt_dsxx::soft_equiv;
+
+//------------------------------------------------------------------------------------------------//
+// HELPERS
+//------------------------------------------------------------------------------------------------//
+
+//! Reference log-log interpolation (linear table scans) built directly from the raw file data.
+double reference_interp(vector<double> const &tgrid, vector<double> const &rgrid,
+                        vector<double> const &opac, size_t const ng, double const T,
+                        double const rho, size_t const group) {
+  size_t const numT = tgrid.size();
+  size_t const numrho = rgrid.size();
+  double logT = log(min(max(T, tgrid[0]), tgrid[numT - 1]));
+  double logrho = log(min(max(rho, rgrid[0]), rgrid[numrho - 1]));
+  size_t iT = numT - 1;
+  size_t irho = numrho - 1;
+  for (size_t i = 0; i < numT - 1; ++i)
+    if (logT >= log(tgrid[i]) && logT < log(tgrid[i + 1])) {
+      iT = i;
+      break;
+    }
+  for (size_t i = 0; i < numrho - 1; ++i)
+    if (logrho >= log(rgrid[i]) && logrho < log(rgrid[i + 1])) {
+      irho = i;
+      break;
+    }
+  auto const lsig = [&](size_t const t, size_t const r) {
+    return log(opac[(t * numrho + r) * ng + group]);
+  };
+  double const fT = iT + 1 < numT ? (logT - log(tgrid[iT])) / (log(tgrid[iT + 1]) - log(tgrid[iT]))
+                                  : 0.0;
+  double const fr = irho + 1 < numrho
+                        ? (logrho - log(rgrid[irho])) / (log(rgrid[irho + 1]) - log(rgrid[irho]))
+                        : 0.0;
+  size_t const iT2 = min(iT + 1, numT - 1);
+  size_t const irho2 = min(irho + 1, numrho - 1);
+  double const low = lsig(iT, irho) + fr * (lsig(iT, irho2) - lsig(iT, irho));
+  double const high = lsig(iT2, irho) + fr * (lsig(iT2, irho2) - lsig(iT2, irho));
+  return exp(low + fT * (high - low));
+}
+
+//------------------------------------------------------------------------------------------------//
+//! Temperatures and densities that cover the table, its grid points and both sides of it.
+void make_points(vector<double> const &tgrid, vector<double> const &rgrid, size_t const n,
+                 vector<double> &T, vector<double> &rho) {
+  T.resize(n);
+  rho.resize(n);
+  double const lT0 = log(tgrid.front()) - 0.5;
+  double const lT1 = log(tgrid.back()) + 0.5;
+  double const lr0 = log(rgrid.front()) - 0.5;
+  double const lr1 = log(rgrid.back()) + 0.5;
+  for (size_t i = 0; i < n; ++i) {
+    double const a = static_cast<double>((i * 7919) % n) / static_cast<double>(n - 1);
+    double const b = static_cast<double>((i * 104729) % n) / static_cast<double>(n - 1);
+    T[i] = exp(lT0 + a * (lT1 - lT0));
+    rho[i] = exp(lr0 + b * (lr1 - lr0));
+  }
+  // exact grid points
+  for (size_t i = 0; i < min(tgrid.size(), n); ++i)
+    T[i] = tgrid[i];
+  for (size_t i = 0; i < min(rgrid.size(), n); ++i)
+    rho[n - 1 - i] = rgrid[i];
+}
+
+//------------------------------------------------------------------------------------------------//
+// TESTS
+//------------------------------------------------------------------------------------------------//
+
+void check_table(rtt_dsxx::ScalarUnitTest &ut, string const &filename, string const &energy,
+                 rtt_cdi::Model const model, rtt_cdi::Reaction const reaction,
+                 string const &key) {
+  size_t const matid(10001);
+  auto const spFile = std::make_shared<IpcressFile>(ut.getTestSourcePath() + filename);
+  vector<string> const fieldNames = spFile->listDataFieldNames(matid);
+  IpcressDataTable table(energy, model, reaction, fieldNames, matid, spFile);
+
+  vector<double> const tgrid = spFile->getData(matid, "tgrid");
+  vector<double> const rgrid = spFile->getData(matid, "rgrid");
+  vector<double> const opac = spFile->getData(matid, key);
+  size_t const ng = table.getNumOpacityValues();
+  FAIL_IF_NOT(opac.size() == tgrid.size() * rgrid.size() * ng);
+
+  size_t const n = 200;
+  vector<double> T, rho;
+  make_points(tgrid, rgrid, n, T, rho);
+
+  // batched lookup of every group at every point
+  vector<double> batch(n * ng, -1.0);
+  table.interpOpac(n, T.data(), rho.data(), batch.data());
+
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t g = 0; g < ng; ++g) {
+      double const scalar = table.interpOpac(T[i], rho[i], g);
+      // the batched and single point interfaces share one kernel
+      FAIL_IF_NOT(soft_equiv(batch[i * ng + g], scalar, 0.0));
+      FAIL_IF_NOT(soft_equiv(scalar, reference_interp(tgrid, rgrid, opac, ng, T[i], rho[i], g)));
+    }
+  }
+
+  // table values are returned at the table nodes
+  for (size_t t = 0; t < tgrid.size(); ++t)
+    for (size_t r = 0; r < rgrid.size(); ++r)
+      for (size_t g = 0; g < ng; ++g)
+        FAIL_IF_NOT(soft_equiv(table.interpOpac(tgrid[t], rgrid[r], g),
+                               opac[(t * rgrid.size() + r) * ng + g]));
+
+  if (ut.numFails == 0)
+    PASSMSG(table.getDataDescriptor() + " interpolation checks pass for " + filename);
+}
+
+//------------------------------------------------------------------------------------------------//
+//! Compare per-group single point lookups with one batched lookup over all points.
+void benchmark_batch(rtt_dsxx::ScalarUnitTest &ut) {
+  size_t const matid(10001);
+  auto const spFile = std::make_shared<IpcressFile>(ut.getTestSourcePath() + "two-mats.ipcress");
+  vector<string> const fieldNames = spFile->listDataFieldNames(matid);
+  IpcressDataTable table("mg", rtt_cdi::ROSSELAND, rtt_cdi::TOTAL, fieldNames, matid, spFile);
+  size_t const ng = table.getNumOpacityValues();
+
+  size_t const n = 20000;
+  vector<double> T, rho;
+  make_points(spFile->getData(matid, "tgrid"), spFile->getData(matid, "rgrid"), n, T, rho);
+  vector<double> scalar(n * ng);
+  vector<double> batch(n * ng);
+
+  auto const t0 = chrono::steady_clock::now();
+  for (size_t i = 0; i < n; ++i)
+    for (size_t g = 0; g < ng; ++g)
+      scalar[i * ng + g] = table.interpOpac(T[i], rho[i], g);
+  auto const t1 = chrono::steady_clock::now();
+  table.interpOpac(n, T.data(), rho.data(), batch.data());
+  auto const t2 = chrono::steady_clock::now();
+
+  FAIL_IF_NOT(scalar == batch);
+  cout << "\nOpacity lookup for " << n << " cells x " << ng << " groups:"
+       << "\n  per group interpOpac : " << chrono::duration<double>(t1 - t0).count() << " s"
+       << "\n  batched interpOpac   : " << chrono::duration<double>(t2 - t1).count() << " s\n"
+       << endl;
+
+  if (ut.numFails == 0)
+    PASSMSG("batched opacity lookup matches the per group lookup");
+}
+
+//------------------------------------------------------------------------------------------------//
+int main(int argc, char *argv[]) {
+  rtt_dsxx::ScalarUnitTest ut(argc, argv, rtt_dsxx::release);
+  try {
+    check_table(ut, "two-mats.ipcress", "mg", rtt_cdi::ROSSELAND, rtt_cdi::TOTAL, "rtmg");
+    check_table(ut, "two-mats.ipcress", "gray", rtt_cdi::ROSSELAND, rtt_cdi::TOTAL, "rgray");
+    check_table(ut, "analyticOpacities.ipcress", "mg", rtt_cdi::PLANCK, rtt_cdi::ABSORPTION,
+                "pmg");
+    benchmark_batch(ut);
+  }
+  UT_EPILOG(ut);
+}
+
+//------------------------------------------------------------------------------------------------//
+// end of tIpcressDataTable.cc
+//------------------------------------------------------------------------------------------------//
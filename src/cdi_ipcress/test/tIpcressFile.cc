@@ -10,6 +10,7 @@
 
 #include "cdi_ipcress_test.hh"
 #include "cdi_ipcress/IpcressFile.hh"
+#include "cdi_ipcress/IpcressMultigroupOpacity.hh"
 #include "ds++/Release.hh"
 #include "ds++/Soft_Equivalence.hh"
 
@@ -114,11 +115,83 @@ void ipcress_file_test(rtt_dsxx::ScalarUnitTest &ut) {
   }
 }
 
+//------------------------------------------------------------------------------------------------//
+//! Materials are read on first use and the cache respects its memory budget.
+void ipcress_cache_test(rtt_dsxx::ScalarUnitTest &ut) {
+
+  cout << "\nTesting the IpcressFile material cache." << endl;
+
+  string const op_data_file = ut.getTestSourcePath() + "two-mats.ipcress";
+  IpcressFile reference(op_data_file);
+  auto const spFile = std::make_shared<IpcressFile>(op_data_file);
+  size_t const mat1(10001);
+  size_t const mat2(10002);
+
+  // Only the index is read by the constructor, and the default budget is finite.
+  FAIL_IF_NOT(spFile->getCacheBudget() == IpcressFile::defaultCacheBudget);
+  FAIL_IF(spFile->isMaterialCached(mat1));
+  FAIL_IF(spFile->isMaterialCached(mat2));
+  FAIL_IF_NOT(spFile->getCachedBytes() == 0);
+  FAIL_IF_NOT(spFile->listDataFieldNames(mat1) == reference.listDataFieldNames(mat1));
+
+  // One field loads the whole material.
+  vector<double> const tgrid = spFile->getData(mat1, "tgrid");
+  FAIL_IF_NOT(spFile->isMaterialCached(mat1));
+  FAIL_IF(spFile->isMaterialCached(mat2));
+  size_t const mat1Bytes = spFile->getCachedBytes();
+  FAIL_IF_NOT(mat1Bytes > tgrid.size() * sizeof(double));
+
+  // A budget that holds one material keeps only the most recently used one.
+  spFile->setCacheBudget(mat1Bytes);
+  FAIL_IF_NOT(spFile->getCacheBudget() == mat1Bytes);
+  FAIL_IF_NOT(spFile->isMaterialCached(mat1));
+  vector<double> const rgrid2 = spFile->getData(mat2, "rgrid");
+  FAIL_IF_NOT(spFile->isMaterialCached(mat2));
+  FAIL_IF(spFile->isMaterialCached(mat1));
+
+  // Evicted materials are read again with the same values.
+  for (size_t const matid : {mat1, mat2, mat1}) {
+    for (auto const &field : reference.listDataFieldNames(matid))
+      FAIL_IF_NOT(spFile->getData(matid, field) == reference.getData(matid, field));
+  }
+
+  // A zero budget drops everything.
+  spFile->setCacheBudget(0);
+  FAIL_IF(spFile->isMaterialCached(mat1));
+  FAIL_IF(spFile->isMaterialCached(mat2));
+  FAIL_IF_NOT(spFile->getCachedBytes() == 0);
+
+  // Opacities read their table on first use.
+  spFile->setCacheBudget(IpcressFile::defaultCacheBudget);
+  {
+    rtt_cdi_ipcress::IpcressMultigroupOpacity const opacity(spFile, mat2, rtt_cdi::ROSSELAND,
+                                                            rtt_cdi::TOTAL);
+    FAIL_IF(spFile->isMaterialCached(mat2));
+    FAIL_IF_NOT(spFile->getTableBytes() == 0);
+    FAIL_IF_NOT(opacity.getOpacity(1.0, 0.1).size() == opacity.getNumGroups());
+    FAIL_IF_NOT(spFile->isMaterialCached(mat2));
+
+    // The loaded table counts against the budget, so a budget that only fits the table drops the
+    // cached material data.
+    size_t const tableBytes = spFile->getTableBytes();
+    FAIL_IF_NOT(tableBytes > opacity.getNumGroups() * sizeof(double));
+    spFile->setCacheBudget(tableBytes);
+    FAIL_IF(spFile->isMaterialCached(mat2));
+    FAIL_IF_NOT(opacity.getOpacity(1.0, 0.1).size() == opacity.getNumGroups());
+  }
+  // A destroyed opacity no longer counts against the budget.
+  FAIL_IF_NOT(spFile->getTableBytes() == 0);
+
+  if (ut.numFails == 0)
+    PASSMSG("IpcressFile loads materials on demand within its cache budget.");
+}
+
 //------------------------------------------------------------------------------------------------//
 int main(int argc, char *argv[]) {
   rtt_dsxx::ScalarUnitTest ut(argc, argv, rtt_dsxx::release);
   try {
     ipcress_file_test(ut);
+    ipcress_cache_test(ut);
   }
   UT_EPILOG(ut);
 }
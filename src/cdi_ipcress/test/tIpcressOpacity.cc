@@ -1164,6 +1164,70 @@ void mg_opacity_packing_test(rtt_dsxx::ScalarUnitTest &ut) {
   }
 }
 
+//------------------------------------------------------------------------------------------------//
+void batch_opacity_test(rtt_dsxx::ScalarUnitTest &ut) {
+
+  cout << "\nStarting test \"batch_opacity_test\"...\n";
+
+  string const op_data_file = ut.getTestSourcePath() + "two-mats.ipcress";
+  FAIL_IF_NOT(rtt_dsxx::fileExists(op_data_file));
+  auto const spIF = std::make_shared<IpcressFile>(op_data_file);
+  int const matid = 10001;
+
+  shared_ptr<MultigroupOpacity> const spMG =
+      std::make_shared<IpcressMultigroupOpacity>(spIF, matid, rtt_cdi::ROSSELAND, rtt_cdi::TOTAL);
+  shared_ptr<GrayOpacity> const spGray =
+      std::make_shared<IpcressGrayOpacity>(spIF, matid, rtt_cdi::ROSSELAND, rtt_cdi::TOTAL);
+  size_t const ng = spMG->getNumGroups();
+
+  vector<double> const T = {0.01, 0.1, 0.5, 1.0, 2.5, 10.0};
+  vector<double> const rho = {0.05, 0.1, 0.3, 0.5, 0.7, 1.0};
+  size_t const ncells = T.size();
+
+  // multigroup opacities come back as [cell][group] in one caller-owned buffer
+  vector<double> mg(ncells * ng, -1.0);
+  spMG->getOpacityBatch(ncells, T.data(), rho.data(), mg.data());
+  vector<double> gray(ncells, -1.0);
+  spGray->getOpacityBatch(ncells, T.data(), rho.data(), gray.data());
+  for (size_t c = 0; c < ncells; ++c) {
+    vector<double> const ref = spMG->getOpacity(T[c], rho[c]);
+    FAIL_IF_NOT(soft_equiv(mg.begin() + c * ng, mg.begin() + (c + 1) * ng, ref.begin(), ref.end()));
+    FAIL_IF_NOT(soft_equiv(gray[c], spGray->getOpacity(T[c], rho[c])));
+  }
+
+  if (ut.numFails == 0)
+    PASSMSG("Batched Ipcress opacities match the per cell opacities.");
+}
+
+//------------------------------------------------------------------------------------------------//
+void node_shared_opacity_test(rtt_dsxx::ScalarUnitTest &ut) {
+
+  cout << "\nStarting test \"node_shared_opacity_test\"...\n";
+
+  string const op_data_file = ut.getTestSourcePath() + "two-mats.ipcress";
+  auto const spIF = std::make_shared<IpcressFile>(op_data_file);
+  int const matid = 10001;
+
+  // Without a running MPI job the node_shared policy falls back to the heap; the tables must be
+  // identical either way.
+  IpcressMultigroupOpacity const heap(spIF, matid, rtt_cdi::ROSSELAND, rtt_cdi::TOTAL);
+  IpcressMultigroupOpacity const shared(spIF, matid, rtt_cdi::ROSSELAND, rtt_cdi::TOTAL,
+                                        rtt_c4::Table_Storage::node_shared);
+  IpcressGrayOpacity const gray_heap(spIF, matid, rtt_cdi::ROSSELAND, rtt_cdi::TOTAL);
+  IpcressGrayOpacity const gray_shared(spIF, matid, rtt_cdi::ROSSELAND, rtt_cdi::TOTAL,
+                                       rtt_c4::Table_Storage::node_shared);
+
+  for (double const T : {0.01, 0.1, 1.0, 10.0}) {
+    for (double const rho : {0.05, 0.5, 1.0}) {
+      FAIL_IF_NOT(heap.getOpacity(T, rho) == shared.getOpacity(T, rho));
+      FAIL_IF_NOT(soft_equiv(gray_heap.getOpacity(T, rho), gray_shared.getOpacity(T, rho), 0.0));
+    }
+  }
+
+  if (ut.numFails == 0)
+    PASSMSG("Opacities from node-shared tables match the heap tables.");
+}
+
 //------------------------------------------------------------------------------------------------//
 int main(int argc, char *argv[]) {
   rtt_dsxx::ScalarUnitTest ut(argc, argv, rtt_dsxx::release);
@@ -1175,6 +1239,8 @@ int main(int argc, char *argv[]) {
 
     gray_opacity_packing_test(ut);
     mg_opacity_packing_test(ut);
+    batch_opacity_test(ut);
+    node_shared_opacity_test(ut);
   }
   UT_EPILOG(ut);
 }
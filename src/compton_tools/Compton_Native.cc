@@ -10,8 +10,19 @@
 #include "compton_tools/Compton_Native.hh"
 #include "c4/global.hh"
 #include "ds++/Assert.hh"
+#include <algorithm>
 #include <array>
+#include <cstring>
 #include <fstream>
+#include <type_traits>
+#include <utility>
+
+#ifdef UNIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 using UINT64 = uint64_t;
 using FP = double;
@@ -23,6 +34,28 @@ namespace rtt_compton_tools {
 // FREE-FLOATING HELPER FUNCTIONS
 //------------------------------------------------------------------------------------------------//
 
+//! Bytes in the CSK binary header: file type, version (major, minor, ordering) and 7 sizes
+constexpr size_t csk_header_bytes = 6U + 10U * sizeof(UINT64);
+
+//! Padding after the header of version 1.1 (and later) files; it 8-byte aligns every array
+constexpr size_t csk_header_padding = 2U;
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Make every rank fail consistently if any rank failed to read the CSK file
+ *
+ * \param[in] errcode Zero on success; 1 means that the file was not found
+ */
+void check_read_errcode(int errcode) {
+  rtt_c4::global_max(errcode);
+  if (errcode == 1) {
+    // Have all ranks throw a bad file exception
+    std::ifstream f("");
+    f.exceptions(f.failbit);
+  }
+  Insist(errcode == 0, "Non-zero errorcode. Exiting.");
+}
+
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief find location in a sorted list and min/max value to be within list
@@ -92,24 +125,57 @@ template <typename T_FP> std::array<T_FP, 4> hermite(T_FP x, T_FP xL, T_FP xR) {
  * \brief Constructor for Compton_Native
  *
  * \param[in] filename Name of the binary CSK data file to be read
+ * \param[in] memory_map If true, every rank maps the file read-only instead of receiving a copy
  *
- * Rank 0 reads the binary CSK data file, which fills in the class' data members.  The data members
- * are then broadcast to other MPI ranks to finish their construction.
+ * By default, rank 0 reads the binary CSK data file, which fills in the class' data members.  The
+ * data members are then broadcast to other MPI ranks to finish their construction.
+ *
+ * With memory_map, each rank maps the file and no data is read up front or broadcast.  The pages
+ * are loaded on first use and shared, through the page cache, by every rank on a node.  The sparse
+ * arrays of version 1.1 files (written by "cskrw --aligned") are aligned and used in place
+ * (is_zero_copy()); those of version 1.0 files are copied from the mapping.  Memory mapping requires
+ * POSIX mmap and is otherwise ignored.
  */
-Compton_Native::Compton_Native(const std::string &filename) {
+Compton_Native::Compton_Native(const std::string &filename, bool memory_map) {
   Require(filename.length() > 0U);
-  int rank = rtt_c4::node();
-  constexpr int bcast_rank = 0;
-  int errcode = 0;
+#ifndef UNIX
+  memory_map = false;
+#endif
+
+  if (memory_map) {
+    check_read_errcode(map_binary(filename));
+  } else {
+    int rank = rtt_c4::node();
+    constexpr int bcast_rank = 0;
+    int errcode = 0;
+    auto arrays = std::make_shared<Sparse_Arrays>();
 
-  if (rank == bcast_rank) {
-    errcode = read_binary(filename);
+    if (rank == bcast_rank) {
+      errcode = read_binary(filename, *arrays);
+    }
+    broadcast_MPI(errcode, *arrays);
+    set_storage(std::move(arrays));
   }
-  broadcast_MPI(errcode);
 
   Ensure(check_class_invariants());
 }
 
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Take shared ownership of heap arrays and point the sparse data views at them
+ *
+ * \param[in] arrays Filled sparse CSK arrays
+ */
+void Compton_Native::set_storage(std::shared_ptr<const Sparse_Arrays> arrays) {
+  Require(arrays);
+  first_groups_ = Array_View<size_t>(arrays->first_groups.data(), arrays->first_groups.size());
+  indexes_ = Array_View<size_t>(arrays->indexes.data(), arrays->indexes.size());
+  data_ = Array_View<double>(arrays->data.data(), arrays->data.size());
+  derivs_ = Array_View<double>(arrays->derivs.data(), arrays->derivs.size());
+  storage_ = std::move(arrays);
+  zero_copy_ = false;
+}
+
 //------------------------------------------------------------------------------------------------//
 // BINARY READING AND BROADCASTING FUNCTIONS
 //------------------------------------------------------------------------------------------------//
@@ -119,24 +185,19 @@ Compton_Native::Compton_Native(const std::string &filename) {
  * \brief Helper member function that broadcasts CSK data from rank 0 to all ranks and sets data
  *
  * \param[in] errcode If non-zero, everyone aborts.
+ * \param[in,out] arrays Sparse CSK arrays; filled on rank 0, received on the other ranks
  *
  * Uses rtt_c4's broadcast to send arrays and vectors to all ranks with the sparse CSK data,
  * temperature / energy grids, and sizes
  */
-void Compton_Native::broadcast_MPI(int errcode) {
-  rtt_c4::global_max(errcode);
-  if (errcode == 1) {
-    // Have all ranks throw a bad file exception
-    std::ifstream f("");
-    f.exceptions(f.failbit);
-  }
-  Insist(errcode == 0, "Non-zero errorcode. Exiting.");
+void Compton_Native::broadcast_MPI(int errcode, Sparse_Arrays &arrays) {
+  check_read_errcode(errcode);
 
   int rank = rtt_c4::node();
   constexpr size_t bcast_rank = 0;
 
   // Broadcast sizes
-  size_t data_size = data_.size();
+  size_t data_size = arrays.data.size();
   std::array<size_t, 6> pack = {num_temperatures_, num_groups_, num_leg_moments_,
                                 num_evals_,        num_points_, data_size};
   rtt_c4::broadcast(&pack[0], pack.size(), bcast_rank);
@@ -160,21 +221,22 @@ void Compton_Native::broadcast_MPI(int errcode) {
 
   // Broadcast sparse data structures
   if (rank != bcast_rank)
-    first_groups_.resize(num_temperatures_ * num_groups_);
-  rtt_c4::broadcast(first_groups_.begin(), first_groups_.end(), first_groups_.begin());
+    arrays.first_groups.resize(num_temperatures_ * num_groups_);
+  rtt_c4::broadcast(arrays.first_groups.begin(), arrays.first_groups.end(),
+                    arrays.first_groups.begin());
 
   if (rank != bcast_rank)
-    indexes_.resize(num_temperatures_ * num_groups_ + 1U);
-  rtt_c4::broadcast(indexes_.begin(), indexes_.end(), indexes_.begin());
+    arrays.indexes.resize(num_temperatures_ * num_groups_ + 1U);
+  rtt_c4::broadcast(arrays.indexes.begin(), arrays.indexes.end(), arrays.indexes.begin());
 
   // Broadcast data itself
   if (rank != bcast_rank)
-    data_.resize(data_size);
-  rtt_c4::broadcast(data_.begin(), data_.end(), data_.begin());
+    arrays.data.resize(data_size);
+  rtt_c4::broadcast(arrays.data.begin(), arrays.data.end(), arrays.data.begin());
 
   if (rank != bcast_rank)
-    derivs_.resize(data_size);
-  rtt_c4::broadcast(derivs_.begin(), derivs_.end(), derivs_.begin());
+    arrays.derivs.resize(data_size);
+  rtt_c4::broadcast(arrays.derivs.begin(), arrays.derivs.end(), arrays.derivs.begin());
 
   return;
 }
@@ -184,11 +246,12 @@ void Compton_Native::broadcast_MPI(int errcode) {
  * \brief Helper member function to read a binary CSK file and set class data
  *
  * \param[in] filename Path to CSK binary file
+ * \param[out] arrays Sparse CSK arrays read from the file
  * \return errcode Zero if read is successful, otherwise non-zero
  *
  * Reads a binary CSK file by interpreting the characters as 64-bit unsigned integers and doubles
  */
-int Compton_Native::read_binary(const std::string &filename) {
+int Compton_Native::read_binary(const std::string &filename, Sparse_Arrays &arrays) {
 
   // Read
   auto fin = std::ifstream(filename, std::ios::in | std::ios::binary);
@@ -243,6 +306,10 @@ int Compton_Native::read_binary(const std::string &filename) {
   size_t isz = szs[j++];
   size_t dsz = szs[j++];
 
+  // Skip the alignment padding of newer files
+  if (version_minor >= 1U)
+    fin.ignore(static_cast<std::streamsize>(csk_header_padding));
+
   num_temperatures_ = tsz;
   num_groups_ = gsz;
   num_leg_moments_ = lsz;
@@ -278,33 +345,33 @@ int Compton_Native::read_binary(const std::string &filename) {
     Egs_[i] = tmp;
   }
 
-  first_groups_.resize(fgsz);
+  arrays.first_groups.resize(fgsz);
   for (size_t i = 0; i < fgsz; ++i) {
     // Convert from UINT (type in binary file) to size_t
     UINT64 tmp;
     fin.read(reinterpret_cast<char *>(&tmp), sizeof(UINT64));
-    first_groups_[i] = tmp;
+    arrays.first_groups[i] = tmp;
   }
 
-  indexes_.resize(isz);
+  arrays.indexes.resize(isz);
   for (size_t i = 0; i < isz; ++i) {
     UINT64 tmp;
     fin.read(reinterpret_cast<char *>(&tmp), sizeof(UINT64));
-    indexes_[i] = tmp;
+    arrays.indexes[i] = tmp;
   }
 
-  data_.resize(dsz);
+  arrays.data.resize(dsz);
   for (size_t i = 0; i < dsz; ++i) {
     FP tmp;
     fin.read(reinterpret_cast<char *>(&tmp), sizeof(FP));
-    data_[i] = tmp;
+    arrays.data[i] = tmp;
   }
 
-  derivs_.resize(dsz);
+  arrays.derivs.resize(dsz);
   for (size_t i = 0; i < dsz; ++i) {
     FP tmp;
     fin.read(reinterpret_cast<char *>(&tmp), sizeof(FP));
-    derivs_[i] = tmp;
+    arrays.derivs[i] = tmp;
   }
 
   fin.close();
@@ -325,12 +392,12 @@ int Compton_Native::read_binary(const std::string &filename) {
 
     std::cout << "\nDBG first_groups";
     for (size_t i = 0; i < fgsz; ++i)
-      std::cout << ", " << first_groups_[i];
+      std::cout << ", " << arrays.first_groups[i];
     std::cout << '\n';
 
     std::cout << "\nDBG indexes";
     for (size_t i = 0; i < isz; ++i)
-      std::cout << ", " << indexes_[i];
+      std::cout << ", " << arrays.indexes[i];
     std::cout << '\n';
 
     std::cout << "\nDBG data";
@@ -338,12 +405,12 @@ int Compton_Native::read_binary(const std::string &filename) {
       std::cout << "\nPoint " << p << "\n";
       size_t szp = dsz / num_points_;
       for (size_t ii = 0; ii < fgsz; ++ii) {
-        size_t istrt = indexes_[ii] + p * szp;
-        size_t iend = indexes_[ii + 1] + p * szp;
+        size_t istrt = arrays.indexes[ii] + p * szp;
+        size_t iend = arrays.indexes[ii + 1] + p * szp;
         std::cout << "  index " << ii;
         for (size_t i = istrt; i < iend; ++i) {
           std::cout << std::setprecision(12); // << std::scientific;
-          std::cout << ", " << data_[i] / 0.075116337052433;
+          std::cout << ", " << arrays.data[i] / 0.075116337052433;
         }
         std::cout << '\n';
       }
@@ -357,6 +424,124 @@ int Compton_Native::read_binary(const std::string &filename) {
   return 0;
 }
 
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Helper member function to map a binary CSK file read-only and set class data
+ *
+ * \param[in] filename Path to CSK binary file
+ * \return errcode Zero if the mapping is successful, otherwise non-zero
+ *
+ * Every rank calls this function.  The grids are copied out of the mapping; the sparse arrays are
+ * used in place when the file layout aligns them (version 1.1 and later) and are otherwise copied
+ * with one bulk copy per array.  The mapping is released when the last copy of this object that
+ * uses it is destroyed.
+ */
+int Compton_Native::map_binary(const std::string &filename) {
+#ifdef UNIX
+  const int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    std::cout << "Error: Compton data file '" << filename << "' not found!\n";
+    return 1;
+  }
+  struct stat file_stat;
+  const bool stat_ok = fstat(fd, &file_stat) == 0;
+  const size_t len = stat_ok ? static_cast<size_t>(file_stat.st_size) : 0U;
+  if (len < csk_header_bytes) {
+    close(fd);
+    std::cerr << "Expecting binary file " << filename << " to hold a CSK header" << std::endl;
+    return 2;
+  }
+  void *const addr = mmap(nullptr, len, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) {
+    std::cerr << "Failed to memory map the Compton data file " << filename << std::endl;
+    return 4;
+  }
+  std::shared_ptr<const void> mapping(addr, [len](const void *ptr) {
+    munmap(const_cast<void *>(ptr), len);
+  });
+  const char *const bytes = static_cast<const char *>(addr);
+
+  // Ensure valid type and version
+  const std::array<char, 6> expected = {' ', 'c', 's', 'k', ' ', '\0'};
+  if (!std::equal(expected.begin(), expected.end(), bytes)) {
+    std::cerr << "Expecting binary file " << filename << " to start with ' csk '" << std::endl;
+    return 2;
+  }
+  std::array<UINT64, 10> header{0};
+  std::memcpy(header.data(), bytes + expected.size(), sizeof(header));
+  const UINT64 version_major = header[0];
+  const UINT64 version_minor = header[1];
+  const UINT64 binary_ordering = header[2];
+  if (version_major != 1U || binary_ordering > 1U) {
+    std::cerr << "Expecting a CSK binary file (version 1) with ordering 0 or 1 but got "
+              << version_major << " with ordering " << binary_ordering << std::endl;
+    return 3;
+  }
+
+  num_temperatures_ = header[3];
+  num_groups_ = header[4];
+  num_leg_moments_ = header[5];
+  num_evals_ = header[6];
+  const size_t fgsz = header[7];
+  const size_t isz = header[8];
+  const size_t dsz = header[9];
+  // point is (leg moment, eval) pair
+  // first eval has all leg moments; others have only the 0th moment
+  num_points_ = num_evals_ + num_leg_moments_ - 1U;
+
+  // Offsets of each array in the file
+  const size_t ts_offset = csk_header_bytes + (version_minor >= 1U ? csk_header_padding : 0U);
+  const size_t egs_offset = ts_offset + num_temperatures_ * sizeof(FP);
+  const size_t fg_offset = egs_offset + (num_groups_ + 1U) * sizeof(FP);
+  const size_t index_offset = fg_offset + fgsz * sizeof(UINT64);
+  const size_t data_offset = index_offset + isz * sizeof(UINT64);
+  const size_t derivs_offset = data_offset + dsz * sizeof(FP);
+  if (len < derivs_offset + dsz * sizeof(FP)) {
+    std::cerr << "Compton data file " << filename << " is truncated" << std::endl;
+    return 2;
+  }
+
+  Ts_.resize(num_temperatures_);
+  std::memcpy(Ts_.data(), bytes + ts_offset, Ts_.size() * sizeof(FP));
+  Egs_.resize(num_groups_ + 1U);
+  std::memcpy(Egs_.data(), bytes + egs_offset, Egs_.size() * sizeof(FP));
+
+  // All arrays hold 8-byte words, so they are aligned if the first one is
+  const bool in_place = std::is_same<size_t, UINT64>::value && std::is_same<double, FP>::value &&
+                        fg_offset % alignof(UINT64) == 0;
+  if (in_place) {
+    first_groups_ = Array_View<size_t>(reinterpret_cast<const size_t *>(bytes + fg_offset), fgsz);
+    indexes_ = Array_View<size_t>(reinterpret_cast<const size_t *>(bytes + index_offset), isz);
+    data_ = Array_View<double>(reinterpret_cast<const double *>(bytes + data_offset), dsz);
+    derivs_ = Array_View<double>(reinterpret_cast<const double *>(bytes + derivs_offset), dsz);
+    storage_ = std::move(mapping);
+    zero_copy_ = true;
+  } else {
+    auto arrays = std::make_shared<Sparse_Arrays>();
+    auto copy_words = [bytes](std::vector<size_t> &v, size_t offset, size_t n) {
+      v.resize(n);
+      for (size_t i = 0; i < n; ++i) {
+        UINT64 tmp;
+        std::memcpy(&tmp, bytes + offset + i * sizeof(UINT64), sizeof(UINT64));
+        v[i] = tmp;
+      }
+    };
+    copy_words(arrays->first_groups, fg_offset, fgsz);
+    copy_words(arrays->indexes, index_offset, isz);
+    arrays->data.resize(dsz);
+    std::memcpy(arrays->data.data(), bytes + data_offset, dsz * sizeof(FP));
+    arrays->derivs.resize(dsz);
+    std::memcpy(arrays->derivs.data(), bytes + derivs_offset, dsz * sizeof(FP));
+    set_storage(std::move(arrays));
+  }
+  return 0;
+#else
+  Insist(false, "Memory mapped CSK files require POSIX mmap: " + filename);
+  return 4;
+#endif
+}
+
 //------------------------------------------------------------------------------------------------//
 // TEMPERATURE INTERPOLATION FUNCTIONS
 //------------------------------------------------------------------------------------------------//
@@ -509,53 +694,457 @@ void Compton_Native::interp_nonlin_diff_and_add(vec_d &outscat, double Te_keV, c
 }
 
 //------------------------------------------------------------------------------------------------//
-// UNIMPLEMENTED, POTENTIAL FUTURE FUNCTIONS
+// BATCHED (MULTI-CELL) TEMPERATURE INTERPOLATION FUNCTIONS
 //------------------------------------------------------------------------------------------------//
 
-#if 0
-void Compton_Native::interp_matvec(vec_d &x, const vec_d &leftscale,
-                             const vec_d &rightscale, double Te_keV,
-                             bool zeroth_moment_only) const {
-  // TODO: Redo interface? Not in-place??
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Sort cells by temperature bracket and compute the Hermite functions of each cell
+ *
+ * \param[in] num_cells Number of cells
+ * \param[in] Te_keV The electron temperature in keV of each cell
+ * \param[out] order Cell indices sorted (stably) by temperature bracket
+ * \param[out] bracket_offsets The cells of bracket iT are order[bracket_offsets[iT]] to
+ *               order[bracket_offsets[iT+1]-1]
+ * \param[out] hermites The Hermite functions of each cell
+ */
+void Compton_Native::group_by_bracket(size_t num_cells, const double *Te_keV,
+                                      std::vector<size_t> &order,
+                                      std::vector<size_t> &bracket_offsets,
+                                      std::vector<std::array<double, 4>> &hermites) const {
+  const size_t num_brackets = num_temperatures_ - 1U;
+  std::vector<size_t> iTs(num_cells);
+  hermites.resize(num_cells);
+  bracket_offsets.assign(num_brackets + 1U, 0U);
+  for (size_t c = 0; c < num_cells; ++c) {
+    double Teff = Te_keV[c];
+    iTs[c] = rtt_compton_tools::find_index(Ts_, Teff);
+    hermites[c] = rtt_compton_tools::hermite<double>(Teff, Ts_[iTs[c]], Ts_[iTs[c] + 1U]);
+    ++bracket_offsets[iTs[c] + 1U];
+  }
 
-  const vec_d &L = leftscale;
-  const vec_d &R = rightscale;
-  double const T = std::min(Ts_[num_temperatures_ - 1], std::max(Ts_[0], Te_keV));
-  size_t const end_leg = zeroth_moment_only ? 1U : num_leg_moments_;
-  // TODO: implement
+  // Counting sort by bracket
+  for (size_t b = 0; b < num_brackets; ++b)
+    bracket_offsets[b + 1U] += bracket_offsets[b];
+  std::vector<size_t> next(bracket_offsets.begin(), bracket_offsets.end() - 1);
+  order.resize(num_cells);
+  for (size_t c = 0; c < num_cells; ++c)
+    order[next[iTs[c]]++] = c;
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Interpolate csk data in temperature and return dense linear inscattering matrices of many
+ *        cells
+ *
+ * \param[in] num_cells Number of cells
+ * \param[in] Te_keV The electron temperature in keV of each cell [num_cells]
+ * \param[in] num_moments_truncate The maximum number of Legendre moments to use
+ * \param[out] inscat The flattened (1D), dense inscattering matrices with order (slow) [cell,
+ *               moment, group-to, group-from] (fast). Must hold num_cells * G * G *
+ *               min(num_moments_truncate, number of moments) values; it is zeroed before it is
+ *               filled.
+ *
+ * Each cell's matrix is the one the single-temperature interp_dense_inscat returns.
+ */
+void Compton_Native::interp_dense_inscat(size_t num_cells, const double *Te_keV,
+                                         size_t num_moments_truncate, double *inscat) const {
+  Require(num_cells == 0 || (Te_keV != nullptr && inscat != nullptr));
+
+  std::vector<size_t> order;
+  std::vector<size_t> bracket_offsets;
+  std::vector<std::array<double, 4>> hermites;
+  group_by_bracket(num_cells, Te_keV, order, bracket_offsets, hermites);
+
+  // Precompute some sparse indexes
+  const size_t G = num_groups_;
+  const size_t sz = indexes_[indexes_.size() - 1];
+  const size_t end_leg = std::min(num_moments_truncate, num_leg_moments_);
+  const size_t eval_offset = 0; // in_lin
+  const size_t cell_size = end_leg * G * G;
+
+  std::fill(inscat, inscat + num_cells * cell_size, 0.0);
+
+  // Apply Hermite function, one temperature bracket at a time
+  for (size_t iT = 0; iT + 1U < num_temperatures_; ++iT) {
+    const size_t cbegin = bracket_offsets[iT];
+    const size_t cend = bracket_offsets[iT + 1U];
+    if (cbegin == cend)
+      continue;
+    for (size_t k = 0; k < end_leg; ++k) {
+      for (size_t gfrom = 0; gfrom < G; ++gfrom) {
+        const size_t offset_jj = gfrom + G * G * k;
+        // Get contributions from both Ts_[iT] and Ts_[iT+1]
+        for (size_t n = 0; n < 2U; ++n) {
+          const size_t i = gfrom + G * (iT + n);
+          const size_t first_gto = first_groups_[i];
+          const size_t num_entries = indexes_[i + 1U] - indexes_[i];
+          const size_t offset_ii = indexes_[i] + sz * k + eval_offset;
+          for (size_t oc = cbegin; oc < cend; ++oc) {
+            const size_t c = order[oc];
+            const double h0 = hermites[c][0U + n];
+            const double h2 = hermites[c][2U + n];
+            double *const cell_inscat = inscat + c * cell_size + offset_jj;
+            for (size_t dg = 0; dg < num_entries; ++dg) {
+              const size_t ii = dg + offset_ii;
+              cell_inscat[(dg + first_gto) * G] += h0 * data_[ii] + h2 * derivs_[ii];
+            }
+          }
+        }
+      }
+    }
+  }
 }
 
 //------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Interpolate csk data in temperature and return linear outscattering vectors of many cells
+ *
+ * \param[in] num_cells Number of cells
+ * \param[in] Te_keV The electron temperature in keV of each cell [num_cells]
+ * \param[out] outscat The linear outscattering with order [cell, group-from]. Must hold
+ *               num_cells * G values; it is zeroed before it is filled.
+ */
+void Compton_Native::interp_linear_outscat(size_t num_cells, const double *Te_keV,
+                                           double *outscat) const {
+  Require(num_cells == 0 || (Te_keV != nullptr && outscat != nullptr));
+
+  std::vector<size_t> order;
+  std::vector<size_t> bracket_offsets;
+  std::vector<std::array<double, 4>> hermites;
+  group_by_bracket(num_cells, Te_keV, order, bracket_offsets, hermites);
+
+  // Precompute some sparse indexes
+  const size_t G = num_groups_;
+  const size_t sz = indexes_[indexes_.size() - 1];
+  const size_t eval_offset = sz * num_leg_moments_; // out_lin
 
+  std::fill(outscat, outscat + num_cells * G, 0.0);
+
+  // Apply Hermite function, one temperature bracket at a time
+  for (size_t iT = 0; iT + 1U < num_temperatures_; ++iT) {
+    const size_t cbegin = bracket_offsets[iT];
+    const size_t cend = bracket_offsets[iT + 1U];
+    if (cbegin == cend)
+      continue;
+    for (size_t gfrom = 0; gfrom < G; ++gfrom) {
+      // Get contributions from both Ts_[iT] and Ts_[iT+1U]; the row sums are shared by all cells
+      for (size_t n = 0; n < 2U; ++n) {
+        const size_t i = gfrom + G * (iT + n);
+        const size_t num_entries = indexes_[i + 1U] - indexes_[i];
+        const size_t offset = indexes_[i] + eval_offset;
+        double data_sum = 0.0;
+        double derivs_sum = 0.0;
+        for (size_t dg = 0; dg < num_entries; ++dg) {
+          data_sum += data_[dg + offset];
+          derivs_sum += derivs_[dg + offset];
+        }
+        for (size_t oc = cbegin; oc < cend; ++oc) {
+          const size_t c = order[oc];
+          outscat[c * G + gfrom] +=
+              hermites[c][0U + n] * data_sum + hermites[c][2U + n] * derivs_sum;
+        }
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Interpolate csk data in temperature and add nonlinear differences to the outscattering of
+ *        many cells
+ *
+ * \param[in] num_cells Number of cells
+ * \param[in] Te_keV The electron temperature in keV of each cell [num_cells]
+ * \param[in] phi The multigroup radiation field of each cell, with order [cell, group]
+ * \param[in] scale The scale for phi of each cell [num_cells]
+ * \param[in,out] outscat The net outscattering with order [cell, group-from]; MUST be initialized
+ *               with data prior to calling (e.g. by the batched interp_linear_outscat)
+ */
+void Compton_Native::interp_nonlin_diff_and_add(size_t num_cells, const double *Te_keV,
+                                                const double *phi, const double *scale,
+                                                double *outscat) const {
+  Require(num_cells == 0 ||
+          (Te_keV != nullptr && phi != nullptr && scale != nullptr && outscat != nullptr));
+
+  std::vector<size_t> order;
+  std::vector<size_t> bracket_offsets;
+  std::vector<std::array<double, 4>> hermites;
+  group_by_bracket(num_cells, Te_keV, order, bracket_offsets, hermites);
+
+  // Precompute some sparse indexes
+  const size_t G = num_groups_;
+  const size_t sz = indexes_[indexes_.size() - 1];
+  const size_t eval_offset = sz * (num_leg_moments_ + 1U); // nl_diff
+
+  // Apply Hermite function, one temperature bracket at a time
+  for (size_t iT = 0; iT + 1U < num_temperatures_; ++iT) {
+    const size_t cbegin = bracket_offsets[iT];
+    const size_t cend = bracket_offsets[iT + 1U];
+    if (cbegin == cend)
+      continue;
+    for (size_t gfrom = 0; gfrom < G; ++gfrom) {
+      // Get contributions from both Ts_[iT] and Ts_[iT+1U]
+      for (size_t n = 0; n < 2U; ++n) {
+        const size_t i = gfrom + G * (iT + n);
+        const size_t first_gto = first_groups_[i];
+        const size_t num_entries = indexes_[i + 1U] - indexes_[i];
+        const size_t offset = indexes_[i] + eval_offset;
+        for (size_t oc = cbegin; oc < cend; ++oc) {
+          const size_t c = order[oc];
+          const double h0 = hermites[c][0U + n];
+          const double h2 = hermites[c][2U + n];
+          const double invscale = scale[c] > 0.0 ? 1.0 / scale[c] : 0.0;
+          const double *const cell_phi = phi + c * G + first_gto;
+          double sum = 0.0;
+          for (size_t dg = 0; dg < num_entries; ++dg) {
+            const size_t ii = dg + offset;
+            sum += cell_phi[dg] * (h0 * data_[ii] + h2 * derivs_[ii]);
+          }
+          outscat[c * G + gfrom] += invscale * sum;
+        }
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------------------------//
+// MATRIX-FREE (FUSED INTERPOLATION AND MULTIPLICATION) FUNCTIONS
+//------------------------------------------------------------------------------------------------//
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Interpolate csk data in temperature and multiply the linear inscattering against vectors
+ *
+ * \param[in,out] x The vectors to multiply, with order (slow) [rhs, moment, group] (fast); on
+ *               output overwritten by diag(leftscale) * inscat(Te_keV) * diag(rightscale) * x,
+ *               where inscat is the matrix interp_dense_inscat returns
+ * \param[in] leftscale Scaling of each group-to (empty for no scaling)
+ * \param[in] rightscale Scaling of each group-from (empty for no scaling)
+ * \param[in] Te_keV The electron temperature in keV at which the interpolation is desired
+ * \param[in] zeroth_moment_only If true, only the zeroth Legendre moment is used and x holds one
+ *               moment per rhs
+ * \param[in] num_rhs Number of vectors (right-hand sides) in x
+ *
+ * The Hermite temperature blend is applied to each sparse row as it is multiplied, so the dense
+ * matrix is never formed and every row of data_ and derivs_ is streamed exactly once for all
+ * moments and all right-hand sides. The blended row is reused by every right-hand side and the
+ * innermost loops run over the contiguous group-to band.
+ */
+void Compton_Native::interp_matvec(vec_d &x, const vec_d &leftscale, const vec_d &rightscale,
+                                   double Te_keV, bool zeroth_moment_only, size_t num_rhs) const {
+  const size_t G = num_groups_;
+  const size_t end_leg = zeroth_moment_only ? 1U : num_leg_moments_;
+  Require(num_rhs > 0U);
+  Require(x.size() == num_rhs * end_leg * G);
+  Require(leftscale.empty() || leftscale.size() == G);
+  Require(rightscale.empty() || rightscale.size() == G);
+
+  double Teff = Te_keV;
+  const size_t iT = rtt_compton_tools::find_index(Ts_, Teff);
+  const std::array<double, 4> hermite =
+      rtt_compton_tools::hermite<double>(Teff, Ts_[iT], Ts_[iT + 1U]);
+  const size_t sz = indexes_[indexes_.size() - 1];
+  const size_t eval_offset = 0; // in_lin
+  const size_t stride = end_leg * G; // between right-hand sides
+
+  // one blended sparse row, shared by all right-hand sides
+  vec_d row(G);
+  vec_d y(x.size(), 0.0);
+  for (size_t gfrom = 0; gfrom < G; ++gfrom) {
+    const double rscale = rightscale.empty() ? 1.0 : rightscale[gfrom];
+    // Get contributions from both Ts_[iT] and Ts_[iT+1]
+    for (size_t n = 0; n < 2U; ++n) {
+      const size_t i = gfrom + G * (iT + n);
+      const size_t first_gto = first_groups_[i];
+      const size_t num_entries = indexes_[i + 1U] - indexes_[i];
+      const double h0 = hermite[0U + n];
+      const double h2 = hermite[2U + n];
+      for (size_t k = 0; k < end_leg; ++k) {
+        const double *const data = data_.data() + indexes_[i] + sz * k + eval_offset;
+        const double *const derivs = derivs_.data() + indexes_[i] + sz * k + eval_offset;
+        for (size_t dg = 0; dg < num_entries; ++dg)
+          row[dg] = h0 * data[dg] + h2 * derivs[dg];
+        for (size_t r = 0; r < num_rhs; ++r) {
+          const double xval = rscale * x[r * stride + k * G + gfrom];
+          double *const out = y.data() + r * stride + k * G + first_gto;
+          for (size_t dg = 0; dg < num_entries; ++dg)
+            out[dg] += row[dg] * xval;
+        }
+      }
+    }
+  }
+
+  if (!leftscale.empty())
+    for (size_t j = 0; j < y.size(); ++j)
+      y[j] *= leftscale[j % G];
+  x.swap(y);
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Interpolate csk data in temperature and transpose-multiply the linear inscattering
+ *
+ * \param[in,out] xT The row vectors to multiply, with order (slow) [rhs, moment, group] (fast); on
+ *               output overwritten by xT * diag(leftscale) * inscat(Te_keV) * diag(rightscale)
+ * \param[in] leftscale Scaling of each group-to (empty for no scaling)
+ * \param[in] rightscale Scaling of each group-from (empty for no scaling)
+ * \param[in] Te_keV The electron temperature in keV at which the interpolation is desired
+ * \param[in] zeroth_moment_only If true, only the zeroth Legendre moment is used and xT holds one
+ *               moment per rhs
+ * \param[in] num_rhs Number of vectors (right-hand sides) in xT
+ *
+ * Fused like interp_matvec; each sparse row becomes a dot product over its group-to band.
+ */
 void Compton_Native::interp_matvec_transpose(vec_d &xT, const vec_d &leftscale,
-                                       const vec_d &rightscale, double Te_keV,
-                                       bool zeroth_moment_only) const {
-  // TODO: Redo interface? Not in-place??
+                                             const vec_d &rightscale, double Te_keV,
+                                             bool zeroth_moment_only, size_t num_rhs) const {
+  const size_t G = num_groups_;
+  const size_t end_leg = zeroth_moment_only ? 1U : num_leg_moments_;
+  Require(num_rhs > 0U);
+  Require(xT.size() == num_rhs * end_leg * G);
+  Require(leftscale.empty() || leftscale.size() == G);
+  Require(rightscale.empty() || rightscale.size() == G);
 
-  const vec_d &L = leftscale;
-  const vec_d &R = rightscale;
-  double const T = std::min(Ts_[num_temperatures_ - 1], std::max(Ts_[0], Te_keV));
-  size_t const end_leg = zeroth_moment_only ? 1U : num_leg_moments_;
-  // TODO: implement
+  double Teff = Te_keV;
+  const size_t iT = rtt_compton_tools::find_index(Ts_, Teff);
+  const std::array<double, 4> hermite =
+      rtt_compton_tools::hermite<double>(Teff, Ts_[iT], Ts_[iT + 1U]);
+  const size_t sz = indexes_[indexes_.size() - 1];
+  const size_t eval_offset = 0; // in_lin
+  const size_t stride = end_leg * G; // between right-hand sides
+
+  if (!leftscale.empty())
+    for (size_t j = 0; j < xT.size(); ++j)
+      xT[j] *= leftscale[j % G];
+
+  // one blended sparse row, shared by all right-hand sides
+  vec_d row(G);
+  vec_d y(xT.size(), 0.0);
+  for (size_t gfrom = 0; gfrom < G; ++gfrom) {
+    // Get contributions from both Ts_[iT] and Ts_[iT+1]
+    for (size_t n = 0; n < 2U; ++n) {
+      const size_t i = gfrom + G * (iT + n);
+      const size_t first_gto = first_groups_[i];
+      const size_t num_entries = indexes_[i + 1U] - indexes_[i];
+      const double h0 = hermite[0U + n];
+      const double h2 = hermite[2U + n];
+      for (size_t k = 0; k < end_leg; ++k) {
+        const double *const data = data_.data() + indexes_[i] + sz * k + eval_offset;
+        const double *const derivs = derivs_.data() + indexes_[i] + sz * k + eval_offset;
+        for (size_t dg = 0; dg < num_entries; ++dg)
+          row[dg] = h0 * data[dg] + h2 * derivs[dg];
+        for (size_t r = 0; r < num_rhs; ++r) {
+          const double *const in = xT.data() + r * stride + k * G + first_gto;
+          double sum = 0.0;
+          for (size_t dg = 0; dg < num_entries; ++dg)
+            sum += row[dg] * in[dg];
+          y[r * stride + k * G + gfrom] += sum;
+        }
+      }
+    }
+  }
+
+  if (!rightscale.empty())
+    for (size_t j = 0; j < y.size(); ++j)
+      y[j] *= rightscale[j % G];
+  xT.swap(y);
 }
 
 //------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Interpolate csk data in temperature and return sparse linear inscattering matrices
+ *
+ * \param[out] inscat The sparse inscattering matrix with one point per temperature; replaced with
+ *               a matrix of the right size. Each point holds the same matrix (moment, group-to,
+ *               group-from) that interp_dense_inscat returns at its temperature.
+ * \param[in] Te_keV The electron temperatures in keV at which the interpolation is desired
+ * \param[in] zeroth_moment_only If true, only the zeroth Legendre moment is interpolated
+ *
+ * The band of nonzero group-to values of each row is the union of the bands of the two bracketing
+ * temperatures, so the matrix is as sparse as the CSK data itself.
+ */
+void Compton_Native::interp_sparse_inscat(Sparse_Compton_Matrix &inscat, const vec_d &Te_keV,
+                                          bool zeroth_moment_only) const {
+  Require(Te_keV.size() > 0U);
 
-void Compton_Native::interp_sparse_inscat(Sparse_Compton_Matrix &inscat,
-                                    const vec_d &leftscale, const vec_d &rightscale,
-                                    double Te_keV,
-                                    bool zeroth_moment_only) const {
-  // TODO: Allow offset to fill in data?
+  const size_t num_points = Te_keV.size();
+  const size_t G = num_groups_;
+  const size_t sz = indexes_[indexes_.size() - 1];
+  const size_t end_leg = zeroth_moment_only ? 1U : num_leg_moments_;
+  const size_t eval_offset = 0; // in_lin
 
-  const vec_d &L = leftscale;
-  const vec_d &R = rightscale;
-  double const T = std::min(Ts_[num_temperatures_ - 1], std::max(Ts_[0], Te_keV));
-  size_t const end_leg = zeroth_moment_only ? 1U : num_leg_moments_;
-  // TODO: implement
+  // Find the temperature brackets and Hermite functions of every point
+  std::vector<size_t> iTs(num_points);
+  std::vector<std::array<double, 4>> hermites(num_points);
+  for (size_t p = 0; p < num_points; ++p) {
+    double Teff = Te_keV[p];
+    iTs[p] = rtt_compton_tools::find_index(Ts_, Teff);
+    hermites[p] = rtt_compton_tools::hermite<double>(Teff, Ts_[iTs[p]], Ts_[iTs[p] + 1U]);
+  }
+
+  // Sparsity pattern: union of the bands at Ts_[iT] and Ts_[iT+1]
+  std::vector<size_t> first_groups(num_points * G);
+  std::vector<size_t> indexes(num_points * G + 1U, 0U);
+  for (size_t p = 0; p < num_points; ++p) {
+    for (size_t gfrom = 0; gfrom < G; ++gfrom) {
+      const size_t i0 = gfrom + G * iTs[p];
+      const size_t i1 = i0 + G;
+      const size_t n0 = indexes_[i0 + 1U] - indexes_[i0];
+      const size_t n1 = indexes_[i1 + 1U] - indexes_[i1];
+      // empty rows do not widen the band
+      const size_t first = n0 == 0 ? first_groups_[i1]
+                           : n1 == 0
+                               ? first_groups_[i0]
+                               : std::min(first_groups_[i0], first_groups_[i1]);
+      const size_t last = std::max(n0 == 0 ? first : first_groups_[i0] + n0,
+                                   n1 == 0 ? first : first_groups_[i1] + n1);
+      const size_t j = gfrom + G * p;
+      first_groups[j] = first;
+      indexes[j + 1U] = indexes[j] + last - first;
+    }
+  }
+
+  const size_t num_entries = indexes.back();
+  inscat = Sparse_Compton_Matrix(num_points, G, end_leg, num_entries);
+  inscat.ref_first_groups() = std::move(first_groups);
+  inscat.ref_indexes() = std::move(indexes);
+  const std::vector<size_t> &fg = inscat.ref_first_groups();
+  const std::vector<size_t> &idx = inscat.ref_indexes();
+  std::vector<double> &data = inscat.ref_data();
+
+  // Apply Hermite function
+  for (size_t k = 0; k < end_leg; ++k) {
+    for (size_t p = 0; p < num_points; ++p) {
+      const std::array<double, 4> &hermite = hermites[p];
+      for (size_t gfrom = 0; gfrom < G; ++gfrom) {
+        const size_t j = gfrom + G * p;
+        double *const row = data.data() + k * num_entries + idx[j];
+        // Get contributions from both Ts_[iT] and Ts_[iT+1]
+        for (size_t n = 0; n < 2U; ++n) {
+          const size_t i = gfrom + G * (iTs[p] + n);
+          const size_t num_row_entries = indexes_[i + 1U] - indexes_[i];
+          const size_t offset_ii = indexes_[i] + sz * k + eval_offset;
+          if (num_row_entries == 0)
+            continue;
+          const size_t shift = first_groups_[i] - fg[j];
+          for (size_t dg = 0; dg < num_row_entries; ++dg) {
+            const size_t ii = dg + offset_ii;
+            row[dg + shift] += hermite[0U + n] * data_[ii] + hermite[2U + n] * derivs_[ii];
+          }
+        }
+      }
+    }
+  }
+
+  Ensure(inscat.check_class_invariants());
 }
 
+//------------------------------------------------------------------------------------------------//
+// UNIMPLEMENTED, POTENTIAL FUTURE FUNCTIONS
 //------------------------------------------------------------------------------------------------//
 
+#if 0
 void Compton_Native::interp_dense_inscat(vec_d &inscat, const vec_d &leftscale,
                                    const vec_d &rightscale, double Te_keV,
                                    bool zeroth_moment_only) const {
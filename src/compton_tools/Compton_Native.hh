@@ -10,10 +10,12 @@
 #ifndef rtt_compton_tools_Compton_Native_hh
 #define rtt_compton_tools_Compton_Native_hh
 
+#include "compton_tools/Sparse_Compton_Matrix.hh"
+#include <array>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
-//#include "compton_tools/Sparse_Compton_Matrix.hh"
 
 namespace rtt_compton_tools {
 
@@ -47,7 +49,7 @@ public:
   //----------------------------------------------------------------------------------------------//
 
   // \brief Constructor
-  explicit Compton_Native(const std::string &filename);
+  explicit Compton_Native(const std::string &filename, bool memory_map = false);
 
   //----------------------------------------------------------------------------------------------//
   // TEMPERATURE INTERPOLATION FUNCTIONS
@@ -69,35 +71,47 @@ public:
   void interp_nonlin_diff_and_add(std::vector<double> &outscat, double Te_keV,
                                   const std::vector<double> &phi, double scale) const;
 
-  //----------------------------------------------------------------------------------------------//
-  // UNIMPLEMENTED, POTENTIAL FUTURE FUNCTIONS
-  //----------------------------------------------------------------------------------------------//
+  // Batched versions of the three functions above for many cells: interpolate at the temperature
+  // of each cell and fill contiguous, caller-sized outputs ordered by cell first. Cells are grouped
+  // by temperature bracket so each sparse CSK row is streamed once per bracket, not once per cell.
 
-#if 0
-  // Interpolate in temperature and multiply against a vector in-place
+  // Dense linear inscattering with ordering [cell, Legendre moment, group to, group from].
+  void interp_dense_inscat(size_t num_cells, const double *Te_keV, size_t num_moments_truncate,
+                           double *inscat) const;
+
+  // Linear outscattering with ordering [cell, group from].
+  void interp_linear_outscat(size_t num_cells, const double *Te_keV, double *outscat) const;
+
+  // Adds the nonlinear difference of each cell to \c outscat [cell, group from], with phi ordered
+  // [cell, group] and one scale per cell.
+  void interp_nonlin_diff_and_add(size_t num_cells, const double *Te_keV, const double *phi,
+                                  const double *scale, double *outscat) const;
+
+  // Interpolate in temperature and multiply against a vector in-place, without forming the matrix
   // x := diag(leftscale) * csk[in_lin](Te_keV) * diag(rightscale) * x
-  void interp_matvec(std::vector<double> &x,
-                     const std::vector<double> &leftscale,
+  // x holds num_rhs vectors with ordering [rhs, Legendre moment, group]; empty scales are unity.
+  void interp_matvec(std::vector<double> &x, const std::vector<double> &leftscale,
                      const std::vector<double> &rightscale, double Te_keV,
-                     bool zeroth_moment_only = false) const;
+                     bool zeroth_moment_only = false, size_t num_rhs = 1U) const;
 
   // Interpolate in temperature and transpose-multiply against a vector in-place
   // xT := xT * diag(leftscale) * csk[in_lin](Te_keV) * diag(rightscale)
-  void interp_matvec_transpose(std::vector<double> &xT,
-                               const std::vector<double> &leftscale,
-                               const std::vector<double> &rightscale,
-                               double Te_keV,
-                               bool zeroth_moment_only = false) const;
-
-  // Interpolate in temperature and return sparse in-scattering
-  // inscat := diag(leftscale) * csk[in_lin](Te_keV) * diag(rightscale)
-  void interp_sparse_inscat(Sparse_Compton_Matrix &inscat,
-                            const std::vector<double> &leftscale,
-                            const std::vector<double> &rightscale,
-                            double Te_keV,
+  // xT holds num_rhs vectors with ordering [rhs, Legendre moment, group]; empty scales are unity.
+  void interp_matvec_transpose(std::vector<double> &xT, const std::vector<double> &leftscale,
+                               const std::vector<double> &rightscale, double Te_keV,
+                               bool zeroth_moment_only = false, size_t num_rhs = 1U) const;
+
+  // Interpolate CSK data in temperature for the linear inscattering at each of a set of points
+  // (one electron temperature per point) and return the sparse matrix of all points. Only the
+  // zeroth Legendre moment is stored if zeroth_moment_only is true.
+  void interp_sparse_inscat(Sparse_Compton_Matrix &inscat, const std::vector<double> &Te_keV,
                             bool zeroth_moment_only = false) const;
 
+  //----------------------------------------------------------------------------------------------//
+  // UNIMPLEMENTED, POTENTIAL FUTURE FUNCTIONS
+  //----------------------------------------------------------------------------------------------//
 
+#if 0
   // Interpolate in temperature and return dense in-scattering
   // inscat := diag(leftscale) * csk[in_lin](Te_keV) * diag(rightscale)
   // (internally must transpose array)
@@ -140,6 +154,9 @@ public:
   const std::vector<double> &get_Ts() const { return Ts_; }
   const std::vector<double> &get_Egs() const { return Egs_; }
 
+  // True if the sparse CSK arrays are used in place from a read-only mapping of the file
+  bool is_zero_copy() const { return zero_copy_; }
+
   //----------------------------------------------------------------------------------------------//
   // Size checks for valid state
   bool check_class_invariants() const {
@@ -157,6 +174,32 @@ public:
   }
 
 private:
+  //----------------------------------------------------------------------------------------------//
+  // PRIVATE TYPES
+  //----------------------------------------------------------------------------------------------//
+
+  //! Read-only view of a contiguous array owned elsewhere (heap vectors or a file mapping)
+  template <typename T> class Array_View {
+  public:
+    Array_View() = default;
+    Array_View(const T *ptr, size_t len) : ptr_(ptr), len_(len) {}
+    const T &operator[](size_t i) const { return ptr_[i]; }
+    const T *data() const { return ptr_; }
+    size_t size() const { return len_; }
+
+  private:
+    const T *ptr_{nullptr};
+    size_t len_{0U};
+  };
+
+  //! Heap storage of the sparse CSK arrays (used when they are not mapped in place)
+  struct Sparse_Arrays {
+    std::vector<size_t> first_groups;
+    std::vector<size_t> indexes;
+    std::vector<double> data;
+    std::vector<double> derivs;
+  };
+
   //----------------------------------------------------------------------------------------------//
   // PRIVATE DATA
   //----------------------------------------------------------------------------------------------//
@@ -176,33 +219,48 @@ private:
   // Energy grid (MG energy boundaries) for CSK data (keV)
   std::vector<double> Egs_{};
 
-  // sparse data storage
+  // sparse data storage; the views below point into it. Shared by copies of this object.
+  std::shared_ptr<const void> storage_{};
+
+  // true if storage_ is a read-only mapping of the CSK file used in place
+  bool zero_copy_{false};
 
   // first group-to with nonzero value
   // 1D array of [temperature, group-from]
-  std::vector<size_t> first_groups_{};
+  Array_View<size_t> first_groups_{};
 
   // cumulative sum of row offsets into data_ and derivs_
   // 1D array of [temperature, group-from]
-  std::vector<size_t> indexes_{};
+  Array_View<size_t> indexes_{};
 
   // CSK data
   // 1D array of [eval, moment, temperature, group-from, group-to]
-  std::vector<double> data_{};
+  Array_View<double> data_{};
 
   // temperature derivatives of CSK data
   // 1D array of [eval, moment, temperature, group-from, group-to]
-  std::vector<double> derivs_{};
+  Array_View<double> derivs_{};
 
   //----------------------------------------------------------------------------------------------//
   // PRIVATE HELPER FUNCTIONS
   //----------------------------------------------------------------------------------------------//
 
   // broadcast data over MPI
-  void broadcast_MPI(int errcode);
+  void broadcast_MPI(int errcode, Sparse_Arrays &arrays);
 
   // read the binary file
-  int read_binary(const std::string &filename);
+  int read_binary(const std::string &filename, Sparse_Arrays &arrays);
+
+  // map the binary file read-only and use (or copy) its sparse arrays
+  int map_binary(const std::string &filename);
+
+  // take ownership of heap arrays and point the views at them
+  void set_storage(std::shared_ptr<const Sparse_Arrays> arrays);
+
+  // sort cells by temperature bracket and compute their Hermite functions
+  void group_by_bracket(size_t num_cells, const double *Te_keV, std::vector<size_t> &order,
+                        std::vector<size_t> &bracket_offsets,
+                        std::vector<std::array<double, 4>> &hermites) const;
 };
 
 } // namespace rtt_compton_tools
@@ -9,43 +9,118 @@
 //------------------------------------------------------------------------------------------------//
 
 #include "compton_tools/Sparse_Compton_Matrix.hh"
-#include "c4/global.hh"
 #include "ds++/Assert.hh"
-#include <iostream>
+#include <algorithm>
 
 namespace rtt_compton_tools {
 
-#ifdef 0
+//------------------------------------------------------------------------------------------------//
 /*!
- * \brief Data container class for a sparse Compton matrix representation. Not yet implemented.
+ * \brief Data container class for a sparse Compton matrix representation.
+ *
+ * \param[in] num_points Number of points (cells, temperatures) with their own matrix
+ * \param[in] num_groups Number of energy groups
+ * \param[in] num_leg_moments Number of Legendre moments stored for each point
+ * \param[in] num_entries Number of stored entries of each moment (sum of all row lengths)
+ *
+ * The sparsity pattern (first groups and indexes) is zero and must be filled together with the
+ * data before the matrix is used.
  */
 Sparse_Compton_Matrix::Sparse_Compton_Matrix(size_t num_points, size_t num_groups,
-                                             size_t num_leg_moments, size_t data_len)
+                                             size_t num_leg_moments, size_t num_entries)
     : num_points_(num_points), num_groups_(num_groups), num_leg_moments_(num_leg_moments),
       first_groups_(num_points * num_groups, 0U), indexes_(num_points * num_groups + 1U, 0U),
-      data_(data_len, 0.0) {
+      data_(num_entries * num_leg_moments, 0.0) {
   Require(num_points >= 1U);
   Require(num_groups >= 1U);
   Require(num_leg_moments >= 1U);
-  Require(data_len >= (num_points * num_groups * num_leg_moments));
 
-  std::cout << "SCM constructor not yet fully implemented\n";
   Ensure(check_class_invariants());
 }
 
-void Sparse_Compton_Matrix::resize_data(size_t data_len) {
-  Require(data_len >= (num_points_ * num_groups_ * num_leg_moments_));
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Resize the data for a new number of stored entries per Legendre moment.
+ *
+ * \param[in] num_entries Number of stored entries of each moment (sum of all row lengths)
+ */
+void Sparse_Compton_Matrix::resize_data(size_t num_entries) {
+  Require(num_entries >= indexes_.back());
 
-  data_.resize(data_len, 0.0);
+  data_.resize(num_entries * num_leg_moments_, 0.0);
 
   Ensure(check_class_invariants());
 }
 
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Multiply the matrix against a vector in-place.
+ *
+ * \param[in,out] x Flattened vector with order (slow) [moment, point, group] (fast); on output it
+ *                  is overwritten by the matrix-vector product.  Must have (number of moments) *
+ *                  (number of points) * (number of groups) entries.
+ * \param[in] zeroth_moment_only If true, only the zeroth moment is multiplied and x holds only the
+ *                  zeroth moment ((number of points) * (number of groups) entries)
+ */
 void Sparse_Compton_Matrix::matvec(std::vector<double> &x, bool zeroth_moment_only) const {
-  // TODO: Implement!
-  std::cout << "SCM matvec not yet implemented\n";
+  Require(check_class_invariants());
+  const size_t num_moments = zeroth_moment_only ? 1U : num_leg_moments_;
+  Require(x.size() == num_moments * num_points_ * num_groups_);
+
+  apply(x.data(), x.data(), num_moments);
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Multiply the matrix against a vector out-of-place.
+ *
+ * \param[in] x Flattened vector with order (slow) [moment, point, group-from] (fast)
+ * \param[out] y The matrix-vector product with order [moment, point, group-to]; resized as needed
+ * \param[in] zeroth_moment_only If true, only the zeroth moment is multiplied and x and y hold only
+ *                  the zeroth moment
+ */
+void Sparse_Compton_Matrix::matvec(const std::vector<double> &x, std::vector<double> &y,
+                                   bool zeroth_moment_only) const {
+  Require(check_class_invariants());
+  const size_t num_moments = zeroth_moment_only ? 1U : num_leg_moments_;
+  Require(x.size() == num_moments * num_points_ * num_groups_);
+  Require(&x != &y);
+
+  y.resize(x.size());
+  apply(x.data(), y.data(), num_moments);
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Sparse matrix-vector kernel shared by both matvec forms.
+ *
+ * Each (moment, point) block is independent: its rows are streamed once in storage order and the
+ * product is accumulated in a group-sized buffer before being written to y, so x and y may alias.
+ */
+void Sparse_Compton_Matrix::apply(const double *x, double *y, size_t num_moments) const {
+  const size_t G = num_groups_;
+  const size_t num_entries = indexes_.back();
+  std::vector<double> accum(G);
+
+  for (size_t k = 0; k < num_moments; ++k) {
+    const double *const data_k = data_.data() + k * num_entries;
+    for (size_t p = 0; p < num_points_; ++p) {
+      const size_t offset = (k * num_points_ + p) * G;
+      std::fill(accum.begin(), accum.end(), 0.0);
+      for (size_t gfrom = 0; gfrom < G; ++gfrom) {
+        const size_t i = gfrom + G * p;
+        const double xval = x[offset + gfrom];
+        const double *const row = data_k + indexes_[i];
+        double *const out = accum.data() + first_groups_[i];
+        const size_t num_row_entries = indexes_[i + 1U] - indexes_[i];
+        Check(first_groups_[i] + num_row_entries <= G);
+        for (size_t dg = 0; dg < num_row_entries; ++dg)
+          out[dg] += row[dg] * xval;
+      }
+      std::copy(accum.begin(), accum.end(), y + offset);
+    }
+  }
 }
-#endif
 
 } // namespace rtt_compton_tools
 
@@ -10,6 +10,7 @@
 #ifndef rtt_compton_tools_Sparse_Compton_Matrix_hh
 #define rtt_compton_tools_Sparse_Compton_Matrix_hh
 
+#include <cstddef>
 #include <vector>
 
 namespace rtt_compton_tools {
@@ -22,19 +23,24 @@ namespace rtt_compton_tools {
  *        arbitrary number of points, where each point represents an M x G x G matrix (moments,
  *        groups)
  *
- * THIS CLASS IS A STUB (not yet fully implemented or used)
-*/
+ * The sparsity pattern follows the CSK data: each (point, group-from) row stores the contiguous
+ * band of group-to values starting at first_groups_[row], with indexes_[row] the offset of the band
+ * in the data.  The band is shared by all Legendre moments, which are stored in turn, so moment k
+ * of a row lives at data_[k * get_num_entries() + indexes_[row] + (gto - first_groups_[row])].
+ *
+ * The storage is O(P * G * bandwidth * M) instead of the O(P * G * G * M) of dense inscattering
+ * matrices.  A filled matrix is usually obtained from Compton_Native::interp_sparse_inscat.
+ */
 //================================================================================================//
 class Sparse_Compton_Matrix {
 
-#ifdef 0
 public:
   // Construct with zeros and known sizes
   Sparse_Compton_Matrix(size_t num_points, size_t num_groups, size_t num_leg_moments,
-                        size_t data_len);
+                        size_t num_entries);
 
-  // Resize data
-  void resize_data(size_t data_len);
+  // Resize data for a new number of stored entries per moment
+  void resize_data(size_t num_entries);
 
   // Access internal data for manual filling
 
@@ -51,18 +57,25 @@ public:
   // x := matrix * x
   void matvec(std::vector<double> &x, bool zeroth_moment_only = false) const;
 
+  // Multiply against a vector out-of-place
+  // y := matrix * x
+  void matvec(const std::vector<double> &x, std::vector<double> &y,
+              bool zeroth_moment_only = false) const;
+
   // Accessor functions
   size_t get_num_points() const { return num_points_; }
   size_t get_num_groups() const { return num_groups_; }
   size_t get_num_leg_moments() const { return num_leg_moments_; }
   size_t get_highest_leg_moment() const { return num_leg_moments_ - 1U; }
+  size_t get_num_entries() const { return indexes_.back(); }
 
   // Size checks for valid state
   bool check_class_invariants() const {
     bool all_good = (num_points_ > 0U) && (num_groups_ > 0U) && (num_leg_moments_ > 0U) &&
                     (first_groups_.size() == (num_points_ * num_groups_)) &&
                     (indexes_.size() == (num_points_ * num_groups_ + 1U)) &&
-                    (data_.size() >= num_points_ * num_groups_ * num_leg_moments_) && true;
+                    (indexes_[0] == 0U) &&
+                    (data_.size() >= indexes_.back() * num_leg_moments_) && true;
     return all_good;
   }
 
@@ -77,14 +90,16 @@ private:
   // 1D array of [points, group-from]
   std::vector<size_t> first_groups_;
 
-  // cumulative sum of row offsets into data_ and derivs_
+  // cumulative sum of row offsets into data_
   // 1D array of [points, group-from]
   std::vector<size_t> indexes_;
 
   // csk data
   // 1D array of [moment, point, group-from, group-to]
   std::vector<double> data_;
-#endif
+
+  // y[moment, point, group-to] = sum over group-from of matrix * x[moment, point, group-from]
+  void apply(const double *x, double *y, size_t num_moments) const;
 };
 
 } // namespace rtt_compton_tools
@@ -72,13 +72,13 @@ struct Dense_Compton_Data {
   void read_from_file(UINT64 eval, std::string const &filename, bool isnonlin);
   void compute_nonlinear_difference();
   void compute_temperature_derivatives();
-  void write_sparse_binary(std::string const &fileout);
+  void write_sparse_binary(std::string const &fileout, bool aligned);
   void print_contents(int verbosity, int precision);
 
 private:
   Sparse_Compton_Data copy_to_sparse();
   void print_sparse(const Sparse_Compton_Data &sd);
-  void write_binary(std::string const &fileout, Sparse_Compton_Data &sd);
+  void write_binary(std::string const &fileout, Sparse_Compton_Data &sd, bool aligned);
 };
 
 //------------------------------------------------------------------------------------------------//
@@ -466,10 +466,10 @@ void Dense_Compton_Data::compute_temperature_derivatives() {
 
 //------------------------------------------------------------------------------------------------//
 // Sparsify data and print to binary
-void Dense_Compton_Data::write_sparse_binary(std::string const &fileout) {
+void Dense_Compton_Data::write_sparse_binary(std::string const &fileout, bool aligned) {
   Sparse_Compton_Data sd = copy_to_sparse();
   print_sparse(sd);
-  write_binary(fileout, sd);
+  write_binary(fileout, sd, aligned);
 }
 
 //------------------------------------------------------------------------------------------------//
@@ -676,8 +676,9 @@ void Dense_Compton_Data::print_sparse(const Sparse_Compton_Data &sd) {
 }
 
 //------------------------------------------------------------------------------------------------//
-// Write to binary
-void Dense_Compton_Data::write_binary(std::string const &fileout, Sparse_Compton_Data &sd) {
+// Write to binary (version 1.1 with aligned arrays if requested, else version 1.0)
+void Dense_Compton_Data::write_binary(std::string const &fileout, Sparse_Compton_Data &sd,
+                                      bool aligned) {
   auto fout = std::ofstream(fileout, std::ios::out | std::ios::binary);
 
   // binary type
@@ -685,8 +686,9 @@ void Dense_Compton_Data::write_binary(std::string const &fileout, Sparse_Compton
   std::vector<char> filetype = {' ', 'c', 's', 'k', ' ', '\0'};
   fout.write(&filetype[0], filetype.size() * sizeof(char));
 
+  // version 1.1 pads the header so that every array is 8-byte aligned (and can be memory mapped)
   UINT64 version_major = 1;
-  UINT64 version_minor = 0;
+  UINT64 version_minor = aligned ? 1 : 0;
   // ordering: 0 means leg inside; 1 means leg outside
   UINT64 binary_ordering = 1;
 
@@ -722,6 +724,12 @@ void Dense_Compton_Data::write_binary(std::string const &fileout, Sparse_Compton
   fout.write(reinterpret_cast<char *>(&isz), sizeof(UINT64));
   fout.write(reinterpret_cast<char *>(&dsz), sizeof(UINT64));
 
+  // alignment padding
+  if (aligned) {
+    std::vector<char> padding = {'\0', '\0'};
+    fout.write(&padding[0], padding.size() * sizeof(char));
+  }
+
   // data
   fout.write(reinterpret_cast<char *>(&Ts[0]), tsz * sizeof(FP));
   fout.write(reinterpret_cast<char *>(&groupBdrs[0]), egsz * sizeof(FP));
@@ -825,7 +833,7 @@ void Dense_Compton_Data::print_contents(int verbosity, int precision) {
 /*!
  * \brief Basic reader of the csk ASCII file format
  */
-void read_csk_files(std::string const &basename, int verbosity) {
+void read_csk_files(std::string const &basename, int verbosity, bool aligned) {
   // csk data base filename (csk ASCII format required)
 
 #if 1
@@ -875,7 +883,7 @@ void read_csk_files(std::string const &basename, int verbosity) {
   // Save to binary
   std::string fileout = basename + "_b";
   std::cout << "Writing file: " << fileout << '\n';
-  dat.write_sparse_binary(fileout);
+  dat.write_sparse_binary(fileout, aligned);
 
   // Print
   int precision = 3;
@@ -984,17 +992,24 @@ int main(int argc, char *argv[]) {
   rtt_dsxx::XGetopt::csmap long_options;
   long_options['h'] = "help";
   long_options['v'] = "version";
+  long_options['a'] = "aligned";
   std::map<char, std::string> help_strings;
   help_strings['h'] = "print this message.";
   help_strings['v'] = "print version information and exit.";
+  help_strings['a'] = "write a version 1.1 (aligned, memory mappable) binary file.";
   rtt_dsxx::XGetopt program_options(argc, argv, long_options, help_strings);
 
-  std::string const helpstring("\nUsage: cskrw [-hv] "
+  std::string const helpstring("\nUsage: cskrw [-hva] "
                                "<csk_base_filename>\n¡Under active development!\n");
 
+  bool aligned(false);
   int c(0);
   while ((c = program_options()) != -1) {
     switch (c) {
+    case 'a': // --aligned
+      aligned = true;
+      break;
+
     case 'v': // --version
     {
       cout << argv[0] << ": version " << rtt_dsxx::release() << endl;
@@ -1021,7 +1036,7 @@ int main(int argc, char *argv[]) {
     //verbosity = 2;
     //verbosity = 3;
     //verbosity = 4;
-    read_csk_files(filename, verbosity);
+    read_csk_files(filename, verbosity, aligned);
   } catch (rtt_dsxx::assertion &excpt) {
     cout << "While attempting to read csk file, " << excpt.what() << endl;
     return 1;
@@ -0,0 +1,223 @@
+//--------------------------------------------*-C++-*---------------------------------------------//
+/*!
+ * \file   compton_tools/test/tCompton_Matvec.cc
+ * \author agent
+ * \date   16 Oct 2026
+ * \brief  Tests and micro-benchmark of the matrix-free Compton_Native matvec kernels
+ * \note   Copyright (C) 2026 Triad National Security, LLC., All rights reserved.
+ */
+//------------------------------------------------------------------------------------------------//
+
+#include "c4/ParallelUnitTest.hh"
+#include "compton_tools/Compton_Native.hh"
+#include "ds++/Release.hh"
+#include "ds++/Soft_Equivalence.hh"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+namespace rtt_compton_tools_test {
+
+using rtt_dsxx::soft_equiv;
+using vec_d = std::vector<double>;
+
+//------------------------------------------------------------------------------------------------//
+// HELPERS
+//------------------------------------------------------------------------------------------------//
+
+//! Reference product built from the dense matrix: y = diag(L) * inscat * diag(R) * x
+vec_d dense_matvec(const rtt_compton_tools::Compton_Native &compton, const vec_d &x,
+                   const vec_d &L, const vec_d &R, double Te_keV, size_t num_moments,
+                   size_t num_rhs, bool transpose) {
+  const size_t G = compton.get_num_groups();
+  vec_d inscat;
+  compton.interp_dense_inscat(inscat, Te_keV, num_moments);
+  vec_d y(x.size(), 0.0);
+  for (size_t r = 0; r < num_rhs; ++r) {
+    for (size_t k = 0; k < num_moments; ++k) {
+      const size_t offset = (r * num_moments + k) * G;
+      for (size_t gto = 0; gto < G; ++gto) {
+        for (size_t gfrom = 0; gfrom < G; ++gfrom) {
+          const double a = L[gto] * inscat[(k * G + gto) * G + gfrom] * R[gfrom];
+          if (transpose)
+            y[offset + gfrom] += x[offset + gto] * a;
+          else
+            y[offset + gto] += a * x[offset + gfrom];
+        }
+      }
+    }
+  }
+  return y;
+}
+
+//------------------------------------------------------------------------------------------------//
+//! Write a synthetic banded CSK library (linear inscattering only is meaningful) for benchmarking
+void write_banded_csk(const std::string &filename, uint64_t num_temps, uint64_t num_groups,
+                      uint64_t num_moments, uint64_t band) {
+  const uint64_t num_evals = 3;
+  const uint64_t num_points = num_evals + num_moments - 1U;
+  const uint64_t num_rows = num_temps * num_groups;
+  std::vector<uint64_t> first_groups(num_rows);
+  std::vector<uint64_t> indexes(num_rows + 1U, 0U);
+  for (uint64_t i = 0; i < num_rows; ++i) {
+    const uint64_t gfrom = i % num_groups;
+    first_groups[i] = std::min(gfrom > band / 2 ? gfrom - band / 2 : 0, num_groups - band);
+    indexes[i + 1U] = indexes[i] + band;
+  }
+  const uint64_t dsz = num_points * indexes.back();
+  vec_d data(dsz);
+  vec_d derivs(dsz);
+  for (uint64_t i = 0; i < dsz; ++i) {
+    data[i] = 1.0 + 1.0e-3 * static_cast<double>(i % 1009);
+    derivs[i] = 1.0e-2 * static_cast<double>(i % 17);
+  }
+  vec_d Ts(num_temps);
+  for (uint64_t i = 0; i < num_temps; ++i)
+    Ts[i] = 1.0 + static_cast<double>(i);
+  vec_d Egs(num_groups + 1U);
+  for (uint64_t g = 0; g <= num_groups; ++g)
+    Egs[g] = 1.0e-3 * static_cast<double>(g + 1U);
+
+  std::ofstream out(filename, std::ios::out | std::ios::binary);
+  const char magic[6] = {' ', 'c', 's', 'k', ' ', '\0'};
+  out.write(magic, sizeof(magic));
+  const std::vector<uint64_t> header = {1U,        0U,         0U,
+                                        num_temps, num_groups, num_moments,
+                                        num_evals, num_rows,   num_rows + 1U,
+                                        dsz};
+  out.write(reinterpret_cast<const char *>(header.data()),
+            static_cast<std::streamsize>(header.size() * sizeof(uint64_t)));
+  auto write_vec = [&out](const auto &v) {
+    out.write(reinterpret_cast<const char *>(v.data()),
+              static_cast<std::streamsize>(v.size() * sizeof(v[0])));
+  };
+  write_vec(Ts);
+  write_vec(Egs);
+  write_vec(first_groups);
+  write_vec(indexes);
+  write_vec(data);
+  write_vec(derivs);
+}
+
+//------------------------------------------------------------------------------------------------//
+// TESTS
+//------------------------------------------------------------------------------------------------//
+
+//! Compare the fused kernels with products of the dense interpolated matrices
+void test_matvec(rtt_dsxx::UnitTest &ut) {
+  const std::string filename = ut.getTestSourcePath() + "dummy_data_gold_b";
+  const rtt_compton_tools::Compton_Native compton(filename);
+  const size_t G = compton.get_num_groups();
+  const size_t L = compton.get_num_leg_moments();
+  const std::vector<double> &Ts = compton.get_Ts();
+
+  vec_d left(G);
+  vec_d right(G);
+  for (size_t g = 0; g < G; ++g) {
+    left[g] = 1.0 + 0.5 * static_cast<double>(g);
+    right[g] = 2.0 - 0.25 * static_cast<double>(g);
+  }
+  const vec_d ones(G, 1.0);
+
+  for (const double Te : {0.5 * Ts[0], 0.4 * Ts[0] + 0.6 * Ts[1], Ts[2], 3.0 * Ts.back()}) {
+    for (const size_t num_rhs : {size_t(1), size_t(3)}) {
+      for (const bool zeroth : {false, true}) {
+        const size_t M = zeroth ? 1U : L;
+        vec_d x(num_rhs * M * G);
+        for (size_t j = 0; j < x.size(); ++j)
+          x[j] = 0.5 + 0.1 * static_cast<double>((j * 7) % 11);
+
+        vec_d y = x;
+        compton.interp_matvec(y, left, right, Te, zeroth, num_rhs);
+        FAIL_IF_NOT(soft_equiv(y, dense_matvec(compton, x, left, right, Te, M, num_rhs, false)));
+
+        y = x;
+        compton.interp_matvec(y, vec_d(), vec_d(), Te, zeroth, num_rhs);
+        FAIL_IF_NOT(soft_equiv(y, dense_matvec(compton, x, ones, ones, Te, M, num_rhs, false)));
+
+        y = x;
+        compton.interp_matvec_transpose(y, left, right, Te, zeroth, num_rhs);
+        FAIL_IF_NOT(soft_equiv(y, dense_matvec(compton, x, left, right, Te, M, num_rhs, true)));
+      }
+    }
+  }
+
+  if (ut.numFails == 0)
+    PASSMSG("Fused interpolation and matvec kernels match the dense products.");
+}
+
+//------------------------------------------------------------------------------------------------//
+//! Report the memory bandwidth achieved by the fused kernel on a large, banded library
+void benchmark_matvec(rtt_dsxx::UnitTest &ut) {
+  const size_t T = 2;
+  const size_t G = 1024;
+  const size_t M = 4;
+  const size_t band = 128;
+  const std::string filename = "tCompton_Matvec_banded_b";
+  if (rtt_c4::node() == 0)
+    write_banded_csk(filename, T, G, M, band);
+  rtt_c4::global_barrier();
+  const rtt_compton_tools::Compton_Native compton(filename);
+  if (rtt_c4::node() == 0)
+    std::remove(filename.c_str());
+
+  const double Te = 1.375;
+  const size_t num_iters = 10;
+  // data_ and derivs_ bytes streamed per call: both temperatures, all moments, both arrays
+  const double bytes = 2.0 * static_cast<double>(G * band * M) * 2.0 * sizeof(double);
+
+  std::cout << "\nInscattering matvec, " << G << " groups, " << M << " moments, band " << band
+            << " (" << bytes / 1.0e6 << " MB of data_/derivs_ per matvec):\n";
+  for (const size_t num_rhs : {size_t(1), size_t(4)}) {
+    vec_d x(num_rhs * M * G, 1.0);
+    auto const t0 = std::chrono::steady_clock::now();
+    for (size_t it = 0; it < num_iters; ++it)
+      compton.interp_matvec(x, vec_d(), vec_d(), Te, false, num_rhs);
+    auto const t1 = std::chrono::steady_clock::now();
+
+    // interpolate the dense matrix then multiply
+    vec_d z(num_rhs * M * G, 1.0);
+    vec_d inscat;
+    for (size_t it = 0; it < num_iters; ++it) {
+      compton.interp_dense_inscat(inscat, Te, M);
+      vec_d w(z.size(), 0.0);
+      for (size_t r = 0; r < num_rhs; ++r)
+        for (size_t k = 0; k < M; ++k)
+          for (size_t gto = 0; gto < G; ++gto)
+            for (size_t gfrom = 0; gfrom < G; ++gfrom)
+              w[(r * M + k) * G + gto] +=
+                  inscat[(k * G + gto) * G + gfrom] * z[(r * M + k) * G + gfrom];
+      z.swap(w);
+    }
+    auto const t2 = std::chrono::steady_clock::now();
+
+    const double fused = std::chrono::duration<double>(t1 - t0).count() / num_iters;
+    const double dense = std::chrono::duration<double>(t2 - t1).count() / num_iters;
+    std::cout << "  " << num_rhs << " rhs: fused " << fused << " s/matvec ("
+              << bytes / fused / 1.0e9 << " GB/s), dense interpolation + matvec " << dense
+              << " s/matvec\n";
+    FAIL_IF_NOT(soft_equiv(x, z, 1.0e-10));
+  }
+  std::cout << std::endl;
+
+  if (ut.numFails == 0)
+    PASSMSG("Fused matvec benchmark completed.");
+}
+
+} // namespace rtt_compton_tools_test
+
+//------------------------------------------------------------------------------------------------//
+int main(int argc, char *argv[]) {
+  rtt_c4::ParallelUnitTest ut(argc, argv, rtt_dsxx::release);
+  try {
+    // >>> UNIT TESTS
+    rtt_compton_tools_test::test_matvec(ut);
+    rtt_compton_tools_test::benchmark_matvec(ut);
+  }
+  UT_EPILOG(ut);
+}
+
+//------------------------------------------------------------------------------------------------//
+// End of test/tCompton_Matvec.cc
+//------------------------------------------------------------------------------------------------//
@@ -13,6 +13,7 @@
 #include "ds++/Release.hh"
 #include "ds++/Soft_Equivalence.hh"
 #include "units/PhysicalConstants.hh"
+#include <cmath>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -286,6 +287,172 @@ void test(rtt_dsxx::UnitTest &ut) {
   }
 }
 
+//------------------------------------------------------------------------------------------------//
+//!  Tests the multi-cell interpolation routines against the single temperature routines.
+void batched_interp_test(rtt_dsxx::UnitTest &ut) {
+  std::cout << "\n---------------------------------------------------------\n"
+            << "    Test Compton_Native batched interpolation    \n"
+            << "---------------------------------------------------------\n";
+  const std::string filename = ut.getTestSourcePath() + "dummy_data_gold_b";
+  const rtt_compton_tools::Compton_Native compton_test(filename);
+  const size_t G = compton_test.get_num_groups();
+  const size_t L = compton_test.get_num_leg_moments();
+  const std::vector<double> &Ts = compton_test.get_Ts();
+
+  // Cells in every temperature bracket (and outside the grid), in no particular order
+  const size_t num_cells = 37;
+  const double logTmin = std::log(0.5 * Ts.front());
+  const double logTmax = std::log(2.0 * Ts.back());
+  std::vector<double> Te_keV(num_cells);
+  std::vector<double> phi(num_cells * G);
+  std::vector<double> scale(num_cells);
+  for (size_t c = 0; c < num_cells; ++c) {
+    const double frac = static_cast<double>((c * 17) % num_cells) / double(num_cells - 1);
+    Te_keV[c] = std::exp(logTmin + frac * (logTmax - logTmin));
+    scale[c] = 0.0;
+    for (size_t g = 0; g < G; ++g) {
+      phi[c * G + g] = 1.0 + 0.25 * static_cast<double>((c + 3 * g) % 5);
+      scale[c] += phi[c * G + g];
+    }
+  }
+  Te_keV[5] = Ts[1];
+  scale[7] = 0.0;
+
+  std::vector<double> inscat(num_cells * L * G * G, -1.0);
+  std::vector<double> outscat(num_cells * G, -1.0);
+  compton_test.interp_dense_inscat(num_cells, Te_keV.data(), L, inscat.data());
+  compton_test.interp_linear_outscat(num_cells, Te_keV.data(), outscat.data());
+  std::vector<double> net = outscat;
+  compton_test.interp_nonlin_diff_and_add(num_cells, Te_keV.data(), phi.data(), scale.data(),
+                                          net.data());
+
+  std::vector<double> inscat_ref;
+  std::vector<double> outscat_ref;
+  bool inscat_ok = true;
+  bool outscat_ok = true;
+  bool net_ok = true;
+  for (size_t c = 0; c < num_cells; ++c) {
+    compton_test.interp_dense_inscat(inscat_ref, Te_keV[c], L);
+    compton_test.interp_linear_outscat(outscat_ref, Te_keV[c]);
+    inscat_ok = inscat_ok && soft_equiv(inscat_ref.begin(), inscat_ref.end(),
+                                        inscat.begin() + c * L * G * G,
+                                        inscat.begin() + (c + 1) * L * G * G, 1e-12);
+    outscat_ok = outscat_ok && soft_equiv(outscat_ref.begin(), outscat_ref.end(),
+                                          outscat.begin() + c * G, outscat.begin() + (c + 1) * G,
+                                          1e-12);
+    const std::vector<double> cell_phi(phi.begin() + c * G, phi.begin() + (c + 1) * G);
+    compton_test.interp_nonlin_diff_and_add(outscat_ref, Te_keV[c], cell_phi, scale[c]);
+    net_ok = net_ok && soft_equiv(outscat_ref.begin(), outscat_ref.end(), net.begin() + c * G,
+                                  net.begin() + (c + 1) * G, 1e-12);
+  }
+  ut.check(inscat_ok, "checked batched inscat");
+  ut.check(outscat_ok, "checked batched outscat");
+  ut.check(net_ok, "checked batched nl_diff");
+}
+
+//------------------------------------------------------------------------------------------------//
+//!  Tests the sparse inscattering matrices against the dense inscattering matrices.
+void sparse_inscat_test(rtt_dsxx::UnitTest &ut) {
+  std::cout << "\n---------------------------------------------------------\n"
+            << "    Test Compton_Native sparse inscattering    \n"
+            << "---------------------------------------------------------\n";
+  const std::string filename = ut.getTestSourcePath() + "dummy_data_gold_b";
+  const rtt_compton_tools::Compton_Native compton_test(filename);
+  const size_t G = compton_test.get_num_groups();
+  const size_t L = compton_test.get_num_leg_moments();
+  const std::vector<double> &Ts = compton_test.get_Ts();
+
+  // Points on, between and outside the temperature grid
+  const std::vector<double> Te_keV = {0.5 * Ts.front(), Ts.front(), 0.3 * Ts[0] + 0.7 * Ts[1],
+                                      Ts[2], 0.5 * (Ts[2] + Ts[3]), 2.0 * Ts.back()};
+  const size_t P = Te_keV.size();
+
+  rtt_compton_tools::Sparse_Compton_Matrix inscat(1, 1, 1, 0);
+  compton_test.interp_sparse_inscat(inscat, Te_keV);
+  ut.check(inscat.get_num_points() == P, "checked number of sparse points");
+  ut.check(inscat.get_num_groups() == G, "checked number of sparse groups");
+  ut.check(inscat.get_num_leg_moments() == L, "checked number of sparse moments");
+  ut.check(inscat.get_num_entries() <= P * G * G, "checked sparse storage");
+
+  // Apply to a vector and compare with the dense matrices
+  std::vector<double> x(L * P * G);
+  for (size_t j = 0; j < x.size(); ++j)
+    x[j] = 1.0 + 0.1 * static_cast<double>(j % 7);
+  std::vector<double> gold(L * P * G, 0.0);
+  std::vector<double> dense;
+  for (size_t p = 0; p < P; ++p) {
+    compton_test.interp_dense_inscat(dense, Te_keV[p], L);
+    for (size_t k = 0; k < L; ++k)
+      for (size_t gto = 0; gto < G; ++gto)
+        for (size_t gfrom = 0; gfrom < G; ++gfrom)
+          gold[(k * P + p) * G + gto] +=
+              dense[(k * G + gto) * G + gfrom] * x[(k * P + p) * G + gfrom];
+  }
+  std::vector<double> y;
+  inscat.matvec(x, y);
+  ut.check(soft_equiv(y, gold, 1e-12), "checked sparse inscattering matvec");
+
+  // Zeroth moment only
+  rtt_compton_tools::Sparse_Compton_Matrix inscat0(1, 1, 1, 0);
+  compton_test.interp_sparse_inscat(inscat0, Te_keV, true);
+  ut.check(inscat0.get_num_leg_moments() == 1U, "checked zeroth-moment sparse moments");
+  std::vector<double> x0(x.begin(), x.begin() + P * G);
+  inscat0.matvec(x0);
+  ut.check(soft_equiv(x0.begin(), x0.end(), gold.begin(), gold.begin() + P * G, 1e-12),
+           "checked zeroth-moment sparse inscattering matvec");
+  inscat.matvec(x, y, false);
+  std::vector<double> x1(x.begin(), x.begin() + P * G);
+  inscat.matvec(x1, true);
+  ut.check(soft_equiv(x1, x0, 1e-12), "checked zeroth-moment matvec of full matrix");
+}
+
+//------------------------------------------------------------------------------------------------//
+//!  Tests the memory-mapped construction against the read-and-broadcast construction.
+void memory_map_test(rtt_dsxx::UnitTest &ut) {
+  std::cout << "\n---------------------------------------------------------\n"
+            << "    Test Compton_Native memory-mapped construction    \n"
+            << "---------------------------------------------------------\n";
+  const std::string filename = ut.getTestSourcePath() + "dummy_data_gold_b";
+
+  // the same data written by "cskrw --aligned" (version 1.1, arrays 8-byte aligned)
+  const std::string aligned_filename = ut.getTestSourcePath() + "dummy_data_gold_aligned_b";
+
+  const rtt_compton_tools::Compton_Native heap(filename);
+  const rtt_compton_tools::Compton_Native copied(filename, true);
+  auto aligned = std::make_unique<rtt_compton_tools::Compton_Native>(aligned_filename, true);
+  const rtt_compton_tools::Compton_Native aligned_heap(aligned_filename);
+  ut.check(!heap.is_zero_copy(), "checked heap storage");
+  ut.check(!copied.is_zero_copy(), "checked version 1.0 files are copied from the mapping");
+  ut.check(!aligned_heap.is_zero_copy(), "checked heap storage of a version 1.1 file");
+#ifdef UNIX
+  ut.check(aligned->is_zero_copy(), "checked version 1.1 files are used in place");
+#endif
+
+  // copies share the mapping, which outlives the original object
+  const rtt_compton_tools::Compton_Native shared(*aligned);
+  aligned.reset();
+
+  const size_t G = heap.get_num_groups();
+  const std::vector<double> &Ts = heap.get_Ts();
+  const std::vector<double> phi(G, 1.5);
+  bool same = true;
+  for (const double Te : {Ts[0], 0.3 * Ts[1] + 0.7 * Ts[2], 2.0 * Ts.back()}) {
+    std::vector<double> ref_in, ref_out;
+    heap.interp_dense_inscat(ref_in, Te, G);
+    heap.interp_linear_outscat(ref_out, Te);
+    heap.interp_nonlin_diff_and_add(ref_out, Te, phi, 6.0);
+    for (const rtt_compton_tools::Compton_Native *other : {&copied, &shared, &aligned_heap}) {
+      std::vector<double> in, out;
+      other->interp_dense_inscat(in, Te, G);
+      other->interp_linear_outscat(out, Te);
+      other->interp_nonlin_diff_and_add(out, Te, phi, 6.0);
+      same = same && in == ref_in && out == ref_out && other->get_Egs() == heap.get_Egs() &&
+             other->get_Ts() == Ts;
+    }
+  }
+  ut.check(same, "checked memory-mapped data matches the broadcast data");
+}
+
 //------------------------------------------------------------------------------------------------//
 //!  Tests Compton's error-handling on a non-existent file.
 void bad_file_test(rtt_dsxx::UnitTest &ut) {
@@ -312,6 +479,16 @@ void bad_file_test(rtt_dsxx::UnitTest &ut) {
     caught = true;
   }
 
+  if (!caught)
+    ITFAILS;
+
+  // and again with a memory mapping
+  caught = false;
+  try {
+    compton_test = std::make_unique<rtt_compton_tools::Compton_Native>(filename, true);
+  } catch (...) {
+    caught = true;
+  }
   if (!caught)
     ITFAILS;
 
@@ -329,6 +506,9 @@ int main(int argc, char *argv[]) {
   try {
     // >>> UNIT TESTS
     rtt_compton_tools_test::test(ut);
+    rtt_compton_tools_test::batched_interp_test(ut);
+    rtt_compton_tools_test::sparse_inscat_test(ut);
+    rtt_compton_tools_test::memory_map_test(ut);
     rtt_compton_tools_test::bad_file_test(ut);
   }
   UT_EPILOG(ut);
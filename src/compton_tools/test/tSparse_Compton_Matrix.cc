@@ -0,0 +1,119 @@
+//--------------------------------------------*-C++-*---------------------------------------------//
+/*!
+ * \file   compton_tools/test/tSparse_Compton_Matrix.cc
+ * \author agent
+ * \date   16 Oct 2026
+ * \brief  Implementation file for tSparse_Compton_Matrix
+ * \note   Copyright (C) 2026 Triad National Security, LLC., All rights reserved.
+ */
+//------------------------------------------------------------------------------------------------//
+
+#include "c4/ParallelUnitTest.hh"
+#include "compton_tools/Sparse_Compton_Matrix.hh"
+#include "ds++/Release.hh"
+#include "ds++/Soft_Equivalence.hh"
+#include <iostream>
+
+namespace rtt_compton_tools_test {
+
+using rtt_dsxx::soft_equiv;
+
+//------------------------------------------------------------------------------------------------//
+// TESTS
+//------------------------------------------------------------------------------------------------//
+
+//!  Fill a small banded matrix by hand and compare its products with dense products
+void test_matvec(rtt_dsxx::UnitTest &ut) {
+  std::cout << "\n---------------------------------------------------------\n"
+            << "             Test Draco Sparse_Compton_Matrix matvec\n"
+            << "---------------------------------------------------------\n";
+
+  const size_t P = 2; // points
+  const size_t G = 3; // groups
+  const size_t M = 2; // Legendre moments
+
+  // Band of each (point, group-from) row: [first group-to, number of entries]
+  const std::vector<size_t> first = {0, 0, 1, 1, 0, 2};
+  const std::vector<size_t> length = {2, 3, 2, 1, 3, 1};
+  std::vector<size_t> indexes(P * G + 1U, 0U);
+  for (size_t i = 0; i < P * G; ++i)
+    indexes[i + 1U] = indexes[i] + length[i];
+  const size_t num_entries = indexes.back();
+
+  rtt_compton_tools::Sparse_Compton_Matrix matrix(P, G, M, num_entries);
+  matrix.ref_first_groups() = first;
+  matrix.ref_indexes() = indexes;
+  ut.check(matrix.get_num_points() == P, "checked number of points");
+  ut.check(matrix.get_num_groups() == G, "checked number of groups");
+  ut.check(matrix.get_num_leg_moments() == M, "checked number of Legendre moments");
+  ut.check(matrix.get_highest_leg_moment() == M - 1U, "checked highest Legendre moment");
+  ut.check(matrix.get_num_entries() == num_entries, "checked number of entries");
+  ut.check(matrix.check_class_invariants(), "checked class invariants");
+
+  // Fill the sparse data and the equivalent dense matrices [moment, point, group-to, group-from]
+  std::vector<double> &data = matrix.ref_data();
+  std::vector<double> dense(M * P * G * G, 0.0);
+  for (size_t k = 0; k < M; ++k) {
+    for (size_t p = 0; p < P; ++p) {
+      for (size_t gfrom = 0; gfrom < G; ++gfrom) {
+        const size_t i = gfrom + G * p;
+        for (size_t dg = 0; dg < length[i]; ++dg) {
+          const size_t gto = first[i] + dg;
+          const double val = 1.0 + static_cast<double>(k * 100 + p * 10 + gfrom) +
+                             0.125 * static_cast<double>(gto);
+          data[k * num_entries + indexes[i] + dg] = val;
+          dense[((k * P + p) * G + gto) * G + gfrom] = val;
+        }
+      }
+    }
+  }
+
+  // Dense reference products
+  std::vector<double> x(M * P * G);
+  for (size_t j = 0; j < x.size(); ++j)
+    x[j] = 0.5 + 0.25 * static_cast<double>(j);
+  std::vector<double> gold(M * P * G, 0.0);
+  for (size_t k = 0; k < M; ++k)
+    for (size_t p = 0; p < P; ++p)
+      for (size_t gto = 0; gto < G; ++gto)
+        for (size_t gfrom = 0; gfrom < G; ++gfrom)
+          gold[(k * P + p) * G + gto] +=
+              dense[((k * P + p) * G + gto) * G + gfrom] * x[(k * P + p) * G + gfrom];
+
+  // Out-of-place and in-place products over all moments
+  std::vector<double> y;
+  matrix.matvec(x, y);
+  ut.check(soft_equiv(y, gold), "checked out-of-place matvec");
+  std::vector<double> x_inplace = x;
+  matrix.matvec(x_inplace);
+  ut.check(soft_equiv(x_inplace, gold), "checked in-place matvec");
+
+  // Zeroth moment only
+  std::vector<double> x0(x.begin(), x.begin() + P * G);
+  const std::vector<double> gold0(gold.begin(), gold.begin() + P * G);
+  matrix.matvec(x0, y, true);
+  ut.check(soft_equiv(y, gold0), "checked zeroth-moment out-of-place matvec");
+  matrix.matvec(x0, true);
+  ut.check(soft_equiv(x0, gold0), "checked zeroth-moment in-place matvec");
+
+  // Growing the data keeps the stored entries
+  matrix.resize_data(num_entries + 4U);
+  matrix.matvec(x, y);
+  ut.check(soft_equiv(y, gold), "checked matvec after resize_data");
+}
+
+} // namespace rtt_compton_tools_test
+
+//------------------------------------------------------------------------------------------------//
+int main(int argc, char *argv[]) {
+  rtt_c4::ParallelUnitTest ut(argc, argv, rtt_dsxx::release);
+  try {
+    // >>> UNIT TESTS
+    rtt_compton_tools_test::test_matvec(ut);
+  }
+  UT_EPILOG(ut);
+}
+
+//------------------------------------------------------------------------------------------------//
+// End of test/tSparse_Compton_Matrix.cc
+//------------------------------------------------------------------------------------------------//
@@ -18,7 +18,9 @@
 //------------------------------------------------------------------------------------------------//
 
 #include "kde.hh"
+#include "c4/c4_omp.h"
 #include <cmath>
+#include <exception>
 #include <fstream>
 #include <iostream>
 #include <numeric>
@@ -136,27 +138,29 @@ kde::reconstruction(const std::vector<double> &distribution,
                                                                 {0.0, 0.0, 0.0});
     qindex.collect_ghost_data(one_over_bandwidth, ghost_one_over_bandwidth);
 
-    std::array<double, 3> win_min{0.0, 0.0, 0.0};
-    std::array<double, 3> win_max{0.0, 0.0, 0.0};
     // now apply the kernel to the local ranks
+    std::exception_ptr loop_error;
+#ifdef OPENMP_FOUND
+#pragma omp parallel for num_threads(n_threads) schedule(dynamic, 64)
+#endif
     for (size_t i = 0; i < local_size; i++) {
-      // skip masked data
-      if (reconstruction_mask[i] == 0) {
-        result[i] = distribution[i];
-        normal[i] = 1.0;
-        continue;
-      }
-      const std::array<double, 3> r0 = qindex.locations[i];
-      const std::array<double, 3> one_over_h0 = one_over_bandwidth[i];
-      calc_win_min_max(qindex, r0, one_over_h0, win_min, win_max);
-      const std::vector<size_t> coarse_bins = qindex.window_coarse_index_list(win_min, win_max);
-      // fetch local contribution
-      for (auto &cb : coarse_bins) {
-        // skip bins that aren't present in the map (for constness)
-        auto mapItr = qindex.coarse_index_map.find(cb);
-        if (mapItr != qindex.coarse_index_map.end()) {
+      try {
+        // skip masked data
+        if (reconstruction_mask[i] == 0) {
+          result[i] = distribution[i];
+          normal[i] = 1.0;
+          continue;
+        }
+        const std::array<double, 3> r0 = qindex.locations[i];
+        const std::array<double, 3> one_over_h0 = one_over_bandwidth[i];
+        std::array<double, 3> win_min{0.0, 0.0, 0.0};
+        std::array<double, 3> win_max{0.0, 0.0, 0.0};
+        calc_win_min_max(qindex, r0, one_over_h0, win_min, win_max);
+        const std::vector<size_t> coarse_bins = qindex.window_coarse_index_list(win_min, win_max);
+        // fetch local contribution
+        for (auto &cb : coarse_bins) {
           // loop over local data
-          for (auto &l : mapItr->second) {
+          for (auto &l : qindex.coarse_bin(cb)) {
             if (reconstruction_mask[i] != reconstruction_mask[l])
               continue;
             const double weight = calc_weight(r0, one_over_h0, qindex.locations[l],
@@ -164,11 +168,8 @@ kde::reconstruction(const std::vector<double> &distribution,
             result[i] += distribution[l] * weight;
             normal[i] += weight;
           }
-        }
-        auto gmapItr = qindex.local_ghost_index_map.find(cb);
-        if (gmapItr != qindex.local_ghost_index_map.end()) {
           // loop over ghost data
-          for (auto &g : gmapItr->second) {
+          for (auto &g : qindex.ghost_bin(cb)) {
             if (reconstruction_mask[i] != ghost_mask[g])
               continue;
             const double weight =
@@ -178,30 +179,40 @@ kde::reconstruction(const std::vector<double> &distribution,
             normal[i] += weight;
           }
         }
+      } catch (...) {
+#ifdef OPENMP_FOUND
+#pragma omp critical(kde_loop_error)
+#endif
+        if (!loop_error)
+          loop_error = std::current_exception();
       }
     }
+    if (loop_error)
+      std::rethrow_exception(loop_error);
   } else { // local reconstruction only
 
-    std::array<double, 3> win_min{0.0, 0.0, 0.0};
-    std::array<double, 3> win_max{0.0, 0.0, 0.0};
     // now apply the kernel to the local ranks
+    std::exception_ptr loop_error;
+#ifdef OPENMP_FOUND
+#pragma omp parallel for num_threads(n_threads) schedule(dynamic, 64)
+#endif
     for (size_t i = 0; i < local_size; i++) {
-      // skip masked data
-      if (reconstruction_mask[i] == 0) {
-        result[i] = distribution[i];
-        normal[i] = 1.0;
-        continue;
-      }
-      const std::array<double, 3> r0 = qindex.locations[i];
-      const std::array<double, 3> one_over_h0 = one_over_bandwidth[i];
-      calc_win_min_max(qindex, r0, one_over_h0, win_min, win_max);
-      const std::vector<size_t> coarse_bins = qindex.window_coarse_index_list(win_min, win_max);
-      for (auto &cb : coarse_bins) {
-        // skip bins that aren't present in the map (can't use [] operator with constness)
-        auto mapItr = qindex.coarse_index_map.find(cb);
-        if (mapItr != qindex.coarse_index_map.end()) {
+      try {
+        // skip masked data
+        if (reconstruction_mask[i] == 0) {
+          result[i] = distribution[i];
+          normal[i] = 1.0;
+          continue;
+        }
+        const std::array<double, 3> r0 = qindex.locations[i];
+        const std::array<double, 3> one_over_h0 = one_over_bandwidth[i];
+        std::array<double, 3> win_min{0.0, 0.0, 0.0};
+        std::array<double, 3> win_max{0.0, 0.0, 0.0};
+        calc_win_min_max(qindex, r0, one_over_h0, win_min, win_max);
+        const std::vector<size_t> coarse_bins = qindex.window_coarse_index_list(win_min, win_max);
+        for (auto &cb : coarse_bins) {
           // loop over local data
-          for (auto &l : mapItr->second) {
+          for (auto &l : qindex.coarse_bin(cb)) {
             if (reconstruction_mask[i] != reconstruction_mask[l])
               continue;
             const double weight = calc_weight(r0, one_over_h0, qindex.locations[l],
@@ -210,8 +221,16 @@ kde::reconstruction(const std::vector<double> &distribution,
             normal[i] += weight;
           }
         }
+      } catch (...) {
+#ifdef OPENMP_FOUND
+#pragma omp critical(kde_loop_error)
+#endif
+        if (!loop_error)
+          loop_error = std::current_exception();
       }
     }
+    if (loop_error)
+      std::rethrow_exception(loop_error);
   }
 
   // normalize the integrated weight contributions
@@ -260,6 +279,11 @@ kde::weighted_reconstruction(const std::vector<double> &distribution,
   Require(qindex.locations.size() == local_size);
   Require(one_over_bandwidth.size() == local_size);
 
+  // check the weights up front (an exception can not escape the threaded point loop)
+  for (size_t i = 0; i < local_size; i++)
+    Insist(reconstruction_mask[i] == 0 || bandwidth_weights[i] > 0.0,
+           "Bandwidths must be postive (>0.0)");
+
   // used for the zero accumulation conservation
   std::vector<double> result(local_size, 0.0);
   std::vector<double> normal(local_size, 0.0);
@@ -274,32 +298,35 @@ kde::weighted_reconstruction(const std::vector<double> &distribution,
     std::vector<std::array<double, 3>> ghost_one_over_bandwidth(qindex.local_ghost_buffer_size,
                                                                 {0.0, 0.0, 0.0});
     qindex.collect_ghost_data(one_over_bandwidth, ghost_one_over_bandwidth);
+    for (size_t g = 0; g < qindex.local_ghost_buffer_size; g++)
+      Insist(ghost_mask[g] == 0 || ghost_bandwidth_weights[g] > 0.0,
+             "Bandwidths must be postive (>0.0)");
 
-    std::array<double, 3> win_min{0.0, 0.0, 0.0};
-    std::array<double, 3> win_max{0.0, 0.0, 0.0};
     // now apply the kernel to the local ranks
+    std::exception_ptr loop_error;
+#ifdef OPENMP_FOUND
+#pragma omp parallel for num_threads(n_threads) schedule(dynamic, 64)
+#endif
     for (size_t i = 0; i < local_size; i++) {
-      // skip masked data
-      if (reconstruction_mask[i] == 0) {
-        result[i] = distribution[i];
-        normal[i] = 1.0;
-        continue;
-      }
-      Insist(bandwidth_weights[i] > 0.0, "Bandwidths must be postive (>0.0)");
-      const std::array<double, 3> r0 = qindex.locations[i];
-      const std::array<double, 3> one_over_h0 = one_over_bandwidth[i];
-      calc_win_min_max(qindex, r0, one_over_h0, win_min, win_max);
-      const std::vector<size_t> coarse_bins = qindex.window_coarse_index_list(win_min, win_max);
-      // fetch local contribution
-      for (auto &cb : coarse_bins) {
-        // skip bins that aren't present in the map (for constness)
-        auto mapItr = qindex.coarse_index_map.find(cb);
-        if (mapItr != qindex.coarse_index_map.end()) {
+      try {
+        // skip masked data
+        if (reconstruction_mask[i] == 0) {
+          result[i] = distribution[i];
+          normal[i] = 1.0;
+          continue;
+        }
+        const std::array<double, 3> r0 = qindex.locations[i];
+        const std::array<double, 3> one_over_h0 = one_over_bandwidth[i];
+        std::array<double, 3> win_min{0.0, 0.0, 0.0};
+        std::array<double, 3> win_max{0.0, 0.0, 0.0};
+        calc_win_min_max(qindex, r0, one_over_h0, win_min, win_max);
+        const std::vector<size_t> coarse_bins = qindex.window_coarse_index_list(win_min, win_max);
+        // fetch local contribution
+        for (auto &cb : coarse_bins) {
           // loop over local data
-          for (auto &l : mapItr->second) {
+          for (auto &l : qindex.coarse_bin(cb)) {
             if (reconstruction_mask[i] != reconstruction_mask[l])
               continue;
-            Insist(bandwidth_weights[l] > 0.0, "Bandwidths must be postive (>0.0)");
             const double scale = std::max(bandwidth_weights[i], bandwidth_weights[l]) /
                                  std::min(bandwidth_weights[i], bandwidth_weights[l]);
             const double weight =
@@ -308,14 +335,10 @@ kde::weighted_reconstruction(const std::vector<double> &distribution,
             result[i] += distribution[l] * weight;
             normal[i] += weight;
           }
-        }
-        auto gmapItr = qindex.local_ghost_index_map.find(cb);
-        if (gmapItr != qindex.local_ghost_index_map.end()) {
           // loop over ghost data
-          for (auto &g : gmapItr->second) {
+          for (auto &g : qindex.ghost_bin(cb)) {
             if (reconstruction_mask[i] != ghost_mask[g])
               continue;
-            Insist(ghost_bandwidth_weights[g] > 0.0, "Bandwidths must be postive (>0.0)");
             const double scale = std::max(bandwidth_weights[i], ghost_bandwidth_weights[g]) /
                                  std::min(bandwidth_weights[i], ghost_bandwidth_weights[g]);
             const double weight =
@@ -325,34 +348,42 @@ kde::weighted_reconstruction(const std::vector<double> &distribution,
             normal[i] += weight;
           }
         }
+      } catch (...) {
+#ifdef OPENMP_FOUND
+#pragma omp critical(kde_loop_error)
+#endif
+        if (!loop_error)
+          loop_error = std::current_exception();
       }
     }
+    if (loop_error)
+      std::rethrow_exception(loop_error);
   } else { // local reconstruction only
 
-    std::array<double, 3> win_min{0.0, 0.0, 0.0};
-    std::array<double, 3> win_max{0.0, 0.0, 0.0};
     // now apply the kernel to the local ranks
+    std::exception_ptr loop_error;
+#ifdef OPENMP_FOUND
+#pragma omp parallel for num_threads(n_threads) schedule(dynamic, 64)
+#endif
     for (size_t i = 0; i < local_size; i++) {
-      // skip masked data
-      if (reconstruction_mask[i] == 0) {
-        result[i] = distribution[i];
-        normal[i] = 1.0;
-        continue;
-      }
-      Insist(bandwidth_weights[i] > 0.0, "Bandwidths must be postive (>0.0)");
-      const std::array<double, 3> r0 = qindex.locations[i];
-      const std::array<double, 3> one_over_h0 = one_over_bandwidth[i];
-      calc_win_min_max(qindex, r0, one_over_h0, win_min, win_max);
-      const std::vector<size_t> coarse_bins = qindex.window_coarse_index_list(win_min, win_max);
-      for (auto &cb : coarse_bins) {
-        // skip bins that aren't present in the map (can't use [] operator with constness)
-        auto mapItr = qindex.coarse_index_map.find(cb);
-        if (mapItr != qindex.coarse_index_map.end()) {
+      try {
+        // skip masked data
+        if (reconstruction_mask[i] == 0) {
+          result[i] = distribution[i];
+          normal[i] = 1.0;
+          continue;
+        }
+        const std::array<double, 3> r0 = qindex.locations[i];
+        const std::array<double, 3> one_over_h0 = one_over_bandwidth[i];
+        std::array<double, 3> win_min{0.0, 0.0, 0.0};
+        std::array<double, 3> win_max{0.0, 0.0, 0.0};
+        calc_win_min_max(qindex, r0, one_over_h0, win_min, win_max);
+        const std::vector<size_t> coarse_bins = qindex.window_coarse_index_list(win_min, win_max);
+        for (auto &cb : coarse_bins) {
           // loop over local data
-          for (auto &l : mapItr->second) {
+          for (auto &l : qindex.coarse_bin(cb)) {
             if (reconstruction_mask[i] != reconstruction_mask[l])
               continue;
-            Insist(bandwidth_weights[i] > 0.0, "Bandwidths must be postive (>0.0)");
             const double scale = std::max(bandwidth_weights[i], bandwidth_weights[l]) /
                                  std::min(bandwidth_weights[i], bandwidth_weights[l]);
             const double weight =
@@ -362,8 +393,16 @@ kde::weighted_reconstruction(const std::vector<double> &distribution,
             normal[i] += weight;
           }
         }
+      } catch (...) {
+#ifdef OPENMP_FOUND
+#pragma omp critical(kde_loop_error)
+#endif
+        if (!loop_error)
+          loop_error = std::current_exception();
       }
     }
+    if (loop_error)
+      std::rethrow_exception(loop_error);
   }
 
   // normalize the integrated weight contributions
@@ -375,6 +414,193 @@ kde::weighted_reconstruction(const std::vector<double> &distribution,
   return result;
 }
 
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief KDE reconstruction of several fields in one neighbor pass
+ *
+ * \pre All fields share the reconstruction mask, bandwidths and quick_index. The window and the
+ * neighbor kernel weights are evaluated once per point and applied to every field, and the
+ * ghost data for all fields is collected in a single exchange. Each field is accumulated in the
+ * same order as the single field reconstruction, so result[f] is identical to
+ * reconstruction(distributions[f], ...).
+ *
+ * \param[in] distributions original data to be reconstructed [n_fields][local_size]
+ * \param[in] reconstruction_mask designate points that should be reconstructed together
+ * \param[in] one_over_bandwidth inverse bandwidth size to be used at each data location
+ * \param[in] qindex quick_index class to be used for data access.
+ * \param[in] discontinuity_cutoff maximum size of value discrepancies to include in the
+ *              reconstruction
+ * \return final local KDE function distribution reconstruction of each field
+ */
+std::vector<std::vector<double>>
+kde::reconstruction(const std::vector<std::vector<double>> &distributions,
+                    const std::vector<int> &reconstruction_mask,
+                    const std::vector<std::array<double, 3>> &one_over_bandwidth,
+                    const quick_index &qindex, const double discontinuity_cutoff) const {
+  return batch_reconstruction(distributions, std::vector<double>(), reconstruction_mask,
+                              one_over_bandwidth, qindex, discontinuity_cutoff);
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief KDE weighted reconstruction of several fields in one neighbor pass
+ *
+ * \pre Multi-field version of weighted_reconstruction, see reconstruction(distributions, ...).
+ *
+ * \param[in] distributions original data to be reconstructed [n_fields][local_size]
+ * \param[in] bandwidth_weights used to bias the bandwidths (must be positive)
+ * \param[in] reconstruction_mask designate points that should be reconstructed together
+ * \param[in] one_over_bandwidth inverse bandwidth size to be used at each data location
+ * \param[in] qindex quick_index class to be used for data access.
+ * \param[in] discontinuity_cutoff maximum size of value discrepancies to include in the
+ *              reconstruction
+ * \return final local KDE function distribution reconstruction of each field
+ */
+std::vector<std::vector<double>>
+kde::weighted_reconstruction(const std::vector<std::vector<double>> &distributions,
+                             const std::vector<double> &bandwidth_weights,
+                             const std::vector<int> &reconstruction_mask,
+                             const std::vector<std::array<double, 3>> &one_over_bandwidth,
+                             const quick_index &qindex, const double discontinuity_cutoff) const {
+  Insist(bandwidth_weights.size() == qindex.n_locations,
+         "bandwidth_weights must be sized to match the quick_index locations");
+  return batch_reconstruction(distributions, bandwidth_weights, reconstruction_mask,
+                              one_over_bandwidth, qindex, discontinuity_cutoff);
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Shared multi-field reconstruction kernel
+ *
+ * \param[in] distributions original data to be reconstructed [n_fields][local_size]
+ * \param[in] bandwidth_weights used to bias the bandwidths (empty for the unweighted kernel)
+ * \param[in] reconstruction_mask designate points that should be reconstructed together
+ * \param[in] one_over_bandwidth inverse bandwidth size to be used at each data location
+ * \param[in] qindex quick_index class to be used for data access.
+ * \param[in] discontinuity_cutoff maximum size of value discrepancies to include in the
+ *              reconstruction
+ * \return final local KDE function distribution reconstruction of each field
+ */
+std::vector<std::vector<double>>
+kde::batch_reconstruction(const std::vector<std::vector<double>> &distributions,
+                          const std::vector<double> &bandwidth_weights,
+                          const std::vector<int> &reconstruction_mask,
+                          const std::vector<std::array<double, 3>> &one_over_bandwidth,
+                          const quick_index &qindex, const double discontinuity_cutoff) const {
+  Require(qindex.dim < 3 && qindex.dim > 0);
+  const size_t n_fields = distributions.size();
+  const size_t local_size = qindex.n_locations;
+  Require(n_fields > 0);
+  Require(reconstruction_mask.size() == local_size);
+  Require(one_over_bandwidth.size() == local_size);
+  for (auto &distribution : distributions)
+    Insist(distribution.size() == local_size,
+           "Each distribution must be sized to match the quick_index locations");
+  const bool weighted = !bandwidth_weights.empty();
+  if (weighted)
+    for (size_t i = 0; i < local_size; i++)
+      Insist(reconstruction_mask[i] == 0 || bandwidth_weights[i] > 0.0,
+             "Bandwidths must be postive (>0.0)");
+
+  // ghost data is collected once for all fields (empty if not domain decomposed)
+  std::vector<std::vector<double>> ghost_distributions;
+  std::vector<int> ghost_mask;
+  std::vector<double> ghost_bandwidth_weights;
+  std::vector<std::array<double, 3>> ghost_one_over_bandwidth;
+  if (qindex.domain_decomposed) {
+    ghost_distributions.assign(n_fields, std::vector<double>(qindex.local_ghost_buffer_size));
+    qindex.collect_ghost_data(distributions, ghost_distributions);
+    ghost_mask.resize(qindex.local_ghost_buffer_size);
+    qindex.collect_ghost_data(reconstruction_mask, ghost_mask);
+    ghost_one_over_bandwidth.assign(qindex.local_ghost_buffer_size, {0.0, 0.0, 0.0});
+    qindex.collect_ghost_data(one_over_bandwidth, ghost_one_over_bandwidth);
+    if (weighted) {
+      ghost_bandwidth_weights.resize(qindex.local_ghost_buffer_size);
+      qindex.collect_ghost_data(bandwidth_weights, ghost_bandwidth_weights);
+      for (size_t g = 0; g < qindex.local_ghost_buffer_size; g++)
+        Insist(ghost_mask[g] == 0 || ghost_bandwidth_weights[g] > 0.0,
+               "Bandwidths must be postive (>0.0)");
+    }
+  }
+
+  std::vector<std::vector<double>> result(n_fields, std::vector<double>(local_size, 0.0));
+  // now apply the kernel to the local ranks
+  std::exception_ptr loop_error;
+#ifdef OPENMP_FOUND
+#pragma omp parallel num_threads(n_threads)
+#endif
+  {
+    // per point field accumulators
+    std::vector<double> field_sum(n_fields);
+#ifdef OPENMP_FOUND
+#pragma omp for schedule(dynamic, 64)
+#endif
+    for (size_t i = 0; i < local_size; i++) {
+      try {
+        // skip masked data
+        if (reconstruction_mask[i] == 0) {
+          for (size_t f = 0; f < n_fields; f++)
+            result[f][i] = distributions[f][i];
+          continue;
+        }
+        const std::array<double, 3> r0 = qindex.locations[i];
+        const std::array<double, 3> one_over_h0 = one_over_bandwidth[i];
+        std::array<double, 3> win_min{0.0, 0.0, 0.0};
+        std::array<double, 3> win_max{0.0, 0.0, 0.0};
+        calc_win_min_max(qindex, r0, one_over_h0, win_min, win_max);
+        const std::vector<size_t> coarse_bins = qindex.window_coarse_index_list(win_min, win_max);
+        std::fill(field_sum.begin(), field_sum.end(), 0.0);
+        double normal = 0.0;
+        for (auto &cb : coarse_bins) {
+          // loop over local data
+          for (auto &l : qindex.coarse_bin(cb)) {
+            if (reconstruction_mask[i] != reconstruction_mask[l])
+              continue;
+            const double scale = weighted ? std::max(bandwidth_weights[i], bandwidth_weights[l]) /
+                                                std::min(bandwidth_weights[i], bandwidth_weights[l])
+                                          : 1.0;
+            const double weight = calc_weight(r0, one_over_h0, qindex.locations[l],
+                                              one_over_bandwidth[l], qindex, discontinuity_cutoff,
+                                              scale);
+            for (size_t f = 0; f < n_fields; f++)
+              field_sum[f] += distributions[f][l] * weight;
+            normal += weight;
+          }
+          // loop over ghost data
+          for (auto &g : qindex.ghost_bin(cb)) {
+            if (reconstruction_mask[i] != ghost_mask[g])
+              continue;
+            const double scale =
+                weighted ? std::max(bandwidth_weights[i], ghost_bandwidth_weights[g]) /
+                               std::min(bandwidth_weights[i], ghost_bandwidth_weights[g])
+                         : 1.0;
+            const double weight =
+                calc_weight(r0, one_over_h0, qindex.local_ghost_locations[g],
+                            ghost_one_over_bandwidth[g], qindex, discontinuity_cutoff, scale);
+            for (size_t f = 0; f < n_fields; f++)
+              field_sum[f] += ghost_distributions[f][g] * weight;
+            normal += weight;
+          }
+        }
+        // normalize the integrated weight contributions
+        Check(normal > 0.0);
+        for (size_t f = 0; f < n_fields; f++)
+          result[f][i] = field_sum[f] / normal;
+      } catch (...) {
+#ifdef OPENMP_FOUND
+#pragma omp critical(kde_loop_error)
+#endif
+        if (!loop_error)
+          loop_error = std::current_exception();
+      }
+    }
+  }
+  if (loop_error)
+    std::rethrow_exception(loop_error);
+
+  return result;
+}
+
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief KDE sampled reconstruction
@@ -420,42 +646,44 @@ kde::sampled_reconstruction(const std::vector<double> &distribution,
                                                                 {0.0, 0.0, 0.0});
     qindex.collect_ghost_data(one_over_bandwidth, ghost_one_over_bandwidth);
 
-    std::array<double, 3> win_min{0.0, 0.0, 0.0};
-    std::array<double, 3> win_max{0.0, 0.0, 0.0};
     // now apply the kernel to the local ranks
+    std::exception_ptr loop_error;
+#ifdef OPENMP_FOUND
+#pragma omp parallel for num_threads(n_threads) schedule(dynamic, 64)
+#endif
     for (size_t i = 0; i < local_size; i++) {
-      // skip masked data
-      if (reconstruction_mask[i] == 0) {
-        result[i] = distribution[i];
-        normal[i] = 1.0;
-        continue;
-      }
-      const std::array<double, 3> r0 = qindex.locations[i];
-      const std::array<double, 3> one_over_h0 = one_over_bandwidth[i];
-      calc_win_min_max(qindex, r0, one_over_h0, win_min, win_max);
-      const std::vector<size_t> coarse_bins = qindex.window_coarse_index_list(win_min, win_max);
-      const std::array<double, 3> delta = {
-          (win_max[0] - win_min[0]) / static_cast<double>(dir_samples[0]),
-          (win_max[1] - win_min[1]) / static_cast<double>(dir_samples[1]),
-          (win_max[2] - win_min[2]) / static_cast<double>(dir_samples[2])};
-      // include center point
-      const double weight0 =
-          calc_weight(r0, one_over_h0, r0, one_over_h0, qindex, discontinuity_cutoff);
-      result[i] += distribution[i] * weight0;
-      normal[i] += weight0;
-      for (size_t xi = 0; xi < dir_samples[0]; xi++) {
-        for (size_t yi = 0; yi < dir_samples[1]; yi++) {
-          for (size_t zi = 0; zi < dir_samples[2]; zi++) {
-            double min_dist = 1.0e20;
-            double value = 0.0;
-            std::array<double, 3> inv_bw{1.0e20, 1.0e20, 1.0e20};
-            // fetch local contribution
-            for (auto &cb : coarse_bins) {
-              // skip bins that aren't present in the map (for constness)
-              auto mapItr = qindex.coarse_index_map.find(cb);
-              if (mapItr != qindex.coarse_index_map.end()) {
+      try {
+        // skip masked data
+        if (reconstruction_mask[i] == 0) {
+          result[i] = distribution[i];
+          normal[i] = 1.0;
+          continue;
+        }
+        const std::array<double, 3> r0 = qindex.locations[i];
+        const std::array<double, 3> one_over_h0 = one_over_bandwidth[i];
+        std::array<double, 3> win_min{0.0, 0.0, 0.0};
+        std::array<double, 3> win_max{0.0, 0.0, 0.0};
+        calc_win_min_max(qindex, r0, one_over_h0, win_min, win_max);
+        const std::vector<size_t> coarse_bins = qindex.window_coarse_index_list(win_min, win_max);
+        const std::array<double, 3> delta = {
+            (win_max[0] - win_min[0]) / static_cast<double>(dir_samples[0]),
+            (win_max[1] - win_min[1]) / static_cast<double>(dir_samples[1]),
+            (win_max[2] - win_min[2]) / static_cast<double>(dir_samples[2])};
+        // include center point
+        const double weight0 =
+            calc_weight(r0, one_over_h0, r0, one_over_h0, qindex, discontinuity_cutoff);
+        result[i] += distribution[i] * weight0;
+        normal[i] += weight0;
+        for (size_t xi = 0; xi < dir_samples[0]; xi++) {
+          for (size_t yi = 0; yi < dir_samples[1]; yi++) {
+            for (size_t zi = 0; zi < dir_samples[2]; zi++) {
+              double min_dist = 1.0e20;
+              double value = 0.0;
+              std::array<double, 3> inv_bw{1.0e20, 1.0e20, 1.0e20};
+              // fetch local contribution
+              for (auto &cb : coarse_bins) {
                 // loop over local data
-                for (auto &l : mapItr->second) {
+                for (auto &l : qindex.coarse_bin(cb)) {
                   if (reconstruction_mask[i] != reconstruction_mask[l])
                     continue;
                   const double dx =
@@ -477,11 +705,8 @@ kde::sampled_reconstruction(const std::vector<double> &distribution,
                     inv_bw = one_over_bandwidth[l];
                   }
                 }
-              }
-              auto gmapItr = qindex.local_ghost_index_map.find(cb);
-              if (gmapItr != qindex.local_ghost_index_map.end()) {
                 // loop over ghost data
-                for (auto &g : gmapItr->second) {
+                for (auto &g : qindex.ghost_bin(cb)) {
                   if (reconstruction_mask[i] != ghost_mask[g])
                     continue;
                   const double dx =
@@ -504,56 +729,66 @@ kde::sampled_reconstruction(const std::vector<double> &distribution,
                   }
                 }
               }
+              const std::array<double, 3> location{
+                  win_min[0] + 0.5 * delta[0] + static_cast<double>(xi) * delta[0],
+                  win_min[1] + 0.5 * delta[1] + static_cast<double>(yi) * delta[1],
+                  win_min[2] + 0.5 * delta[2] + static_cast<double>(zi) * delta[2]};
+              const double weight =
+                  calc_weight(r0, one_over_h0, location, inv_bw, qindex, discontinuity_cutoff);
+              result[i] += value * weight;
+              normal[i] += weight;
             }
-            const std::array<double, 3> location{
-                win_min[0] + 0.5 * delta[0] + static_cast<double>(xi) * delta[0],
-                win_min[1] + 0.5 * delta[1] + static_cast<double>(yi) * delta[1],
-                win_min[2] + 0.5 * delta[2] + static_cast<double>(zi) * delta[2]};
-            const double weight =
-                calc_weight(r0, one_over_h0, location, inv_bw, qindex, discontinuity_cutoff);
-            result[i] += value * weight;
-            normal[i] += weight;
           }
         }
+      } catch (...) {
+#ifdef OPENMP_FOUND
+#pragma omp critical(kde_loop_error)
+#endif
+        if (!loop_error)
+          loop_error = std::current_exception();
       }
-    }      // end local loop
+    } // end local loop
+    if (loop_error)
+      std::rethrow_exception(loop_error);
   } else { // local reconstruction only
 
-    std::array<double, 3> win_min{0.0, 0.0, 0.0};
-    std::array<double, 3> win_max{0.0, 0.0, 0.0};
     // now apply the kernel to the local ranks
+    std::exception_ptr loop_error;
+#ifdef OPENMP_FOUND
+#pragma omp parallel for num_threads(n_threads) schedule(dynamic, 64)
+#endif
     for (size_t i = 0; i < local_size; i++) {
-      // skip masked data
-      if (reconstruction_mask[i] == 0) {
-        result[i] = distribution[i];
-        normal[i] = 1.0;
-        continue;
-      }
-      const std::array<double, 3> r0 = qindex.locations[i];
-      const std::array<double, 3> one_over_h0 = one_over_bandwidth[i];
-      calc_win_min_max(qindex, r0, one_over_h0, win_min, win_max);
-      const std::vector<size_t> coarse_bins = qindex.window_coarse_index_list(win_min, win_max);
-      const std::array<double, 3> delta = {
-          (win_max[0] - win_min[0]) / static_cast<double>(dir_samples[0]),
-          (win_max[1] - win_min[1]) / static_cast<double>(dir_samples[1]),
-          (win_max[2] - win_min[2]) / static_cast<double>(dir_samples[2])};
-      // include center point
-      const double weight0 =
-          calc_weight(r0, one_over_h0, r0, one_over_h0, qindex, discontinuity_cutoff);
-      result[i] += distribution[i] * weight0;
-      normal[i] += weight0;
-      for (size_t xi = 0; xi < dir_samples[0]; xi++) {
-        for (size_t yi = 0; yi < dir_samples[1]; yi++) {
-          for (size_t zi = 0; zi < dir_samples[2]; zi++) {
-            double min_dist = 1.0e20;
-            double value = 0.0;
-            std::array<double, 3> inv_bw{1.0e20, 1.0e20, 1.0e20};
-            for (auto &cb : coarse_bins) {
-              // skip bins that aren't present in the map (can't use [] operator with constness)
-              auto mapItr = qindex.coarse_index_map.find(cb);
-              if (mapItr != qindex.coarse_index_map.end()) {
+      try {
+        // skip masked data
+        if (reconstruction_mask[i] == 0) {
+          result[i] = distribution[i];
+          normal[i] = 1.0;
+          continue;
+        }
+        const std::array<double, 3> r0 = qindex.locations[i];
+        const std::array<double, 3> one_over_h0 = one_over_bandwidth[i];
+        std::array<double, 3> win_min{0.0, 0.0, 0.0};
+        std::array<double, 3> win_max{0.0, 0.0, 0.0};
+        calc_win_min_max(qindex, r0, one_over_h0, win_min, win_max);
+        const std::vector<size_t> coarse_bins = qindex.window_coarse_index_list(win_min, win_max);
+        const std::array<double, 3> delta = {
+            (win_max[0] - win_min[0]) / static_cast<double>(dir_samples[0]),
+            (win_max[1] - win_min[1]) / static_cast<double>(dir_samples[1]),
+            (win_max[2] - win_min[2]) / static_cast<double>(dir_samples[2])};
+        // include center point
+        const double weight0 =
+            calc_weight(r0, one_over_h0, r0, one_over_h0, qindex, discontinuity_cutoff);
+        result[i] += distribution[i] * weight0;
+        normal[i] += weight0;
+        for (size_t xi = 0; xi < dir_samples[0]; xi++) {
+          for (size_t yi = 0; yi < dir_samples[1]; yi++) {
+            for (size_t zi = 0; zi < dir_samples[2]; zi++) {
+              double min_dist = 1.0e20;
+              double value = 0.0;
+              std::array<double, 3> inv_bw{1.0e20, 1.0e20, 1.0e20};
+              for (auto &cb : coarse_bins) {
                 // loop over local data
-                for (auto &l : mapItr->second) {
+                for (auto &l : qindex.coarse_bin(cb)) {
                   if (reconstruction_mask[i] != reconstruction_mask[l])
                     continue;
                   const double dx =
@@ -576,19 +811,27 @@ kde::sampled_reconstruction(const std::vector<double> &distribution,
                   }
                 }
               }
+              const std::array<double, 3> location{
+                  win_min[0] + 0.5 * delta[0] + static_cast<double>(xi) * delta[0],
+                  win_min[1] + 0.5 * delta[1] + static_cast<double>(yi) * delta[1],
+                  win_min[2] + 0.5 * delta[2] + static_cast<double>(zi) * delta[2]};
+              const double weight =
+                  calc_weight(r0, one_over_h0, location, inv_bw, qindex, discontinuity_cutoff);
+              result[i] += value * weight;
+              normal[i] += weight;
             }
-            const std::array<double, 3> location{
-                win_min[0] + 0.5 * delta[0] + static_cast<double>(xi) * delta[0],
-                win_min[1] + 0.5 * delta[1] + static_cast<double>(yi) * delta[1],
-                win_min[2] + 0.5 * delta[2] + static_cast<double>(zi) * delta[2]};
-            const double weight =
-                calc_weight(r0, one_over_h0, location, inv_bw, qindex, discontinuity_cutoff);
-            result[i] += value * weight;
-            normal[i] += weight;
           }
         }
+      } catch (...) {
+#ifdef OPENMP_FOUND
+#pragma omp critical(kde_loop_error)
+#endif
+        if (!loop_error)
+          loop_error = std::current_exception();
       }
     }
+    if (loop_error)
+      std::rethrow_exception(loop_error);
   }
 
   // normalize the integrated weight contributions
@@ -653,26 +896,28 @@ kde::log_reconstruction(const std::vector<double> &distribution,
     if (!(log_bias > 0.0))
       return result;
     // now apply the kernel to the local ranks
-    std::array<double, 3> win_min{0.0, 0.0, 0.0};
-    std::array<double, 3> win_max{0.0, 0.0, 0.0};
+    std::exception_ptr loop_error;
+#ifdef OPENMP_FOUND
+#pragma omp parallel for num_threads(n_threads) schedule(dynamic, 64)
+#endif
     for (size_t i = 0; i < local_size; i++) {
-      // skip masked data
-      if (reconstruction_mask[i] == 0) {
-        result[i] = log_transform(distribution[i], log_bias);
-        normal[i] = 1.0;
-        continue;
-      }
-      const std::array<double, 3> r0 = qindex.locations[i];
-      const std::array<double, 3> one_over_h0 = one_over_bandwidth[i];
-      calc_win_min_max(qindex, r0, one_over_h0, win_min, win_max);
-      const std::vector<size_t> coarse_bins = qindex.window_coarse_index_list(win_min, win_max);
-      // fetch local contribution
-      for (auto &cb : coarse_bins) {
-        // skip bins that aren't present in the map (can't use [] operator with constness)
-        auto mapItr = qindex.coarse_index_map.find(cb);
-        if (mapItr != qindex.coarse_index_map.end()) {
+      try {
+        // skip masked data
+        if (reconstruction_mask[i] == 0) {
+          result[i] = log_transform(distribution[i], log_bias);
+          normal[i] = 1.0;
+          continue;
+        }
+        const std::array<double, 3> r0 = qindex.locations[i];
+        const std::array<double, 3> one_over_h0 = one_over_bandwidth[i];
+        std::array<double, 3> win_min{0.0, 0.0, 0.0};
+        std::array<double, 3> win_max{0.0, 0.0, 0.0};
+        calc_win_min_max(qindex, r0, one_over_h0, win_min, win_max);
+        const std::vector<size_t> coarse_bins = qindex.window_coarse_index_list(win_min, win_max);
+        // fetch local contribution
+        for (auto &cb : coarse_bins) {
           // loop over local data
-          for (auto &l : mapItr->second) {
+          for (auto &l : qindex.coarse_bin(cb)) {
             if (reconstruction_mask[i] != reconstruction_mask[l])
               continue;
             const double weight = calc_weight(r0, one_over_h0, qindex.locations[l],
@@ -680,11 +925,8 @@ kde::log_reconstruction(const std::vector<double> &distribution,
             result[i] += log_transform(distribution[l], log_bias) * weight;
             normal[i] += weight;
           }
-        }
-        auto gmapItr = qindex.local_ghost_index_map.find(cb);
-        if (gmapItr != qindex.local_ghost_index_map.end()) {
           // loop over ghost data
-          for (auto &g : gmapItr->second) {
+          for (auto &g : qindex.ghost_bin(cb)) {
             if (reconstruction_mask[i] != ghost_mask[g])
               continue;
             const double weight =
@@ -694,34 +936,44 @@ kde::log_reconstruction(const std::vector<double> &distribution,
             normal[i] += weight;
           }
         }
+      } catch (...) {
+#ifdef OPENMP_FOUND
+#pragma omp critical(kde_loop_error)
+#endif
+        if (!loop_error)
+          loop_error = std::current_exception();
       }
     }
+    if (loop_error)
+      std::rethrow_exception(loop_error);
   } else { // local reconstruction only
     // if the log bias is zero the answer must be zero everywhere
     if (!(log_bias > 0.0))
       return result;
 
     // now apply the kernel to the local ranks
-    std::array<double, 3> win_min{0.0, 0.0, 0.0};
-    std::array<double, 3> win_max{0.0, 0.0, 0.0};
+    std::exception_ptr loop_error;
+#ifdef OPENMP_FOUND
+#pragma omp parallel for num_threads(n_threads) schedule(dynamic, 64)
+#endif
     for (size_t i = 0; i < local_size; i++) {
-      // skip masked data
-      if (reconstruction_mask[i] == 0) {
-        result[i] = log_transform(distribution[i], log_bias);
-        normal[i] = 1.0;
-        continue;
-      }
-      const std::array<double, 3> r0 = qindex.locations[i];
-      const std::array<double, 3> one_over_h0 = one_over_bandwidth[i];
-      calc_win_min_max(qindex, r0, one_over_h0, win_min, win_max);
-      const std::vector<size_t> coarse_bins = qindex.window_coarse_index_list(win_min, win_max);
-      // fetch local contribution
-      for (auto &cb : coarse_bins) {
-        // skip bins that aren't present in the map (can't use [] operator with constness)
-        auto mapItr = qindex.coarse_index_map.find(cb);
-        if (mapItr != qindex.coarse_index_map.end()) {
+      try {
+        // skip masked data
+        if (reconstruction_mask[i] == 0) {
+          result[i] = log_transform(distribution[i], log_bias);
+          normal[i] = 1.0;
+          continue;
+        }
+        const std::array<double, 3> r0 = qindex.locations[i];
+        const std::array<double, 3> one_over_h0 = one_over_bandwidth[i];
+        std::array<double, 3> win_min{0.0, 0.0, 0.0};
+        std::array<double, 3> win_max{0.0, 0.0, 0.0};
+        calc_win_min_max(qindex, r0, one_over_h0, win_min, win_max);
+        const std::vector<size_t> coarse_bins = qindex.window_coarse_index_list(win_min, win_max);
+        // fetch local contribution
+        for (auto &cb : coarse_bins) {
           // loop over local data
-          for (auto &l : mapItr->second) {
+          for (auto &l : qindex.coarse_bin(cb)) {
             if (reconstruction_mask[i] != reconstruction_mask[l])
               continue;
             const double weight = calc_weight(r0, one_over_h0, qindex.locations[l],
@@ -730,8 +982,16 @@ kde::log_reconstruction(const std::vector<double> &distribution,
             normal[i] += weight;
           }
         }
+      } catch (...) {
+#ifdef OPENMP_FOUND
+#pragma omp critical(kde_loop_error)
+#endif
+        if (!loop_error)
+          loop_error = std::current_exception();
       }
     }
+    if (loop_error)
+      std::rethrow_exception(loop_error);
   }
 
   // normalize the integrated weight contributions
@@ -22,15 +22,23 @@ namespace rtt_kde {
  * \brief kernel density estimator class for generated smoothed reconstructions of point wise PDF
  *        data
  *
- * Returns a KDE reconstruction of a multidimensional distribution
+ * Returns a KDE reconstruction of a multidimensional distribution. The reconstruction points are
+ * independent once the ghost data has been collected, so the point loops may be split over
+ * n_threads OpenMP threads. Each point still accumulates its neighbors in the serial order, so the
+ * threaded results are bitwise identical to the single threaded results. An exception may not
+ * leave an OpenMP region, so a DBC failure in a threaded loop is caught there and the first one is
+ * rethrown after the loop.
  */
 //================================================================================================//
 class kde {
 public:
   //! Constructor
   explicit kde(const std::array<bool, 6> reflect_boundary_ = {false, false, false, false, false,
-                                                              false})
-      : reflect_boundary(reflect_boundary_) {}
+                                                              false},
+               const int n_threads_ = 1)
+      : reflect_boundary(reflect_boundary_), n_threads(n_threads_) {
+    Require(n_threads > 0);
+  }
 
   //! Reconstruct distribution
   std::vector<double> reconstruction(const std::vector<double> &distribution,
@@ -45,6 +53,19 @@ public:
                           const std::vector<std::array<double, 3>> &one_over_band_width,
                           const quick_index &qindex, const double discontinuity_cutoff = 1.0) const;
 
+  //! Reconstruct several distributions that share a mask and bandwidths in one neighbor pass
+  std::vector<std::vector<double>>
+  reconstruction(const std::vector<std::vector<double>> &distributions,
+                 const std::vector<int> &reconstruction_mask,
+                 const std::vector<std::array<double, 3>> &one_over_band_width,
+                 const quick_index &qindex, const double discontinuity_cutoff = 1.0) const;
+  std::vector<std::vector<double>>
+  weighted_reconstruction(const std::vector<std::vector<double>> &distributions,
+                          const std::vector<double> &bandwidthweights,
+                          const std::vector<int> &reconstruction_mask,
+                          const std::vector<std::array<double, 3>> &one_over_band_width,
+                          const quick_index &qindex, const double discontinuity_cutoff = 1.0) const;
+
   //! Reconstruct distribution by sampling the surrounding distribution to a fixed integration grid
   std::vector<double>
   sampled_reconstruction(const std::vector<double> &distribution,
@@ -76,12 +97,23 @@ public:
   inline double log_inv_transform(const double log_value, const double bias) const;
 
 private:
+  //! The stencil builder reuses the private window and weight evaluations
+  friend class kde_stencil;
+
   //! Private function to calculate kernel weight
   double calc_weight(const std::array<double, 3> &r0, const std::array<double, 3> &one_over_h0,
                      const std::array<double, 3> &r, const std::array<double, 3> &one_over_h,
                      const quick_index &qindex, const double &discontinuity_cutoff,
                      const double scale = 1.0) const;
 
+  //! Private multi-field reconstruction kernel (empty bandwidthweights for unweighted)
+  std::vector<std::vector<double>>
+  batch_reconstruction(const std::vector<std::vector<double>> &distributions,
+                       const std::vector<double> &bandwidthweights,
+                       const std::vector<int> &reconstruction_mask,
+                       const std::vector<std::array<double, 3>> &one_over_band_width,
+                       const quick_index &qindex, const double discontinuity_cutoff) const;
+
   //! Private function to calculate the window bounds
   void calc_win_min_max(const quick_index &qindex, const std::array<double, 3> &position,
                         const std::array<double, 3> &one_over_bandwidth, std::array<double, 3> &min,
@@ -104,6 +136,8 @@ private:
   // DATA
   //! reflecting boundary conditions [lower_x, upper_x, lower_y, upper_y, lower_z, upper_z]
   const std::array<bool, 6> reflect_boundary;
+  //! number of OpenMP threads used to split the reconstruction points (results do not depend on it)
+  const int n_threads;
 };
 
 } // end namespace rtt_kde
@@ -0,0 +1,208 @@
+//--------------------------------------------*-C++-*---------------------------------------------//
+/*!
+ * \file   kde/kde_stencil.cc
+ * \author agent
+ * \brief  Explicitly defined kde_stencil functions.
+ * \note   Copyright (C) 2026 Triad National Security, LLC., All rights reserved. */
+//------------------------------------------------------------------------------------------------//
+
+#include "kde_stencil.hh"
+#include "c4/c4_omp.h"
+#include <algorithm>
+
+namespace rtt_kde {
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief kde_stencil constructor.
+ *
+ * Walk the coarse bins of every reconstruction window once and store the kernel weight of every
+ * neighbor that contributes to each local point. The neighbors are stored in the same order that
+ * kde::reconstruction visits them. Masked points store a single unit weight on themselves so they
+ * pass through unchanged.
+ *
+ * \param[in] kernel kde object (boundary conditions and thread count)
+ * \param[in] qindex quick_index class to be used for data access.
+ * \param[in] reconstruction_mask designate points that should be reconstructed together
+ * \param[in] one_over_bandwidth inverse bandwidth size to be used at each data location
+ * \param[in] discontinuity_cutoff maximum size of value discrepancies to include in the
+ *              reconstruction
+ * \param[in] bandwidth_weights used to bias the bandwidths (empty for the unweighted kernel)
+ */
+kde_stencil::kde_stencil(const kde &kernel, const quick_index &qindex,
+                         const std::vector<int> &reconstruction_mask,
+                         const std::vector<std::array<double, 3>> &one_over_bandwidth,
+                         const double discontinuity_cutoff,
+                         const std::vector<double> &bandwidth_weights)
+    : n_locations(qindex.n_locations),
+      n_ghost(qindex.domain_decomposed ? qindex.local_ghost_buffer_size : 0),
+      n_threads(kernel.n_threads), row_offsets(qindex.n_locations + 1, 0UL),
+      normal(qindex.n_locations, 0.0) {
+  Require(qindex.dim < 3 && qindex.dim > 0);
+  Require(reconstruction_mask.size() == n_locations);
+  Require(one_over_bandwidth.size() == n_locations);
+  const bool weighted = !bandwidth_weights.empty();
+  Insist(!weighted || bandwidth_weights.size() == n_locations,
+         "bandwidth_weights must be sized to match the quick_index locations");
+
+  // fetch the ghost data needed to evaluate the weights
+  std::vector<int> ghost_mask;
+  std::vector<double> ghost_bandwidth_weights;
+  std::vector<std::array<double, 3>> ghost_one_over_bandwidth;
+  if (qindex.domain_decomposed) {
+    ghost_mask.resize(n_ghost);
+    qindex.collect_ghost_data(reconstruction_mask, ghost_mask);
+    ghost_one_over_bandwidth.assign(n_ghost, {0.0, 0.0, 0.0});
+    qindex.collect_ghost_data(one_over_bandwidth, ghost_one_over_bandwidth);
+    if (weighted) {
+      ghost_bandwidth_weights.resize(n_ghost);
+      qindex.collect_ghost_data(bandwidth_weights, ghost_bandwidth_weights);
+    }
+  }
+
+  columns.reserve(n_locations);
+  weights.reserve(n_locations);
+  for (size_t i = 0; i < n_locations; i++) {
+    // masked data passes through
+    if (reconstruction_mask[i] == 0) {
+      columns.push_back(i);
+      weights.push_back(1.0);
+      normal[i] = 1.0;
+      row_offsets[i + 1] = columns.size();
+      continue;
+    }
+    Insist(!weighted || bandwidth_weights[i] > 0.0, "Bandwidths must be postive (>0.0)");
+    const std::array<double, 3> r0 = qindex.locations[i];
+    const std::array<double, 3> one_over_h0 = one_over_bandwidth[i];
+    std::array<double, 3> win_min{0.0, 0.0, 0.0};
+    std::array<double, 3> win_max{0.0, 0.0, 0.0};
+    kernel.calc_win_min_max(qindex, r0, one_over_h0, win_min, win_max);
+    const std::vector<size_t> coarse_bins = qindex.window_coarse_index_list(win_min, win_max);
+    for (auto &cb : coarse_bins) {
+      // loop over local data
+      for (auto &l : qindex.coarse_bin(cb)) {
+        if (reconstruction_mask[i] != reconstruction_mask[l])
+          continue;
+        Insist(!weighted || bandwidth_weights[l] > 0.0, "Bandwidths must be postive (>0.0)");
+        const double scale = weighted ? std::max(bandwidth_weights[i], bandwidth_weights[l]) /
+                                            std::min(bandwidth_weights[i], bandwidth_weights[l])
+                                      : 1.0;
+        const double weight =
+            kernel.calc_weight(r0, one_over_h0, qindex.locations[l], one_over_bandwidth[l], qindex,
+                               discontinuity_cutoff, scale);
+        columns.push_back(l);
+        weights.push_back(weight);
+        normal[i] += weight;
+      }
+      // loop over ghost data
+      for (auto &g : qindex.ghost_bin(cb)) {
+        if (reconstruction_mask[i] != ghost_mask[g])
+          continue;
+        Insist(!weighted || ghost_bandwidth_weights[g] > 0.0, "Bandwidths must be postive (>0.0)");
+        const double scale =
+            weighted ? std::max(bandwidth_weights[i], ghost_bandwidth_weights[g]) /
+                           std::min(bandwidth_weights[i], ghost_bandwidth_weights[g])
+                     : 1.0;
+        const double weight =
+            kernel.calc_weight(r0, one_over_h0, qindex.local_ghost_locations[g],
+                               ghost_one_over_bandwidth[g], qindex, discontinuity_cutoff, scale);
+        columns.push_back(n_locations + g);
+        weights.push_back(weight);
+        normal[i] += weight;
+      }
+    }
+    Check(normal[i] > 0.0);
+    row_offsets[i + 1] = columns.size();
+  }
+  // split the rows into those that only use local data and those that also need ghost data
+  for (size_t i = 0; i < n_locations; i++) {
+    const bool boundary = std::any_of(columns.begin() + static_cast<std::ptrdiff_t>(row_offsets[i]),
+                                      columns.begin() +
+                                          static_cast<std::ptrdiff_t>(row_offsets[i + 1]),
+                                      [this](const size_t c) { return c >= n_locations; });
+    (boundary ? boundary_rows : interior_rows).push_back(i);
+  }
+  columns.shrink_to_fit();
+  weights.shrink_to_fit();
+  Ensure(row_offsets[n_locations] == columns.size());
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Apply the stencil to a single distribution.
+ *
+ * \param[in] distribution original data to be reconstructed
+ * \param[in] qindex the quick_index the stencil was built with (used for the ghost exchange)
+ * \return final local KDE function distribution reconstruction
+ */
+std::vector<double> kde_stencil::apply(const std::vector<double> &distribution,
+                                       const quick_index &qindex) const {
+  return apply(std::vector<std::vector<double>>(1, distribution), qindex)[0];
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Apply the stencil to several distributions.
+ *
+ * The ghost data of all fields is collected in a single split-phase exchange. The interior rows
+ * (rows without ghost columns) are computed while the ghost puts are in flight and the boundary
+ * rows once the exchange completes. Each stencil row is streamed once for all fields.
+ *
+ * \param[in] distributions original data to be reconstructed [n_fields][n_locations]
+ * \param[in] qindex the quick_index the stencil was built with (used for the ghost exchange)
+ * \return final local KDE function distribution reconstruction of each field
+ */
+std::vector<std::vector<double>>
+kde_stencil::apply(const std::vector<std::vector<double>> &distributions,
+                   const quick_index &qindex) const {
+  Insist(qindex.n_locations == n_locations &&
+             (qindex.domain_decomposed ? qindex.local_ghost_buffer_size : 0) == n_ghost,
+         "kde_stencil must be applied with the quick_index it was built from");
+  const size_t n_fields = distributions.size();
+  Require(n_fields > 0);
+
+  // assemble the combined [local, ghost] data for each field
+  std::vector<std::vector<double>> data(n_fields, std::vector<double>(n_locations + n_ghost));
+  for (size_t f = 0; f < n_fields; f++) {
+    Insist(distributions[f].size() == n_locations,
+           "Each distribution must be sized to match the stencil");
+    std::copy(distributions[f].begin(), distributions[f].end(), data[f].begin());
+  }
+  quick_index::ghost_request request;
+  if (qindex.domain_decomposed)
+    qindex.begin_collect_ghost_data(distributions, request);
+
+  std::vector<std::vector<double>> result(n_fields, std::vector<double>(n_locations, 0.0));
+  auto apply_rows = [this, n_fields, &data, &result](const std::vector<size_t> &rows) {
+    const size_t n_rows = rows.size();
+#ifdef OPENMP_FOUND
+#pragma omp parallel for num_threads(n_threads) schedule(static)
+#endif
+    for (size_t r = 0; r < n_rows; r++) {
+      const size_t i = rows[r];
+      for (size_t f = 0; f < n_fields; f++) {
+        double sum = 0.0;
+        for (size_t k = row_offsets[i]; k < row_offsets[i + 1]; k++)
+          sum += data[f][columns[k]] * weights[k];
+        result[f][i] = sum / normal[i];
+      }
+    }
+  };
+  apply_rows(interior_rows);
+
+  if (qindex.domain_decomposed) {
+    std::vector<std::vector<double>> ghost_data(n_fields, std::vector<double>(n_ghost));
+    qindex.finish_collect_ghost_data(request, ghost_data);
+    for (size_t f = 0; f < n_fields; f++)
+      std::copy(ghost_data[f].begin(), ghost_data[f].end(),
+                data[f].begin() + static_cast<std::ptrdiff_t>(n_locations));
+  }
+  apply_rows(boundary_rows);
+  return result;
+}
+
+} // end namespace rtt_kde
+
+//------------------------------------------------------------------------------------------------//
+// end of kde/kde_stencil.cc
+//------------------------------------------------------------------------------------------------//
@@ -0,0 +1,81 @@
+//--------------------------------------------*-C++-*---------------------------------------------//
+/*!
+ * \file   kde/kde_stencil.hh
+ * \author agent
+ * \brief  Precomputed sparse (CSR) neighbor and weight stencil for repeated KDE reconstructions on
+ *         a static point set.
+ * \note   Copyright (C) 2026 Triad National Security, LLC., All rights reserved. */
+//------------------------------------------------------------------------------------------------//
+
+#ifndef kde_kde_stencil_hh
+#define kde_kde_stencil_hh
+
+#include "kde.hh"
+
+namespace rtt_kde {
+
+//================================================================================================//
+/*!
+ * \class kde_stencil
+ * \brief Sparse reconstruction operator for a fixed quick_index, mask and bandwidth set
+ *
+ * When the point locations, the reconstruction mask and the bandwidths stay fixed the kde neighbor
+ * set and the kernel weights do not change between calls. This class evaluates them once and
+ * stores them in CSR form (one row per local point). Column indices [0, n_locations) address local
+ * data and [n_locations, n_locations + local_ghost_buffer_size) address the ghost buffer. Each row
+ * also stores its weight normalization, so apply() returns exactly the same values as
+ * kde::reconstruction (or kde::weighted_reconstruction when bandwidth weights are supplied) with a
+ * sparse matrix-vector product.
+ */
+//================================================================================================//
+class kde_stencil {
+public:
+  //! Constructor
+  kde_stencil(const kde &kernel, const quick_index &qindex,
+              const std::vector<int> &reconstruction_mask,
+              const std::vector<std::array<double, 3>> &one_over_bandwidth,
+              const double discontinuity_cutoff = 1.0,
+              const std::vector<double> &bandwidth_weights = std::vector<double>());
+
+  //! Apply the stencil to a single distribution
+  std::vector<double> apply(const std::vector<double> &distribution,
+                            const quick_index &qindex) const;
+
+  //! Apply the stencil to several distributions (one ghost exchange for all fields)
+  std::vector<std::vector<double>> apply(const std::vector<std::vector<double>> &distributions,
+                                         const quick_index &qindex) const;
+
+  //! Number of rows (local points)
+  size_t size() const { return n_locations; }
+
+  //! Total number of stored neighbor weights
+  size_t n_entries() const { return columns.size(); }
+
+private:
+  //! number of local points the stencil was built for
+  const size_t n_locations;
+  //! ghost buffer size the stencil was built for
+  const size_t n_ghost;
+  //! number of OpenMP threads used in apply (copied from the kde)
+  const int n_threads;
+  //! CSR row offsets (n_locations + 1)
+  std::vector<size_t> row_offsets;
+  //! CSR columns into the combined [local, ghost] data space
+  std::vector<size_t> columns;
+  //! CSR kernel weights
+  std::vector<double> weights;
+  //! per row sum of the kernel weights
+  std::vector<double> normal;
+  //! rows that only reference local data (computed while the ghost exchange is in flight)
+  std::vector<size_t> interior_rows;
+  //! rows that reference ghost data
+  std::vector<size_t> boundary_rows;
+};
+
+} // end namespace rtt_kde
+
+#endif // kde_kde_stencil_hh
+
+//------------------------------------------------------------------------------------------------//
+// end of kde/kde_stencil.hh
+//------------------------------------------------------------------------------------------------//
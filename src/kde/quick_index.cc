@@ -13,6 +13,21 @@
 
 namespace rtt_kde {
 
+namespace {
+//------------------------------------------------------------------------------------------------//
+// Expand CSR offsets (one entry per global bin plus one) and a contiguous index list into a map of
+// the non-empty bins.
+std::map<size_t, std::vector<size_t>> expand_bin_csr(const std::vector<size_t> &offsets,
+                                                     const std::vector<size_t> &indices) {
+  std::map<size_t, std::vector<size_t>> bin_map;
+  for (size_t bin = 0; bin + 1 < offsets.size(); bin++)
+    if (offsets[bin + 1] > offsets[bin])
+      bin_map[bin].assign(indices.begin() + static_cast<std::ptrdiff_t>(offsets[bin]),
+                          indices.begin() + static_cast<std::ptrdiff_t>(offsets[bin + 1]));
+  return bin_map;
+}
+} // namespace
+
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief quick_index constructor.
@@ -109,9 +124,15 @@ quick_index::quick_index(const size_t dim_, const std::vector<std::array<double,
   const auto crd = static_cast<double>(coarse_bin_resolution);
   const auto inv_crd = 1.0 / crd;
 
-  // build up the local hash table of into global bins
-  size_t locIndex = 0;
-  for (auto &loc : locations) {
+  n_coarse_bins = coarse_bin_resolution;
+  for (size_t d = 1; d < dim; d++)
+    n_coarse_bins *= coarse_bin_resolution;
+
+  // build up the local hash table of into global bins, stored in a CSR layout (counting sort)
+  std::vector<size_t> location_bin(n_locations);
+  coarse_bin_offsets.assign(n_coarse_bins + 1, 0UL);
+  for (size_t locIndex = 0; locIndex < n_locations; locIndex++) {
+    const std::array<double, 3> &loc = locations[locIndex];
     std::array<size_t, 3> index{0UL, 0UL, 0UL};
     std::array<double, 3> index_center{0.0, 0.0, 0.0};
     std::array<double, 3> index_size{0.0, 0.0, 0.0};
@@ -132,11 +153,23 @@ quick_index::quick_index(const size_t dim_, const std::vector<std::array<double,
     // build up the local index hash
     const size_t global_index = index[0] + index[1] * coarse_bin_resolution +
                                 index[2] * coarse_bin_resolution * coarse_bin_resolution;
-    coarse_index_map[global_index].push_back(locIndex);
+    Check(global_index < n_coarse_bins);
+    location_bin[locIndex] = global_index;
+    coarse_bin_offsets[global_index + 1]++;
     coarse_index_center[global_index] = index_center;
     coarse_index_size[global_index] = index_size;
-    locIndex++;
   }
+  std::partial_sum(coarse_bin_offsets.begin(), coarse_bin_offsets.end(),
+                   coarse_bin_offsets.begin());
+  // points are placed in ascending index order within each bin
+  coarse_bin_indices.resize(n_locations);
+  {
+    std::vector<size_t> bin_fill(coarse_bin_offsets.begin(), coarse_bin_offsets.end() - 1);
+    for (size_t locIndex = 0; locIndex < n_locations; locIndex++)
+      coarse_bin_indices[bin_fill[location_bin[locIndex]]++] = locIndex;
+  }
+  // legacy map copy of the local bins
+  coarse_index_map = expand_bin_csr(coarse_bin_offsets, coarse_bin_indices);
 
   // Now we need to build up ghost location map data for domain decomposed mode
   if (domain_decomposed) {
@@ -152,32 +185,46 @@ quick_index::quick_index(const size_t dim_, const std::vector<std::array<double,
     //
     // \note If this gets to big we could stride over a subset of coarse bins and do multiple
     // iterations of mpi communication to build up the map
-    size_t nbins = coarse_bin_resolution;
-    for (size_t d = 1; d < dim; d++)
-      nbins *= coarse_bin_resolution;
+    const size_t nbins = n_coarse_bins;
 
     std::vector<int> global_index_per_bin_per_proc(nbins * nodes, 0UL);
-    for (auto &map : coarse_index_map) {
-      const size_t gipbpp_index = map.first + nbins * node;
+    for (size_t bin = 0; bin < nbins; bin++) {
+      const size_t gipbpp_index = bin + nbins * node;
       // must cast to an int to accomidate mpi int types.
-      global_index_per_bin_per_proc[gipbpp_index] = static_cast<int>(map.second.size());
+      global_index_per_bin_per_proc[gipbpp_index] = static_cast<int>(coarse_bin(bin).size());
     }
     rtt_c4::global_sum(&global_index_per_bin_per_proc[0], nbins * nodes);
 
-    // calculate local ghost buffer size
-    local_ghost_buffer_size = 0;
-    for (size_t proc = 0; proc < nodes; proc++) {
-      for (auto &bin : local_bins) {
-        if (node != proc) {
-          const size_t gipbpp_index = bin + nbins * proc;
-          // build up the local ghost index map
-          for (int i = 0; i < global_index_per_bin_per_proc[gipbpp_index]; i++)
-            local_ghost_index_map[bin].push_back(local_ghost_buffer_size + i);
-          // accumulate the total ghost points
-          local_ghost_buffer_size += global_index_per_bin_per_proc[gipbpp_index];
+    // calculate local ghost buffer size and the ghost CSR offsets
+    ghost_bin_offsets.assign(nbins + 1, 0UL);
+    for (size_t proc = 0; proc < nodes; proc++)
+      if (node != proc)
+        for (auto &bin : local_bins)
+          ghost_bin_offsets[bin + 1] +=
+              static_cast<size_t>(global_index_per_bin_per_proc[bin + nbins * proc]);
+    std::partial_sum(ghost_bin_offsets.begin(), ghost_bin_offsets.end(),
+                     ghost_bin_offsets.begin());
+    local_ghost_buffer_size = ghost_bin_offsets[nbins];
+
+    // the ghost buffer is ordered by processor and then by local bin, so each bin holds the
+    // buffer indices of its points in processor order
+    ghost_bin_indices.resize(local_ghost_buffer_size);
+    {
+      std::vector<size_t> bin_fill(ghost_bin_offsets.begin(), ghost_bin_offsets.end() - 1);
+      size_t ghost_index = 0;
+      for (size_t proc = 0; proc < nodes; proc++) {
+        if (node == proc)
+          continue;
+        for (auto &bin : local_bins) {
+          const int n_ghost = global_index_per_bin_per_proc[bin + nbins * proc];
+          for (int i = 0; i < n_ghost; i++)
+            ghost_bin_indices[bin_fill[bin]++] = ghost_index++;
         }
       }
+      Check(ghost_index == local_ghost_buffer_size);
     }
+    // legacy map copy of the ghost bins
+    local_ghost_index_map = expand_bin_csr(ghost_bin_offsets, ghost_bin_indices);
 
     std::vector<int> global_need_bins_per_proc(nbins * nodes, 0UL);
     // global need bins
@@ -203,17 +250,18 @@ quick_index::quick_index(const size_t dim_, const std::vector<std::array<double,
           }
         }
       }
-      for (auto &map : coarse_index_map) {
-        if (rtt_c4::node() != rec_proc) {
-          const size_t gipbpp_index = map.first + nbins * rec_proc;
+      for (size_t bin = 0; bin < nbins; bin++) {
+        const size_t bin_size = coarse_bin(bin).size();
+        if (bin_size > 0 && rtt_c4::node() != rec_proc) {
+          const size_t gipbpp_index = bin + nbins * rec_proc;
           if (global_need_bins_per_proc[gipbpp_index] > 0) {
             // capture the largest put buffer on this rank
-            if (map.second.size() > max_put_buffer_size)
-              max_put_buffer_size = map.second.size();
+            if (bin_size > max_put_buffer_size)
+              max_put_buffer_size = bin_size;
 
             // build up map data
-            put_window_map[map.first].push_back(std::array<int, 2>{rec_proc, offset});
-            offset += static_cast<int>(map.second.size());
+            put_window_map[bin].push_back(std::array<int, 2>{rec_proc, offset});
+            offset += static_cast<int>(bin_size);
           }
         }
       }
@@ -230,14 +278,15 @@ quick_index::quick_index(const size_t dim_, const std::vector<std::array<double,
 
 #ifdef C4_MPI
 //------------------------------------------------------------------------------------------------//
-// call MPI_put using a chunk style write to avoid error in MPI_put with large local buffers.
-auto put_lambda = [](auto &put, auto &put_buffer, auto &put_size, auto &win,
+// call MPI_put using a chunk style write to avoid error in MPI_put with large local buffers. Each
+// ghost location on the target rank holds stride values.
+auto put_lambda = [](auto &put, auto *put_buffer, const int put_size, const int stride, auto &win,
                      MPI_Datatype mpi_data_type) {
   // temporary work around until RMA is available in c4
   // loop over all ranks we need to send this buffer too.
   for (auto &putv : put.second) {
     const int put_rank = putv[0];
-    const int put_offset = putv[1];
+    const int put_offset = putv[1] * stride;
     // This is dumb, but we need to write in chunks because MPI_Put writes
     // junk with large (>10,000) buffer sizes.
     int chunk_size = 1000;
@@ -247,21 +296,190 @@ auto put_lambda = [](auto &put, auto &put_buffer, auto &put_size, auto &win,
     for (int c = 0; c < nchunks; c++) {
       chunk_size = std::min(chunk_size, static_cast<int>(put_size) - nput);
       Check(chunk_size > 0);
-      MPI_Put(&put_buffer[nput], chunk_size, mpi_data_type, put_rank, put_offset, chunk_size,
-              mpi_data_type, win);
+      MPI_Put(&put_buffer[nput], chunk_size, mpi_data_type, put_rank, put_offset + nput,
+              chunk_size, mpi_data_type, win);
       nput += chunk_size;
     }
   }
 };
 #endif
 
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Release a ghost_request
+ *
+ * A request that is dropped between begin_collect_ghost_data and finish_collect_ghost_data (e.g.
+ * during stack unwinding) still closes its put epoch and frees the window, so the collective fence
+ * is matched on every rank and the window does not leak. The ghost data is discarded.
+ */
+quick_index::ghost_request::~ghost_request() {
+#ifdef C4_MPI
+  if (win != MPI_WIN_NULL) {
+    MPI_Win_fence((MPI_MODE_NOSTORE | MPI_MODE_NOSUCCEED), // NOLINT [hicpp-signed-bitwise]
+                  win);
+    MPI_Win_free(&win);
+  }
+#endif
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Pack local data and open the put epoch of a split-phase ghost exchange
+ *
+ * All n_fields values of a point are packed next to each other, so each put bin is sent to each
+ * destination rank with a single (chunked) put into a [ghost_index][field] target buffer. The
+ * packed data is kept in the request until the epoch is closed.
+ *
+ * \param[in] n_fields number of values per local point
+ * \param[in] pack functor returning the value of field f at local point l as pack(l, f)
+ * \param[in,out] request inactive request that holds the exchange state on return
+ */
+template <typename Packer>
+void quick_index::begin_packed_ghost_put(const size_t n_fields, const Packer &pack,
+                                         ghost_request &request) const {
+  Insist(domain_decomposed, "Calling collect_ghost_data with a quick_index object that specified "
+                            "domain_decomposed=.false.");
+  Insist(!request.is_active, "ghost_request is already in use by another exchange");
+  Require(n_fields > 0);
+  request.is_active = true;
+  request.n_fields = n_fields;
+  request.ghost_buffer.assign(local_ghost_buffer_size * n_fields, 0.0);
+#ifdef C4_MPI // temporary work around until RMA is available in c4
+  // pack every put bin once; the same packed bin is sent to all of its destination ranks
+  size_t put_size = 0;
+  for (auto &put : put_window_map)
+    put_size += coarse_bin(put.first).size() * n_fields;
+  request.put_buffer.resize(put_size);
+  size_t putIndex = 0;
+  for (auto &put : put_window_map)
+    for (auto &l : coarse_bin(put.first))
+      for (size_t f = 0; f < n_fields; f++)
+        request.put_buffer[putIndex++] = pack(l, f);
+  Check(putIndex == put_size);
+
+  MPI_Win_create(request.ghost_buffer.data(), request.ghost_buffer.size() * sizeof(double),
+                 sizeof(double), MPI_INFO_NULL, MPI_COMM_WORLD, &request.win);
+  Remember(int errorcode =) MPI_Win_fence(MPI_MODE_NOSTORE, request.win);
+  Check(errorcode == MPI_SUCCESS);
+  putIndex = 0;
+  for (auto &put : put_window_map) {
+    const int bin_size = static_cast<int>(coarse_bin(put.first).size() * n_fields);
+    put_lambda(put, request.put_buffer.data() + putIndex, bin_size, static_cast<int>(n_fields),
+               request.win, MPI_DOUBLE);
+    putIndex += static_cast<size_t>(bin_size);
+  }
+#else
+  std::ignore = pack;
+#endif
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Close the put epoch of a split-phase ghost exchange
+ *
+ * On return the request ghost_buffer holds the ghost data and the request is inactive again.
+ *
+ * \param[in,out] request active request returned by begin_packed_ghost_put
+ */
+void quick_index::wait_ghost_put(ghost_request &request) const {
+  Insist(request.is_active, "finish_collect_ghost_data called without a matching begin");
+#ifdef C4_MPI // temporary work around until RMA is available in c4
+  Remember(int errorcode =)
+      MPI_Win_fence((MPI_MODE_NOSTORE | MPI_MODE_NOSUCCEED), // NOLINT [hicpp-signed-bitwise]
+                    request.win);
+  Check(errorcode == MPI_SUCCESS);
+  MPI_Win_free(&request.win);
+  request.put_buffer.clear();
+#endif
+  request.is_active = false;
+  Ensure(request.ghost_buffer.size() == local_ghost_buffer_size * request.n_fields);
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Start a split-phase ghost exchange of a vector<double>
+ *
+ * Packs the local data and issues the one sided puts without waiting for them to complete. Work
+ * that does not depend on ghost data can be done before calling finish_collect_ghost_data.
+ *
+ * \param[in] local_data the local vector data that is required to be available as ghost cell data
+ *              on other processors.
+ * \param[in,out] request inactive request that holds the exchange state on return
+ */
+void quick_index::begin_collect_ghost_data(const std::vector<double> &local_data,
+                                           ghost_request &request) const {
+  Require(local_data.size() == n_locations);
+  begin_packed_ghost_put(
+      1, [&local_data](const size_t l, const size_t /*f*/) { return local_data[l]; }, request);
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Start a split-phase ghost exchange of several fields
+ *
+ * All fields are packed together and sent in a single put epoch (one pair of window fences for all
+ * fields rather than one per field).
+ *
+ * \param[in] local_data the local multi-field data [n_fields][n_locations] that is required to be
+ *              available as ghost cell data on other processors.
+ * \param[in,out] request inactive request that holds the exchange state on return
+ */
+void quick_index::begin_collect_ghost_data(const std::vector<std::vector<double>> &local_data,
+                                           ghost_request &request) const {
+  Insist(!local_data.empty(), "begin_collect_ghost_data requires at least one field");
+  for (auto &field : local_data)
+    Insist(field.size() == n_locations, "Each local_data field must be sized to n_locations");
+  begin_packed_ghost_put(
+      local_data.size(),
+      [&local_data](const size_t l, const size_t f) { return local_data[f][l]; }, request);
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Complete a split-phase ghost exchange of a vector<double>
+ *
+ * \param[in,out] request active request started with the vector<double> begin_collect_ghost_data
+ * \param[in,out] local_ghost_data the resulting ghost data
+ */
+void quick_index::finish_collect_ghost_data(ghost_request &request,
+                                            std::vector<double> &local_ghost_data) const {
+  Insist(request.n_fields == 1, "ghost_request was started with more than one field");
+  Insist(local_ghost_data.size() == local_ghost_buffer_size,
+         "ghost_data input must be sized via quick_index.local_ghost_buffer_size");
+  wait_ghost_put(request);
+  std::copy(request.ghost_buffer.begin(), request.ghost_buffer.end(), local_ghost_data.begin());
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Complete a split-phase ghost exchange of several fields
+ *
+ * \param[in,out] request active request started with the multi-field begin_collect_ghost_data
+ * \param[in,out] local_ghost_data the resulting ghost data [n_fields][local_ghost_buffer_size]
+ */
+void quick_index::finish_collect_ghost_data(
+    ghost_request &request, std::vector<std::vector<double>> &local_ghost_data) const {
+  const size_t n_fields = request.n_fields;
+  Insist(local_ghost_data.size() == n_fields,
+         "The local_data.size() and the local_ghost_data.size() vectors much match");
+  for (size_t f = 0; f < n_fields; f++) {
+    Insist(local_ghost_data[f].size() == local_ghost_buffer_size,
+           "ghost_data[" + std::to_string(f) +
+               "] input must be sized via quick_index.local_ghost_buffer_size");
+  }
+  wait_ghost_put(request);
+  for (size_t g = 0; g < local_ghost_buffer_size; g++)
+    for (size_t f = 0; f < n_fields; f++)
+      local_ghost_data[f][g] = request.ghost_buffer[g * n_fields + f];
+}
+
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Collect ghost data for a vector<std::array<double, 3>>
  *
  * Collect ghost data for vector of 3 dimensional arrays. This function uses RMA and the local
  * put_window_map to allow each rank to independently fill in its data to ghost cells of other
- * ranks.
+ * ranks. All dimensions are sent in a single put epoch.
  *
  * \param[in] local_data the local 3 dimensional data that is required to be available as ghost cell
  *              data on other processors.
@@ -270,48 +488,15 @@ auto put_lambda = [](auto &put, auto &put_buffer, auto &put_size, auto &win,
 void quick_index::collect_ghost_data(const std::vector<std::array<double, 3>> &local_data,
                                      std::vector<std::array<double, 3>> &local_ghost_data) const {
   Require(local_data.size() == n_locations);
-  Insist(domain_decomposed, "Calling collect_ghost_data with a quick_index object that specified "
-                            "domain_decomposed=.false.");
-
   Insist(local_ghost_data.size() == local_ghost_buffer_size,
          "ghost_data input must be sized via quick_index.local_ghost_buffer_size");
-#ifdef C4_MPI // temporary work around until RMA is available in c4
-  // Use one sided MPI Put commands to fill up the ghost cell location data
-  std::vector<double> local_ghost_buffer(local_ghost_buffer_size, 0.0);
-  std::vector<double> put_buffer(max_put_buffer_size, 0.0);
-  MPI_Win win;
-  MPI_Win_create(local_ghost_buffer.data(), local_ghost_buffer_size * sizeof(double),
-                 sizeof(double), MPI_INFO_NULL, MPI_COMM_WORLD, &win);
-
-  // working from my local data put the ghost data on the other ranks
-  for (size_t d = 0; d < dim; d++) {
-    Remember(int errorcode =) MPI_Win_fence(MPI_MODE_NOSTORE, win);
-    Check(errorcode == MPI_SUCCESS);
-    for (auto &put : put_window_map) {
-      // use map.at() to allow const access
-      Check((coarse_index_map.at(put.first)).size() <= max_put_buffer_size);
-      // fill up the current ghost cell data for this dimension
-      int putIndex = 0;
-      for (auto &l : coarse_index_map.at(put.first)) {
-        put_buffer[putIndex] = local_data[l][d];
-        putIndex++;
-      }
-      put_lambda(put, put_buffer, putIndex, win, MPI_DOUBLE);
-    }
-    Remember(errorcode =)
-        MPI_Win_fence((MPI_MODE_NOSTORE | MPI_MODE_NOSUCCEED), // NOLINT [hicpp-signed-bitwise]
-                      win);
-    Check(errorcode == MPI_SUCCESS);
-
-    // alright move the position buffer to the final correct array positions
-    int posIndex = 0;
-    for (auto &pos : local_ghost_buffer) {
-      local_ghost_data[posIndex][d] = pos;
-      posIndex++;
-    }
-  }
-  MPI_Win_free(&win);
-#endif
+  ghost_request request;
+  begin_packed_ghost_put(
+      dim, [&local_data](const size_t l, const size_t d) { return local_data[l][d]; }, request);
+  wait_ghost_put(request);
+  for (size_t g = 0; g < local_ghost_buffer_size; g++)
+    for (size_t d = 0; d < dim; d++)
+      local_ghost_data[g][d] = request.ghost_buffer[g * dim + d];
 }
 
 //------------------------------------------------------------------------------------------------//
@@ -320,7 +505,7 @@ void quick_index::collect_ghost_data(const std::vector<std::array<double, 3>> &l
  *
  * Collect ghost data for vector<vector<double>> arrays. This function uses RMA and the local
  * put_window_map to allow each rank to independently fill in its data to ghost cells of other
- * ranks.
+ * ranks. All fields are sent in a single put epoch.
  *
  * \param[in] local_data the local multi-dimensional data that is required to be available as ghost
  * cell data on other processors.
@@ -328,55 +513,13 @@ void quick_index::collect_ghost_data(const std::vector<std::array<double, 3>> &l
  */
 void quick_index::collect_ghost_data(const std::vector<std::vector<double>> &local_data,
                                      std::vector<std::vector<double>> &local_ghost_data) const {
-  Insist(domain_decomposed, "Calling collect_ghost_data with a quick_index object that specified "
-                            "domain_decomposed=.false.");
-  size_t data_dim = local_data.size();
-  size_t ghost_data_dim = local_ghost_data.size();
-  Insist(data_dim == ghost_data_dim,
+  Insist(local_data.size() == local_ghost_data.size(),
          "The local_data.size() and the local_ghost_data.size() vectors much match");
-  // Check ghost data
-  for (size_t d = 0; d < ghost_data_dim; d++) {
-    Insist(local_ghost_data[d].size() == local_ghost_buffer_size,
-           "ghost_data[" + std::to_string(d) +
-               "] input must be sized via quick_index.local_ghost_buffer_size");
-  }
-#ifdef C4_MPI // temporary work around until RMA is available in c4
-  // Use one sided MPI Put commands to fill up the ghost cell location data
-  std::vector<double> local_ghost_buffer(local_ghost_buffer_size, 0.0);
-  std::vector<double> put_buffer(max_put_buffer_size, 0.0);
-  MPI_Win win;
-  MPI_Win_create(local_ghost_buffer.data(), local_ghost_buffer_size * sizeof(double),
-                 sizeof(double), MPI_INFO_NULL, MPI_COMM_WORLD, &win);
-
-  // working from my local data put the ghost data on the other ranks
-  for (size_t d = 0; d < data_dim; d++) {
-    Check(local_data[d].size() == n_locations);
-    Remember(int errorcode =) MPI_Win_fence(MPI_MODE_NOSTORE, win);
-    Check(errorcode == MPI_SUCCESS);
-    for (auto &put : put_window_map) {
-      // use map.at() to allow const access
-      Check((coarse_index_map.at(put.first)).size() <= max_put_buffer_size);
-      // fill up the current ghost cell data for this dimension
-      int putIndex = 0;
-      for (auto &l : coarse_index_map.at(put.first)) {
-        put_buffer[putIndex] = local_data[d][l];
-        putIndex++;
-      }
-      put_lambda(put, put_buffer, putIndex, win, MPI_DOUBLE);
-    }
-    Remember(errorcode =)
-        MPI_Win_fence((MPI_MODE_NOSTORE | MPI_MODE_NOSUCCEED), // NOLINT [hicpp-signed-bitwise]
-                      win);
-    Check(errorcode == MPI_SUCCESS);
-    // alright move the position buffer to the final correct vector positions
-    int posIndex = 0;
-    for (auto &pos : local_ghost_buffer) {
-      local_ghost_data[d][posIndex] = pos;
-      posIndex++;
-    }
-  }
-  MPI_Win_free(&win);
-#endif
+  if (local_data.empty())
+    return;
+  ghost_request request;
+  begin_collect_ghost_data(local_data, request);
+  finish_collect_ghost_data(request, local_ghost_data);
 }
 
 //------------------------------------------------------------------------------------------------//
@@ -392,38 +535,9 @@ void quick_index::collect_ghost_data(const std::vector<std::vector<double>> &loc
  */
 void quick_index::collect_ghost_data(const std::vector<double> &local_data,
                                      std::vector<double> &local_ghost_data) const {
-  Require(local_data.size() == n_locations);
-  Insist(domain_decomposed, "Calling collect_ghost_data with a quick_index object that specified "
-                            "domain_decomposed=.false.");
-  Insist(local_ghost_data.size() == local_ghost_buffer_size,
-         "ghost_data input must be sized via quick_index.local_ghost_buffer_size");
-#ifdef C4_MPI // temporary work around until RMA is available in c4
-  std::vector<double> local_ghost_buffer(local_ghost_buffer_size, 0.0);
-  std::vector<double> put_buffer(max_put_buffer_size, 0.0);
-  MPI_Win win;
-  MPI_Win_create(local_ghost_data.data(), local_ghost_buffer_size * sizeof(double), sizeof(double),
-                 MPI_INFO_NULL, MPI_COMM_WORLD, &win);
-
-  // working from my local data put the ghost data on the other ranks
-  Remember(int errorcode =) MPI_Win_fence(MPI_MODE_NOSTORE, win);
-  Check(errorcode == MPI_SUCCESS);
-  for (auto put : put_window_map) {
-    // use map.at() to allow const access
-    Check((coarse_index_map.at(put.first)).size() <= max_put_buffer_size);
-    // fill up the current ghost cell data for this dimension
-    int putIndex = 0;
-    for (auto &l : coarse_index_map.at(put.first)) {
-      put_buffer[putIndex] = local_data[l];
-      putIndex++;
-    }
-    put_lambda(put, put_buffer, putIndex, win, MPI_DOUBLE);
-  }
-  Remember(errorcode =)
-      MPI_Win_fence((MPI_MODE_NOSTORE | MPI_MODE_NOSUCCEED), // NOLINT [hicpp-signed-bitwise]
-                    win);
-  Check(errorcode == MPI_SUCCESS);
-  MPI_Win_free(&win);
-#endif
+  ghost_request request;
+  begin_collect_ghost_data(local_data, request);
+  finish_collect_ghost_data(request, local_ghost_data);
 }
 
 //------------------------------------------------------------------------------------------------//
@@ -455,15 +569,14 @@ void quick_index::collect_ghost_data(const std::vector<int> &local_data,
   Remember(int errorcode =) MPI_Win_fence(MPI_MODE_NOSTORE, win);
   Check(errorcode == MPI_SUCCESS);
   for (auto put : put_window_map) {
-    // use map.at() to allow const access
-    Check((coarse_index_map.at(put.first)).size() <= max_put_buffer_size);
+    Check(coarse_bin(put.first).size() <= max_put_buffer_size);
     // fill up the current ghost cell data for this dimension
     int putIndex = 0;
-    for (auto &l : coarse_index_map.at(put.first)) {
+    for (auto &l : coarse_bin(put.first)) {
       put_buffer[putIndex] = local_data[l];
       putIndex++;
     }
-    put_lambda(put, put_buffer, putIndex, win, MPI_INT);
+    put_lambda(put, put_buffer.data(), putIndex, 1, win, MPI_INT);
   }
   Remember(errorcode =)
       MPI_Win_fence((MPI_MODE_NOSTORE | MPI_MODE_NOSUCCEED), // NOLINT [hicpp-signed-bitwise]
@@ -775,51 +888,43 @@ void quick_index::map_data_to_grid_window(
   double bias_cell_count = 0.0;
   // Loop over all possible bins
   for (auto &cb : global_bins) {
-    // * skip bins that aren't present in the map (can't use [] operator with constness)
-    // * loop over the local data
-    auto mapItr = coarse_index_map.find(cb);
-    if (mapItr != coarse_index_map.end()) {
-      for (auto &l : mapItr->second) {
+    // loop over the local data
+    for (auto &l : coarse_bin(cb)) {
+      bool valid;
+      size_t local_window_bin;
+      double distance_to_bin_center;
+      std::tie(valid, local_window_bin, distance_to_bin_center) = get_window_bin(
+          spherical, dim, grid_bins, locations[l], window_min, window_max, n_map_bins);
+
+      // If the bin is outside the window continue to the next poin
+      if (!valid)
+        continue;
+
+      // lambda for mapping the data
+      map_data(bias_cell_count, data_count, grid_data, min_distance, map_type, local_data,
+               distance_to_bin_center, local_window_bin, l);
+
+    } // end local point loop
+    if (domain_decomposed) {
+      // loop over the ghost data
+      for (auto &g : ghost_bin(cb)) {
         bool valid;
         size_t local_window_bin;
         double distance_to_bin_center;
-        std::tie(valid, local_window_bin, distance_to_bin_center) = get_window_bin(
-            spherical, dim, grid_bins, locations[l], window_min, window_max, n_map_bins);
+        std::tie(valid, local_window_bin, distance_to_bin_center) =
+            get_window_bin(spherical, dim, grid_bins, local_ghost_locations[g], window_min,
+                           window_max, n_map_bins);
 
         // If the bin is outside the window continue to the next poin
         if (!valid)
           continue;
 
         // lambda for mapping the data
-        map_data(bias_cell_count, data_count, grid_data, min_distance, map_type, local_data,
-                 distance_to_bin_center, local_window_bin, l);
-
-      } // end local point loop
-    }   // if valid local bin loop
-    if (domain_decomposed) {
-      // loop over the ghost data
-      auto gmapItr = local_ghost_index_map.find(cb);
-      if (gmapItr != local_ghost_index_map.end()) {
-        // loop over ghost data
-        for (auto &g : gmapItr->second) {
-          bool valid;
-          size_t local_window_bin;
-          double distance_to_bin_center;
-          std::tie(valid, local_window_bin, distance_to_bin_center) =
-              get_window_bin(spherical, dim, grid_bins, local_ghost_locations[g], window_min,
-                             window_max, n_map_bins);
-
-          // If the bin is outside the window continue to the next poin
-          if (!valid)
-            continue;
-
-          // lambda for mapping the data
-          map_data(bias_cell_count, data_count, grid_data, min_distance, map_type, ghost_data,
-                   distance_to_bin_center, local_window_bin, g);
-        } // end ghost point loop
-      }   // if valid ghost bin
-    }     // if dd
-  }       // end coarse bin loop
+        map_data(bias_cell_count, data_count, grid_data, min_distance, map_type, ghost_data,
+                 distance_to_bin_center, local_window_bin, g);
+      } // end ghost point loop
+    }   // if dd
+  }     // end coarse bin loop
 
   if (map_type == "ave" || map_type == "nearest") {
     for (size_t i = 0; i < n_map_bins; i++) {
@@ -1020,46 +1125,38 @@ void quick_index::map_data_to_grid_window(const std::vector<std::vector<double>>
   double bias_cell_count = 0.0;
   // Loop over all possible bins
   for (auto &cb : global_bins) {
-    // skip bins that aren't present in the map (can't use [] operator with constness)
     // loop over the local data
-    auto mapItr = coarse_index_map.find(cb);
-    if (mapItr != coarse_index_map.end()) {
-      for (auto &l : mapItr->second) {
+    for (auto &l : coarse_bin(cb)) {
+      bool valid;
+      size_t local_window_bin;
+      double distance_to_bin_center;
+      std::tie(valid, local_window_bin, distance_to_bin_center) = get_window_bin(
+          spherical, dim, grid_bins, locations[l], window_min, window_max, n_map_bins);
+      // If the bin is outside the window continue to the next poin
+      if (!valid)
+        continue;
+      Check(local_window_bin < n_map_bins);
+      map_vector_data(bias_cell_count, data_count, grid_data, min_distance, map_type, local_data,
+                      distance_to_bin_center, local_window_bin, l, vsize);
+    } // end local point loop
+    if (domain_decomposed) {
+      // loop over the ghost data
+      for (auto &g : ghost_bin(cb)) {
         bool valid;
         size_t local_window_bin;
         double distance_to_bin_center;
-        std::tie(valid, local_window_bin, distance_to_bin_center) = get_window_bin(
-            spherical, dim, grid_bins, locations[l], window_min, window_max, n_map_bins);
+        std::tie(valid, local_window_bin, distance_to_bin_center) =
+            get_window_bin(spherical, dim, grid_bins, local_ghost_locations[g], window_min,
+                           window_max, n_map_bins);
+
         // If the bin is outside the window continue to the next poin
         if (!valid)
           continue;
-        Check(local_window_bin < n_map_bins);
-        map_vector_data(bias_cell_count, data_count, grid_data, min_distance, map_type, local_data,
-                        distance_to_bin_center, local_window_bin, l, vsize);
-      } // end local point loop
-    }   // if valid local bin loop
-    if (domain_decomposed) {
-      // loop over the ghost data
-      auto gmapItr = local_ghost_index_map.find(cb);
-      if (gmapItr != local_ghost_index_map.end()) {
-        // loop over ghost data
-        for (auto &g : gmapItr->second) {
-          bool valid;
-          size_t local_window_bin;
-          double distance_to_bin_center;
-          std::tie(valid, local_window_bin, distance_to_bin_center) =
-              get_window_bin(spherical, dim, grid_bins, local_ghost_locations[g], window_min,
-                             window_max, n_map_bins);
-
-          // If the bin is outside the window continue to the next poin
-          if (!valid)
-            continue;
-          map_vector_data(bias_cell_count, data_count, grid_data, min_distance, map_type,
-                          ghost_data, distance_to_bin_center, local_window_bin, g, vsize);
-        } // end ghost point loop
-      }   // if valid ghost bin
-    }     // if dd
-  }       // end coarse bin loop
+        map_vector_data(bias_cell_count, data_count, grid_data, min_distance, map_type,
+                        ghost_data, distance_to_bin_center, local_window_bin, g, vsize);
+      } // end ghost point loop
+    }   // if dd
+  }     // end coarse bin loop
 
   if (map_type == "ave" || map_type == "nearest") {
     for (size_t i = 0; i < n_map_bins; i++) {
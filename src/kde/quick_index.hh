@@ -12,6 +12,7 @@
 #define rtt_kde_quick_index_hh
 
 #include "c4/global.hh"
+#include "ds++/Slice.hh"
 #include "units/MathConstants.hh"
 #include <array>
 #include <cmath>
@@ -55,6 +56,45 @@ transform_spherical(const size_t dim, const std::array<double, 3> &sphere_center
 
 class quick_index {
 public:
+  //! Contiguous view of the point indices stored in a single coarse bin
+  using bin_view = rtt_dsxx::Slice<std::vector<size_t>::const_iterator>;
+
+  //==============================================================================================//
+  /*!
+   * \brief State of a split-phase ghost data exchange
+   *
+   * Filled by begin_collect_ghost_data and consumed by finish_collect_ghost_data. The request owns
+   * the RMA window and both the packed put (origin) data and the ghost (target) buffer, so the
+   * caller's data may be modified as soon as begin_collect_ghost_data returns. Every rank must call
+   * finish_collect_ghost_data on each request it began (the window fences are collective). A request
+   * that is destroyed while still active closes its epoch and frees the window, which is also
+   * collective, so all ranks must drop it together.
+   */
+  //==============================================================================================//
+  class ghost_request {
+  public:
+    ghost_request() = default;
+    ghost_request(const ghost_request &) = delete;
+    ghost_request &operator=(const ghost_request &) = delete;
+    ~ghost_request();
+
+    //! True between begin_collect_ghost_data and finish_collect_ghost_data
+    bool active() const { return is_active; }
+
+  private:
+    friend class quick_index;
+    bool is_active{false};
+    // number of values stored per ghost location
+    size_t n_fields{0};
+    // ghost buffer laid out [ghost_index][field]
+    std::vector<double> ghost_buffer;
+    // packed local data laid out [put bin][point][field]
+    std::vector<double> put_buffer;
+#ifdef C4_MPI
+    MPI_Win win{MPI_WIN_NULL};
+#endif
+  };
+
   //! cartsian constructor
   quick_index(const size_t dim, const std::vector<std::array<double, 3>> &locations,
               const double max_window_size, const size_t bins_per_dimension,
@@ -77,6 +117,28 @@ public:
   void collect_ghost_data(const std::vector<std::vector<double>> &local_data,
                           std::vector<std::vector<double>> &local_ghost_data) const;
 
+  //! Start a split-phase ghost data exchange
+  void begin_collect_ghost_data(const std::vector<double> &local_data,
+                                ghost_request &request) const;
+
+  //! Start a split-phase ghost data exchange of several fields in a single put epoch
+  void begin_collect_ghost_data(const std::vector<std::vector<double>> &local_data,
+                                ghost_request &request) const;
+
+  //! Complete a split-phase ghost data exchange
+  void finish_collect_ghost_data(ghost_request &request,
+                                 std::vector<double> &local_ghost_data) const;
+
+  //! Complete a split-phase ghost data exchange of several fields
+  void finish_collect_ghost_data(ghost_request &request,
+                                 std::vector<std::vector<double>> &local_ghost_data) const;
+
+  //! Local point indices in a coarse bin (flat CSR lookup)
+  inline bin_view coarse_bin(const size_t bin) const;
+
+  //! Local ghost buffer indices in a coarse bin (flat CSR lookup)
+  inline bin_view ghost_bin(const size_t bin) const;
+
   //! Fetch list of coarse index values bound by the window
   std::vector<size_t> window_coarse_index_list(const std::array<double, 3> &window_min,
                                                const std::array<double, 3> &window_max) const;
@@ -116,7 +178,14 @@ public:
   // Global bounds
   std::array<double, 3> bounding_box_min{0.0};
   std::array<double, 3> bounding_box_max{0.0};
+  // Total number of global coarse bins (coarse_bin_resolution^dim)
+  size_t n_coarse_bins;
+  // Local data bins (CSR). The local points in global bin b are
+  // coarse_bin_indices[coarse_bin_offsets[b]:coarse_bin_offsets[b+1]] (sized n_coarse_bins+1)
+  std::vector<size_t> coarse_bin_offsets;
+  std::vector<size_t> coarse_bin_indices;
   // Local Data map
+  // \deprecated Map copies of the CSR bins kept for existing callers; use coarse_bin().
   std::map<size_t, std::vector<size_t>> coarse_index_map;
   std::map<size_t, std::array<double, 3>> coarse_index_center;
   std::map<size_t, std::array<double, 3>> coarse_index_size;
@@ -129,12 +198,25 @@ public:
   std::vector<size_t> local_bins;
   // Size of ghost data buffer
   size_t local_ghost_buffer_size;
+  // Ghost buffer indices of each global bin (CSR, empty offsets if not domain decomposed)
+  std::vector<size_t> ghost_bin_offsets;
+  std::vector<size_t> ghost_bin_indices;
   // Map used to index into a local ghost buffer
+  // \deprecated Map copy of the ghost CSR bins kept for existing callers; use ghost_bin().
   std::map<size_t, std::vector<size_t>> local_ghost_index_map;
   // Local ghost locations (build at construction time)
   std::vector<std::array<double, 3>> local_ghost_locations;
 
 private:
+  // PRIVATE FUNCTIONS
+  //! Pack n_fields values per local point and issue the puts of a split-phase exchange
+  template <typename Packer>
+  void begin_packed_ghost_put(const size_t n_fields, const Packer &pack,
+                              ghost_request &request) const;
+
+  //! Close the put epoch of a split-phase exchange
+  void wait_ghost_put(ghost_request &request) const;
+
   // PRIVATE DATA
   // Map used to write local data to other processor ghost cells
   // put_window_map[global_id] = [put_rank, ghost_proc_buffer_size, ghost_proc_put_offset]
@@ -145,6 +227,41 @@ private:
   double max_window_size;
 };
 
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Local point indices stored in a coarse bin.
+ *
+ * Constant time lookup into the CSR bin layout. Empty bins return an empty view.
+ *
+ * \param[in] bin global coarse bin index
+ * \return contiguous view of the local point indices in this bin
+ */
+inline quick_index::bin_view quick_index::coarse_bin(const size_t bin) const {
+  Require(bin < n_coarse_bins);
+  Check(coarse_bin_offsets.size() == n_coarse_bins + 1);
+  return bin_view(coarse_bin_indices.begin() +
+                      static_cast<std::ptrdiff_t>(coarse_bin_offsets[bin]),
+                  coarse_bin_offsets[bin + 1] - coarse_bin_offsets[bin]);
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Local ghost buffer indices stored in a coarse bin.
+ *
+ * Constant time lookup into the CSR ghost bin layout. Empty bins (and every bin of a quick_index
+ * that is not domain decomposed) return an empty view.
+ *
+ * \param[in] bin global coarse bin index
+ * \return contiguous view of the ghost buffer indices in this bin
+ */
+inline quick_index::bin_view quick_index::ghost_bin(const size_t bin) const {
+  Require(bin < n_coarse_bins);
+  if (ghost_bin_offsets.empty())
+    return bin_view(ghost_bin_indices.begin(), 0);
+  return bin_view(ghost_bin_indices.begin() + static_cast<std::ptrdiff_t>(ghost_bin_offsets[bin]),
+                  ghost_bin_offsets[bin + 1] - ghost_bin_offsets[bin]);
+}
+
 } // end namespace  rtt_kde
 
 #endif // rtt_kde_quick_index_hh
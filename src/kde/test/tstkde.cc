@@ -2843,6 +2843,66 @@ void test_decomposition(ParallelUnitTest &ut) { // NOLINT [hicpp-function-size]
   }
 }
 
+//------------------------------------------------------------------------------------------------//
+void test_multi_field(ParallelUnitTest &ut) {
+  const bool dd = rtt_c4::nodes() > 1;
+  // each rank owns a strip of a uniform 2D grid
+  const size_t n_x = 8;
+  const size_t n_y = 10;
+  const size_t local_size = n_x * n_y;
+  const double dx = 1.0 / static_cast<double>(n_x * rtt_c4::nodes());
+  const double dy = 1.0 / static_cast<double>(n_y);
+  const double x_offset = static_cast<double>(n_x * rtt_c4::node()) * dx;
+  const size_t n_fields = 3;
+
+  std::vector<std::array<double, 3>> position_array(local_size, {0.0, 0.0, 0.0});
+  std::vector<std::vector<double>> fields(n_fields, std::vector<double>(local_size, 0.0));
+  std::vector<double> bandwidth_weights(local_size, 1.0);
+  std::vector<int> reconstruction_mask(local_size, 1);
+  for (size_t i = 0; i < n_x; i++) {
+    for (size_t j = 0; j < n_y; j++) {
+      const size_t p = i * n_y + j;
+      position_array[p][0] = x_offset + (static_cast<double>(i) + 0.5) * dx;
+      position_array[p][1] = (static_cast<double>(j) + 0.5) * dy;
+      fields[0][p] = 1.0;
+      fields[1][p] = position_array[p][0] + 2.0 * position_array[p][1];
+      fields[2][p] = static_cast<double>(p % 7);
+      bandwidth_weights[p] = 1.0 + 0.5 * static_cast<double>(j % 2);
+      reconstruction_mask[p] = j == 0 ? 0 : 1;
+    }
+  }
+  const std::vector<std::array<double, 3>> one_over_bandwidth(local_size, {4.0, 4.0, 0.0});
+  quick_index qindex(2, position_array, 0.5, 10, dd);
+  kde test_kde;
+
+  const std::vector<std::vector<double>> multi_result =
+      test_kde.reconstruction(fields, reconstruction_mask, one_over_bandwidth, qindex);
+  const std::vector<std::vector<double>> multi_weighted = test_kde.weighted_reconstruction(
+      fields, bandwidth_weights, reconstruction_mask, one_over_bandwidth, qindex);
+  FAIL_IF_NOT(multi_result.size() == n_fields);
+  FAIL_IF_NOT(multi_weighted.size() == n_fields);
+  // each field must match its single field reconstruction exactly
+  for (size_t f = 0; f < n_fields; f++) {
+    if (multi_result[f] !=
+        test_kde.reconstruction(fields[f], reconstruction_mask, one_over_bandwidth, qindex))
+      ITFAILS;
+    if (multi_weighted[f] != test_kde.weighted_reconstruction(fields[f], bandwidth_weights,
+                                                              reconstruction_mask,
+                                                              one_over_bandwidth, qindex))
+      ITFAILS;
+  }
+  // a constant field stays constant
+  for (size_t p = 0; p < local_size; p++)
+    if (!rtt_dsxx::soft_equiv(multi_result[0][p], 1.0))
+      ITFAILS;
+
+  if (ut.numFails == 0) {
+    PASSMSG("KDE multi-field checks pass");
+  } else {
+    FAILMSG("KDE multi-field checks failed");
+  }
+}
+
 //------------------------------------------------------------------------------------------------//
 int main(int argc, char *argv[]) {
   ParallelUnitTest ut(argc, argv, release);
@@ -2851,6 +2911,7 @@ int main(int argc, char *argv[]) {
     test_replication(ut);
     if (nodes() == 3)
       test_decomposition(ut);
+    test_multi_field(ut);
   }
   UT_EPILOG(ut);
 }
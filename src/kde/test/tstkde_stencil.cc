@@ -0,0 +1,126 @@
+//--------------------------------------------*-C++-*---------------------------------------------//
+/*!
+ * \file   kde/test/tstkde_stencil.cc
+ * \author agent
+ * \date   Oct. 16th 2026
+ * \brief  kde_stencil tests and repeated reconstruction benchmark
+ * \note   Copyright (C) 2026 Triad National Security, LLC., All rights reserved. */
+//------------------------------------------------------------------------------------------------//
+
+#include "kde/kde_stencil.hh"
+#include "c4/ParallelUnitTest.hh"
+#include "c4/Timer.hh"
+#include "ds++/Release.hh"
+#include <iomanip>
+
+using namespace rtt_dsxx;
+using namespace rtt_c4;
+using namespace rtt_kde;
+
+//------------------------------------------------------------------------------------------------//
+// TESTS
+//------------------------------------------------------------------------------------------------//
+void test_stencil(ParallelUnitTest &ut) {
+  const bool dd = rtt_c4::nodes() > 1;
+  // each rank owns a strip of a uniform 2D grid
+  const size_t n_x = 12;
+  const size_t n_y = 20;
+  const size_t local_size = n_x * n_y;
+  const double dx = 1.0 / static_cast<double>(n_x * rtt_c4::nodes());
+  const double dy = 1.0 / static_cast<double>(n_y);
+  const double x_offset = static_cast<double>(n_x * rtt_c4::node()) * dx;
+
+  std::vector<std::array<double, 3>> position_array(local_size, {0.0, 0.0, 0.0});
+  std::vector<double> data(local_size, 0.0);
+  std::vector<double> bandwidth_weights(local_size, 1.0);
+  std::vector<int> reconstruction_mask(local_size, 1);
+  for (size_t i = 0; i < n_x; i++) {
+    for (size_t j = 0; j < n_y; j++) {
+      const size_t p = i * n_y + j;
+      position_array[p][0] = x_offset + (static_cast<double>(i) + 0.5) * dx;
+      position_array[p][1] = (static_cast<double>(j) + 0.5) * dy;
+      data[p] = 1.0 + position_array[p][0] * position_array[p][1] + static_cast<double>(p % 5);
+      bandwidth_weights[p] = 1.0 + 0.25 * static_cast<double>(i % 3);
+      reconstruction_mask[p] = j < 2 ? 0 : 1 + static_cast<int>(j % 2);
+    }
+  }
+  const std::vector<std::array<double, 3>> one_over_bandwidth(local_size, {8.0, 8.0, 0.0});
+  quick_index qindex(2, position_array, 0.25, 10, dd);
+  kde test_kde;
+
+  // unweighted stencil
+  {
+    kde_stencil stencil(test_kde, qindex, reconstruction_mask, one_over_bandwidth);
+    FAIL_IF_NOT(stencil.size() == local_size);
+    FAIL_IF_NOT(stencil.n_entries() >= local_size);
+    const std::vector<double> gold =
+        test_kde.reconstruction(data, reconstruction_mask, one_over_bandwidth, qindex);
+    if (stencil.apply(data, qindex) != gold)
+      ITFAILS;
+
+    // the same stencil is valid for any data on the same points
+    std::vector<double> new_data(local_size);
+    for (size_t p = 0; p < local_size; p++)
+      new_data[p] = 2.0 * data[p] - position_array[p][1];
+    const std::vector<std::vector<double>> multi =
+        stencil.apply(std::vector<std::vector<double>>{data, new_data}, qindex);
+    if (multi[0] != gold)
+      ITFAILS;
+    if (multi[1] !=
+        test_kde.reconstruction(new_data, reconstruction_mask, one_over_bandwidth, qindex))
+      ITFAILS;
+  }
+
+  // weighted stencil
+  {
+    kde_stencil stencil(test_kde, qindex, reconstruction_mask, one_over_bandwidth, 1.0,
+                        bandwidth_weights);
+    if (stencil.apply(data, qindex) !=
+        test_kde.weighted_reconstruction(data, bandwidth_weights, reconstruction_mask,
+                                         one_over_bandwidth, qindex))
+      ITFAILS;
+  }
+
+  // benchmark repeated reconstructions on the static point set
+  {
+    const size_t n_steps = 10;
+    Timer direct_timer;
+    direct_timer.start();
+    for (size_t s = 0; s < n_steps; s++)
+      test_kde.reconstruction(data, reconstruction_mask, one_over_bandwidth, qindex);
+    direct_timer.stop();
+
+    Timer stencil_timer;
+    stencil_timer.start();
+    kde_stencil stencil(test_kde, qindex, reconstruction_mask, one_over_bandwidth);
+    for (size_t s = 0; s < n_steps; s++)
+      stencil.apply(data, qindex);
+    stencil_timer.stop();
+
+    if (rtt_c4::node() == 0)
+      std::cout << std::setprecision(4) << "\n" << n_steps << " reconstructions of " << local_size
+                << " points per rank:\n  kde::reconstruction : " << direct_timer.wall_clock()
+                << " s\n  kde_stencil (+build): " << stencil_timer.wall_clock() << " s\n"
+                << std::endl;
+  }
+
+  if (ut.numFails == 0) {
+    PASSMSG("kde_stencil checks pass");
+  } else {
+    FAILMSG("kde_stencil checks failed");
+  }
+}
+
+//------------------------------------------------------------------------------------------------//
+int main(int argc, char *argv[]) {
+  ParallelUnitTest ut(argc, argv, release);
+  try {
+    // >>> UNIT TESTS
+    test_stencil(ut);
+  }
+  UT_EPILOG(ut);
+}
+
+//------------------------------------------------------------------------------------------------//
+// end of tstkde_stencil.cc
+//------------------------------------------------------------------------------------------------//
@@ -0,0 +1,164 @@
+//--------------------------------------------*-C++-*---------------------------------------------//
+/*!
+ * \file   kde/test/tstkde_threads.cc
+ * \author agent
+ * \date   Oct. 16th 2026
+ * \brief  Threaded KDE reconstruction tests and scaling benchmark
+ * \note   Copyright (C) 2026 Triad National Security, LLC., All rights reserved. */
+//------------------------------------------------------------------------------------------------//
+
+#include "kde/kde.hh"
+#include "kde/quick_index.hh"
+#include "c4/ParallelUnitTest.hh"
+#include "c4/Timer.hh"
+#include "c4/c4_omp.h"
+#include "ds++/Release.hh"
+#include <iomanip>
+
+using namespace rtt_dsxx;
+using namespace rtt_c4;
+using namespace rtt_kde;
+
+//------------------------------------------------------------------------------------------------//
+// TESTS
+//------------------------------------------------------------------------------------------------//
+//! Check that the threaded reconstructions are bitwise identical to the serial ones and report
+//! the wall clock scaling.
+void test_threaded_reconstruction(ParallelUnitTest &ut) {
+  const bool dd = rtt_c4::nodes() > 1;
+  // each rank owns a (n_x x n_y) slab of a uniform 2D grid
+  const size_t n_x = 30;
+  const size_t n_y = 30;
+  const size_t local_size = n_x * n_y;
+  const double dx = 1.0 / static_cast<double>(n_x * rtt_c4::nodes());
+  const double dy = 1.0 / static_cast<double>(n_y);
+  const double x_offset = static_cast<double>(n_x * rtt_c4::node()) * dx;
+
+  std::vector<std::array<double, 3>> position_array(local_size, {0.0, 0.0, 0.0});
+  std::vector<double> data(local_size, 0.0);
+  std::vector<double> bandwidth_weights(local_size, 1.0);
+  std::vector<int> reconstruction_mask(local_size, 1);
+  for (size_t i = 0; i < n_x; i++) {
+    for (size_t j = 0; j < n_y; j++) {
+      const size_t p = i * n_y + j;
+      position_array[p][0] = x_offset + (static_cast<double>(i) + 0.5) * dx;
+      position_array[p][1] = (static_cast<double>(j) + 0.5) * dy;
+      data[p] = 2.0 + sin(10.0 * position_array[p][0]) * cos(7.0 * position_array[p][1]);
+      bandwidth_weights[p] = 1.0 + 0.1 * static_cast<double>(p % 3);
+      // leave a masked stripe to exercise the skip path
+      reconstruction_mask[p] = j < 2 ? 0 : 1 + static_cast<int>(i % 2);
+    }
+  }
+  const std::vector<std::array<double, 3>> one_over_bandwidth(local_size, {20.0, 20.0, 0.0});
+
+  const size_t dim = 2;
+  const double max_window_size = 0.1;
+  const size_t n_coarse_bins = 20;
+  quick_index qindex(dim, position_array, max_window_size, n_coarse_bins, dd);
+
+  const int max_threads = rtt_c4::get_omp_max_threads();
+  kde serial_kde;
+  kde threaded_kde({false, false, false, false, false, false}, max_threads);
+
+  Timer serial_timer;
+  serial_timer.start();
+  const std::vector<double> serial_result =
+      serial_kde.reconstruction(data, reconstruction_mask, one_over_bandwidth, qindex);
+  const std::vector<double> serial_weighted = serial_kde.weighted_reconstruction(
+      data, bandwidth_weights, reconstruction_mask, one_over_bandwidth, qindex);
+  const std::vector<double> serial_log =
+      serial_kde.log_reconstruction(data, reconstruction_mask, one_over_bandwidth, qindex);
+  const std::vector<double> serial_sampled =
+      serial_kde.sampled_reconstruction(data, reconstruction_mask, one_over_bandwidth, qindex);
+  serial_timer.stop();
+
+  Timer threaded_timer;
+  threaded_timer.start();
+  const std::vector<double> threaded_result =
+      threaded_kde.reconstruction(data, reconstruction_mask, one_over_bandwidth, qindex);
+  const std::vector<double> threaded_weighted = threaded_kde.weighted_reconstruction(
+      data, bandwidth_weights, reconstruction_mask, one_over_bandwidth, qindex);
+  const std::vector<double> threaded_log =
+      threaded_kde.log_reconstruction(data, reconstruction_mask, one_over_bandwidth, qindex);
+  const std::vector<double> threaded_sampled =
+      threaded_kde.sampled_reconstruction(data, reconstruction_mask, one_over_bandwidth, qindex);
+  threaded_timer.stop();
+
+  // the point loop is the only thing threaded, so the results must match bit for bit
+  if (serial_result != threaded_result)
+    ITFAILS;
+  if (serial_weighted != threaded_weighted)
+    ITFAILS;
+  if (serial_log != threaded_log)
+    ITFAILS;
+  if (serial_sampled != threaded_sampled)
+    ITFAILS;
+
+  // masked points are passed through untouched
+  for (size_t p = 0; p < local_size; p++)
+    if (reconstruction_mask[p] == 0 && !rtt_dsxx::soft_equiv(threaded_result[p], data[p]))
+      ITFAILS;
+
+  if (rtt_c4::node() == 0) {
+    const double speedup = serial_timer.wall_clock() / std::max(threaded_timer.wall_clock(), 1e-12);
+    std::cout << std::setprecision(4) << "\nKDE reconstruction of " << local_size
+              << " points per rank:\n  1 thread   : " << serial_timer.wall_clock()
+              << " s\n  " << max_threads << " thread(s): " << threaded_timer.wall_clock()
+              << " s\n  speedup    : " << speedup << "\n"
+              << std::endl;
+  }
+
+  if (ut.numFails == 0) {
+    PASSMSG("KDE threaded reconstruction checks pass");
+  } else {
+    FAILMSG("KDE threaded reconstruction checks failed");
+  }
+}
+
+//------------------------------------------------------------------------------------------------//
+//! Check that a DBC failure inside a threaded loop reaches the caller as an rtt_dsxx::assertion.
+void test_threaded_dbc_failure(ParallelUnitTest &ut) {
+#if DBC & 1
+  const size_t local_size = 200;
+  std::vector<std::array<double, 3>> position_array(local_size, {0.0, 0.0, 0.0});
+  for (size_t p = 0; p < local_size; p++) {
+    position_array[p][0] = (static_cast<double>(p % 20) + 0.5) / 20.0;
+    position_array[p][1] = (static_cast<double>(p / 20) + 0.5) / 10.0;
+  }
+  const std::vector<double> data(local_size, 1.0);
+  const std::vector<int> reconstruction_mask(local_size, 1);
+  // a zero bandwidth breaks the precondition of the window calculation for that one point
+  std::vector<std::array<double, 3>> one_over_bandwidth(local_size, {10.0, 10.0, 0.0});
+  one_over_bandwidth[local_size / 2] = {0.0, 10.0, 0.0};
+
+  quick_index qindex(2, position_array, 0.2, 10, rtt_c4::nodes() > 1);
+  kde threaded_kde({false, false, false, false, false, false}, rtt_c4::get_omp_max_threads());
+  bool caught = false;
+  try {
+    threaded_kde.reconstruction(data, reconstruction_mask, one_over_bandwidth, qindex);
+  } catch (rtt_dsxx::assertion & /*error*/) {
+    caught = true;
+  }
+  FAIL_IF_NOT(caught);
+
+  if (ut.numFails == 0)
+    PASSMSG("KDE threaded DBC failure is rethrown to the caller");
+#else
+  PASSMSG("KDE threaded DBC failure test requires DBC preconditions");
+#endif
+}
+
+//------------------------------------------------------------------------------------------------//
+int main(int argc, char *argv[]) {
+  ParallelUnitTest ut(argc, argv, release);
+  try {
+    // >>> UNIT TESTS
+    test_threaded_reconstruction(ut);
+    test_threaded_dbc_failure(ut);
+  }
+  UT_EPILOG(ut);
+}
+
+//------------------------------------------------------------------------------------------------//
+// end of tstkde_threads.cc
+//------------------------------------------------------------------------------------------------//
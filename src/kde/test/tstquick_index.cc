@@ -73,6 +73,20 @@ void test_replication(ParallelUnitTest &ut) { // NOLINT [hicpp-function-size]
       for (size_t i = 0; i < map.second.size(); i++)
         if (gold_map[map.first][i] != map.second[i])
           ITFAILS;
+    // Check the flat CSR bin lookup against the gold map (including empty bins)
+    if (qindex.n_coarse_bins != bins_per_dim)
+      ITFAILS;
+    for (size_t bin = 0; bin < qindex.n_coarse_bins; bin++) {
+      const auto bin_points = qindex.coarse_bin(bin);
+      const std::vector<size_t> gold_points =
+          gold_map.count(bin) > 0 ? gold_map[bin] : std::vector<size_t>();
+      if (bin_points.size() != gold_points.size())
+        ITFAILS;
+      if (!std::equal(bin_points.begin(), bin_points.end(), gold_points.begin()))
+        ITFAILS;
+      if (!qindex.ghost_bin(bin).empty())
+        ITFAILS;
+    }
 
     // Check non-spherical orthogonal distance calculation
     auto distance = qindex.calc_orthogonal_distance({-1, -1, -1}, {1, 1, 1});
@@ -332,6 +346,17 @@ void test_decomposition(ParallelUnitTest &ut) { // NOLINT [hicpp-function-size]
           ITFAILS;
       }
     }
+    // Check the flat CSR ghost bin lookup against the gold map
+    for (size_t bin = 0; bin < qindex.n_coarse_bins; bin++) {
+      const auto bin_ghosts = qindex.ghost_bin(bin);
+      const std::vector<size_t> gold_ghosts = gold_ghost_index_map.count(bin) > 0
+                                                  ? gold_ghost_index_map[bin]
+                                                  : std::vector<size_t>();
+      if (bin_ghosts.size() != gold_ghosts.size())
+        ITFAILS;
+      if (!std::equal(bin_ghosts.begin(), bin_ghosts.end(), gold_ghosts.begin()))
+        ITFAILS;
+    }
 
     // Check the local ghost locations (this tangentially checks the private
     // put_window_map which is used to build this local data).
@@ -401,6 +426,40 @@ void test_decomposition(ParallelUnitTest &ut) { // NOLINT [hicpp-function-size]
       if (!rtt_dsxx::soft_equiv(ghost_3x_data[2][i], gold_3x_ghost_data[2][i]))
         ITFAILS;
 
+    // Check the split-phase exchange (single field and all fields in one put epoch)
+    {
+      quick_index::ghost_request request;
+      FAIL_IF(request.active());
+      qindex.begin_collect_ghost_data(dd_data, request);
+      FAIL_IF_NOT(request.active());
+      std::vector<double> split_ghost_data(qindex.local_ghost_buffer_size, 0.0);
+      qindex.finish_collect_ghost_data(request, split_ghost_data);
+      FAIL_IF(request.active());
+      if (split_ghost_data != ghost_data)
+        ITFAILS;
+
+      // the request can be reused for a multi-field exchange
+      std::vector<std::vector<double>> split_3x_data(
+          3, std::vector<double>(qindex.local_ghost_buffer_size, 0.0));
+      qindex.begin_collect_ghost_data(dd_3x_data, request);
+      qindex.finish_collect_ghost_data(request, split_3x_data);
+      if (split_3x_data != ghost_3x_data)
+        ITFAILS;
+    }
+
+    // Dropping an active request must close its epoch so later exchanges still work
+    {
+      {
+        quick_index::ghost_request dropped;
+        qindex.begin_collect_ghost_data(dd_data, dropped);
+        FAIL_IF_NOT(dropped.active());
+      }
+      std::vector<double> after_drop_ghost_data(qindex.local_ghost_buffer_size, 0.0);
+      qindex.collect_ghost_data(dd_data, after_drop_ghost_data);
+      if (after_drop_ghost_data != ghost_data)
+        ITFAILS;
+    }
+
     // check max window mapping (more bins then data) functions
     {
       // build a length=1.0 window around the first point on each node
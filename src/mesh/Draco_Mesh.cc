@@ -9,9 +9,11 @@
 
 #include "Draco_Mesh.hh"
 #include "c4/C4_Functions.hh"
+#include "c4/c4_omp.h"
 #include "c4/gatherv.hh"
 #include "ds++/Assert.hh"
 #include <algorithm>
+#include <exception>
 #include <numeric>
 
 namespace rtt_mesh {
@@ -22,6 +24,9 @@ unsigned safe_convert_from_size_t(size_t const in_) {
   return static_cast<unsigned>(in_);
 }
 
+// marks a serial cell face with no cell, side or ghost cell across it in a layout
+constexpr unsigned no_face_index = UINT_MAX;
+
 //------------------------------------------------------------------------------------------------//
 // CONSTRUCTOR
 //------------------------------------------------------------------------------------------------//
@@ -49,6 +54,8 @@ unsigned safe_convert_from_size_t(size_t const in_) {
  *               local index of ghost nodes.
  * \param[in] ghost_cell_number_ cell index local to other processor.
  * \param[in] ghost_cell_rank_ rank of each ghost cell.
+ * \param[in] n_threads_ number of OpenMP threads used to build the layouts; the mesh is the same
+ *               for any value.
  */
 Draco_Mesh::Draco_Mesh(
     unsigned dimension_, Geometry geometry_, const std::vector<unsigned> &num_faces_per_cell_,
@@ -59,19 +66,20 @@ Draco_Mesh::Draco_Mesh(
     const std::vector<unsigned> &num_nodes_per_face_per_cell_,
     const std::vector<unsigned> &ghost_cell_type_,
     const std::vector<unsigned> &ghost_cell_to_node_linkage_,
-    const std::vector<int> &ghost_cell_number_, const std::vector<int> &ghost_cell_rank_)
+    const std::vector<int> &ghost_cell_number_, const std::vector<int> &ghost_cell_rank_,
+    const int n_threads_)
     : dimension(dimension_), geometry(geometry_),
       num_cells(safe_convert_from_size_t(num_faces_per_cell_.size())),
       num_nodes(safe_convert_from_size_t(global_node_number_.size())),
       side_set_flag(std::move(side_set_flag_)), ghost_cell_number(ghost_cell_number_),
-      ghost_cell_rank(ghost_cell_rank_), node_coord_vec(compute_node_coord_vec(coordinates_)),
+      ghost_cell_rank(ghost_cell_rank_), node_coords(coordinates_),
       m_num_faces_per_cell(num_faces_per_cell_),
       m_num_nodes_per_face_per_cell(num_nodes_per_face_per_cell_),
-      m_cell_to_node_linkage(compute_cell_to_node_tensor(
-          num_faces_per_cell_, num_nodes_per_face_per_cell_, cell_to_node_linkage_)),
-      m_side_node_count(side_node_count_), m_side_to_node_linkage(side_to_node_linkage_) {
+      m_cell_to_node_linkage(cell_to_node_linkage_), m_side_node_count(side_node_count_),
+      m_side_to_node_linkage(side_to_node_linkage_) {
 
   Require(dimension_ <= 3);
+  Require(n_threads_ > 0);
   Require(side_to_node_linkage_.size() ==
           std::accumulate(side_node_count_.begin(), side_node_count_.end(), 0U));
   Require(coordinates_.size() == dimension_ * global_node_number_.size());
@@ -82,15 +90,18 @@ Draco_Mesh::Draco_Mesh(
   Require(ghost_cell_to_node_linkage_.size() ==
           std::accumulate(ghost_cell_type_.begin(), ghost_cell_type_.end(), 0U));
 
+  // index the cell-node linkage by cell and face
+  compute_cell_to_node_offsets();
+
   // build the layout using face types (number of nodes per face per cell)
   compute_cell_to_cell_linkage(
       num_faces_per_cell_, cell_to_node_linkage_, num_nodes_per_face_per_cell_, side_node_count_,
-      side_to_node_linkage_, ghost_cell_type_, ghost_cell_to_node_linkage_);
+      side_to_node_linkage_, ghost_cell_type_, ghost_cell_to_node_linkage_, n_threads_);
 
   // build cell-to-corner-cell layout (\todo: extend to 3D)
   if (dimension_ == 2) {
-    compute_node_to_cell_linkage(ghost_cell_type_, ghost_cell_to_node_linkage_,
-                                 global_node_number_);
+    compute_node_to_cell_linkage(ghost_cell_type_, ghost_cell_to_node_linkage_, global_node_number_,
+                                 n_threads_);
   }
 }
 
@@ -112,7 +123,7 @@ const std::vector<unsigned> Draco_Mesh::get_cell_nodes(const unsigned cell) cons
 
   for (unsigned face = 0; face < m_num_faces_per_cell[cell]; ++face) {
 
-    for (auto node : m_cell_to_node_linkage[cell][face]) {
+    for (auto node : get_cell_face_nodes(cell, face)) {
 
       // this preserves counter-clockwise ordering in 2D
       if (std::find(ret_cell_nodes.begin(), ret_cell_nodes.end(), node) == ret_cell_nodes.end())
@@ -126,31 +137,96 @@ const std::vector<unsigned> Draco_Mesh::get_cell_nodes(const unsigned cell) cons
 
 //------------------------------------------------------------------------------------------------//
 /*!
- * \brief Return a flattended version of the cell-node tensor
+ * \brief Build the vector of node coordinate vectors.
  *
- * \return a flattened cell-node linkage vector
+ * \return a vector of vectors of size=dimension of coordinates, subscripted by node.
  */
-const std::vector<unsigned> Draco_Mesh::get_flat_cell_node_linkage() const {
+std::vector<std::vector<double>> Draco_Mesh::get_node_coord_vec() const {
 
-  // initialize empty cell-node vector
-  std::vector<unsigned> ret_flat_cell_node;
+  std::vector<std::vector<double>> ret_node_coord_vec(num_nodes);
+  auto ncv_first = node_coords.begin();
+  for (unsigned node = 0; node < num_nodes; ++node) {
+    ret_node_coord_vec[node].assign(ncv_first, ncv_first + dimension);
+    ncv_first += dimension;
+  }
+  return ret_node_coord_vec;
+}
 
-  // insert node vectors from each face of each cell
-  const size_t cn_size = m_cell_to_node_linkage.size();
-  for (size_t cell = 0; cell < cn_size; ++cell) {
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Build the cell-node tensor, for indexing by cell and face.
+ *
+ * \return a vector (per cell) of vectors (per face) of node indices.
+ */
+std::vector<std::vector<std::vector<unsigned>>> Draco_Mesh::get_cell_to_node_linkage() const {
 
-    const size_t cnface_size = m_cell_to_node_linkage[cell].size();
-    for (size_t face = 0; face < cnface_size; ++face) {
+  std::vector<std::vector<std::vector<unsigned>>> ret_cn_tensor(num_cells);
+  for (unsigned cell = 0; cell < num_cells; ++cell) {
+    ret_cn_tensor[cell].resize(m_num_faces_per_cell[cell]);
+    for (unsigned face = 0; face < m_num_faces_per_cell[cell]; ++face)
+      ret_cn_tensor[cell][face] = copy_face_nodes(m_cell_face_offset[cell] + face);
+  }
+  return ret_cn_tensor;
+}
 
-      const std::vector<unsigned> node_vec = m_cell_to_node_linkage[cell][face];
-      ret_flat_cell_node.insert(ret_flat_cell_node.end(), node_vec.begin(), node_vec.end());
-    }
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Build the node map of local cells and their neighbor nodes (only populated in 2D).
+ *
+ * \return a map from each node with adjacent cells to its cell-(node neighbors) pairs.
+ */
+Draco_Mesh::Dual_Layout Draco_Mesh::get_nc_linkage() const {
+
+  Dual_Layout ret_layout;
+  if (node_cellnode_offset.empty())
+    return ret_layout;
+  for (unsigned node = 0; node < num_nodes; ++node) {
+    auto first = node_to_cellnode_linkage.begin() + node_cellnode_offset[node];
+    auto last = node_to_cellnode_linkage.begin() + node_cellnode_offset[node + 1];
+    if (first != last)
+      ret_layout[node].assign(first, last);
   }
+  return ret_layout;
+}
 
-  // return the flattened cell-node tensor
-  Ensure(ret_flat_cell_node.size() >= 2 * m_cell_to_node_linkage.size());
-  Ensure(!ret_flat_cell_node.empty());
-  return ret_flat_cell_node;
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Build the node map of ghost cells and their ranks.
+ *
+ * \return a map from each node with adjacent ghost cells to its (cell-nodes, rank) pairs.
+ */
+Draco_Mesh::Dual_Ghost_Layout Draco_Mesh::get_ngc_linkage() const {
+
+  Dual_Ghost_Layout ret_layout;
+  if (node_ghost_offset.empty())
+    return ret_layout;
+  for (unsigned node = 0; node < num_nodes; ++node) {
+    auto first = node_to_ghost_cell_linkage.begin() + node_ghost_offset[node];
+    auto last = node_to_ghost_cell_linkage.begin() + node_ghost_offset[node + 1];
+    if (first != last)
+      ret_layout[node].assign(first, last);
+  }
+  return ret_layout;
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Build the node map of coordinates bounding adjacent ghost cells.
+ *
+ * \return a map from each node with adjacent ghost cells to its neighbor coordinate pairs.
+ */
+Draco_Mesh::Dual_Ghost_Layout_Coords Draco_Mesh::get_ngcoord_linkage() const {
+
+  Dual_Ghost_Layout_Coords ret_layout;
+  if (node_ghost_offset.empty())
+    return ret_layout;
+  for (unsigned node = 0; node < num_nodes; ++node) {
+    auto first = node_to_ghost_coord_linkage.begin() + node_ghost_offset[node];
+    auto last = node_to_ghost_coord_linkage.begin() + node_ghost_offset[node + 1];
+    if (first != last)
+      ret_layout[node].assign(first, last);
+  }
+  return ret_layout;
 }
 
 //------------------------------------------------------------------------------------------------//
@@ -176,16 +252,17 @@ int32_t Draco_Mesh::next_face(const int32_t cell, const int32_t face) const {
   if (face <= num_cc_faces) {
 
     // get neighbor cell index
-    const unsigned next_cell = cell_to_cell_linkage.at(l_cell)[face - 1].first;
+    const unsigned next_cell = cell_to_cell_linkage.indices(l_cell)[face - 1];
     Check(num_cellcell_faces_per_cell[next_cell] > 0);
 
     // get face nodes in set form
-    const std::vector<unsigned> &node_vec = cell_to_cell_linkage.at(l_cell)[face - 1].second;
+    const Index_View node_vec = get_face_nodes(cell_to_cell_linkage.faces(l_cell)[face - 1]);
     const std::set<unsigned> nodes = std::set<unsigned>(node_vec.begin(), node_vec.end());
 
     // check each cell-cell face of the next node
+    const Index_View next_faces = cell_to_cell_linkage.faces(next_cell);
     for (unsigned j = 1; j <= num_cellcell_faces_per_cell[next_cell]; ++j) {
-      const std::vector<unsigned> &node_nbr_vec = cell_to_cell_linkage.at(next_cell)[j - 1].second;
+      const Index_View node_nbr_vec = get_face_nodes(next_faces[j - 1]);
       if (std::set<unsigned>(node_nbr_vec.begin(), node_nbr_vec.end()) == nodes)
         return static_cast<int32_t>(j);
     }
@@ -205,87 +282,128 @@ int32_t Draco_Mesh::next_face(const int32_t cell, const int32_t face) const {
 // PRIVATE FUNCTIONS
 //------------------------------------------------------------------------------------------------//
 /*!
- * \brief Build the cell-face index map to the corresponding coordinates.
+ * \brief Compute the CSR offsets of the cell-node linkage.
  *
- * \param[in] coordinates serialized map of node index to coordinate values (passed from
- *               constructor).
- * \return a vector of vectors of size=dimension of coordinates.
+ * Fills m_cell_face_offset (serial index of each cell's first face) and m_face_node_offset
+ * (position of each serial cell face's first node in m_cell_to_node_linkage).
  */
-std::vector<std::vector<double>>
-Draco_Mesh::compute_node_coord_vec(const std::vector<double> &coordinates) const {
+void Draco_Mesh::compute_cell_to_node_offsets() {
 
-  Require(coordinates.size() == dimension * num_nodes);
+  Require(m_num_faces_per_cell.size() == num_cells);
 
-  // resize this class's coordinate data member
-  std::vector<std::vector<double>> ret_node_coord_vec(num_nodes, std::vector<double>(dimension));
-
-  // deserialize the vector of node coordinates
-  auto ncv_first = coordinates.begin();
-  for (unsigned node = 0; node < num_nodes; ++node) {
+  m_cell_face_offset.resize(num_cells + 1);
+  m_cell_face_offset[0] = 0;
+  for (unsigned cell = 0; cell < num_cells; ++cell)
+    m_cell_face_offset[cell + 1] = m_cell_face_offset[cell] + m_num_faces_per_cell[cell];
 
-    // create a vector of node indices for this cell
-    std::vector<double> coord_vec(ncv_first, ncv_first + dimension);
+  Require(m_num_nodes_per_face_per_cell.size() == m_cell_face_offset[num_cells]);
 
-    // resize each entry to the number of dimensions
-    ret_node_coord_vec[node] = coord_vec;
-
-    // increment pointer
-    ncv_first += dimension;
+  const size_t num_cell_faces = m_num_nodes_per_face_per_cell.size();
+  m_face_node_offset.resize(num_cell_faces + 1);
+  m_face_node_offset[0] = 0;
+  for (size_t cf = 0; cf < num_cell_faces; ++cf) {
+    Check(m_face_node_offset[cf] + size_t(m_num_nodes_per_face_per_cell[cf]) < UINT_MAX);
+    m_face_node_offset[cf + 1] = m_face_node_offset[cf] + m_num_nodes_per_face_per_cell[cf];
   }
 
-  Ensure(ncv_first == coordinates.end());
-
-  return ret_node_coord_vec;
+  Ensure(m_face_node_offset[num_cell_faces] == m_cell_to_node_linkage.size());
 }
 
 //------------------------------------------------------------------------------------------------//
 /*!
- * \brief Build the cell-face index map to the corresponding coordinates.
+ * \brief Build the Layout (map) form of a flat layout.
  *
- * \param[in] num_faces_per_cell number of faces per cell
- * \param[in] num_nodes_per_face_per_cell number of nodes per face per cell.
- * \param[in] cell_to_node_linkage node indices per face per cell (serialized).
- *
- * \return a vector of vectors of size=dimension of coordinates.
+ * \param[in] flat a flat cell-to-cell, cell-to-side or cell-to-ghost-cell layout.
+ * \return a map from each cell with faces in the layout to its (index, face nodes) pairs.
  */
-std::vector<std::vector<std::vector<unsigned>>>
-Draco_Mesh::compute_cell_to_node_tensor(const std::vector<unsigned> &num_faces_per_cell,
-                                        const std::vector<unsigned> &num_nodes_per_face_per_cell,
-                                        const std::vector<unsigned> &cell_to_node_linkage) const {
+Draco_Mesh::Layout Draco_Mesh::expand_layout(const Flat_Layout &flat) const {
 
-  std::vector<std::vector<std::vector<unsigned>>> ret_cn_tensor(num_cells);
+  Require(flat.face_offset.size() == num_cells + 1);
 
-  // deserialize the cell-node linkage vector
-  auto cfn_first = cell_to_node_linkage.begin();
-  unsigned cf_indx = 0;
+  Layout ret_layout;
   for (unsigned cell = 0; cell < num_cells; ++cell) {
+    const unsigned num_faces = flat.num_faces(cell);
+    if (num_faces == 0)
+      continue;
+    std::vector<std::pair<unsigned, std::vector<unsigned>>> &faces = ret_layout[cell];
+    faces.reserve(num_faces);
+    const Index_View indices = flat.indices(cell);
+    const Index_View cell_faces = flat.faces(cell);
+    for (unsigned f = 0; f < num_faces; ++f)
+      faces.emplace_back(indices[f], copy_face_nodes(cell_faces[f]));
+  }
+  return ret_layout;
+}
 
-    // resize the vector of vectors of nodes to the number of faces
-    ret_cn_tensor[cell].resize(num_faces_per_cell[cell]);
-
-    for (unsigned face = 0; face < num_faces_per_cell[cell]; ++face) {
-
-      // get the vector of nodes
-      std::vector<unsigned> node_vec(cfn_first, cfn_first + num_nodes_per_face_per_cell[cf_indx]);
-
-      // resize and set the vector of nodes for this face
-      ret_cn_tensor[cell][face] = node_vec;
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Copy the ordered nodes of a serial cell face.
+ *
+ * \param[in] cell_face serial cell face index.
+ * \return the face's node indices.
+ */
+std::vector<unsigned> Draco_Mesh::copy_face_nodes(const unsigned cell_face) const {
+  Require(cell_face + 1 < m_face_node_offset.size());
+  return std::vector<unsigned>(m_cell_to_node_linkage.begin() + m_face_node_offset[cell_face],
+                               m_cell_to_node_linkage.begin() + m_face_node_offset[cell_face + 1]);
+}
 
-      // increment iterator and counter
-      cfn_first += num_nodes_per_face_per_cell[cf_indx];
-      cf_indx++;
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Build a flat layout from the index across each serial cell face.
+ *
+ * \param[in] cface_index adjacent cell, side or ghost cell index per serial cell face, or
+ *               no_face_index where the face is not in the layout.
+ * \param[in] n_threads number of OpenMP threads.
+ * \return the flat layout, with each cell's faces in cell face order.
+ */
+Draco_Mesh::Flat_Layout Draco_Mesh::compute_flat_layout(const std::vector<unsigned> &cface_index,
+                                                        const int n_threads) const {
+
+  Require(cface_index.size() == m_cell_face_offset[num_cells]);
+
+  Flat_Layout flat;
+
+  // count the faces of each cell in the layout, then turn the counts into CSR offsets
+  flat.face_offset.assign(num_cells + 1, 0);
+#ifdef OPENMP_FOUND
+#pragma omp parallel for num_threads(n_threads) schedule(static)
+#endif
+  for (unsigned cell = 0; cell < num_cells; ++cell)
+    for (unsigned cf = m_cell_face_offset[cell]; cf < m_cell_face_offset[cell + 1]; ++cf)
+      if (cface_index[cf] != no_face_index)
+        flat.face_offset[cell + 1]++;
+  std::partial_sum(flat.face_offset.begin(), flat.face_offset.end(), flat.face_offset.begin());
+
+  // fill in each cell's faces
+  flat.face_index.resize(flat.face_offset[num_cells]);
+  flat.cell_face.resize(flat.face_offset[num_cells]);
+#ifdef OPENMP_FOUND
+#pragma omp parallel for num_threads(n_threads) schedule(static)
+#endif
+  for (unsigned cell = 0; cell < num_cells; ++cell) {
+    unsigned face = flat.face_offset[cell];
+    for (unsigned cf = m_cell_face_offset[cell]; cf < m_cell_face_offset[cell + 1]; ++cf) {
+      if (cface_index[cf] != no_face_index) {
+        flat.face_index[face] = cface_index[cf];
+        flat.cell_face[face] = cf;
+        face++;
+      }
     }
   }
 
-  Ensure(cfn_first == cell_to_node_linkage.end());
-
-  return ret_cn_tensor;
+  return flat;
 }
 
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Build the cell-face index map to the corresponding coordinates.
  *
+ * Cell faces are matched on their node sets in n_threads hash shards: the high bits of a face's
+ * hash pick its shard, the faces are bucketed by shard once, and each shard inserts the faces of
+ * its bucket in serial cell face order, so the cells found on either side of a face do not depend
+ * on the number of shards.
+ *
  * \param[in] num_faces_per_cell number of faces per cell.
  * \param[in] cell_to_node_linkage serial map of cell to face to node indices.
  * \param[in] num_nodes_per_face_per_cell number of nodes per face per cell
@@ -293,6 +411,7 @@ Draco_Mesh::compute_cell_to_node_tensor(const std::vector<unsigned> &num_faces_p
  * \param[in] side_to_node_linkage serial map of side index to node indices.
  * \param[in] ghost_cell_type  number of common vertices per ghost cell.
  * \param[in] ghost_cell_to_node_linkage vertices in common per ghost cell.
+ * \param[in] n_threads number of OpenMP threads (and of face hash shards).
  */
 void Draco_Mesh::compute_cell_to_cell_linkage(
     const std::vector<unsigned> &num_faces_per_cell,
@@ -300,132 +419,196 @@ void Draco_Mesh::compute_cell_to_cell_linkage(
     const std::vector<unsigned> &num_nodes_per_face_per_cell,
     const std::vector<unsigned> &side_node_count, const std::vector<unsigned> &side_to_node_linkage,
     const std::vector<unsigned> &ghost_cell_type,
-    const std::vector<unsigned> &ghost_cell_to_node_linkage) {
+    const std::vector<unsigned> &ghost_cell_to_node_linkage, const int n_threads) {
 
   Require(num_nodes_per_face_per_cell.size() > 0);
   Require(num_nodes_per_face_per_cell.size() ==
           std::accumulate(num_faces_per_cell.begin(), num_faces_per_cell.end(), 0U));
+  Require(m_face_node_offset.size() == num_nodes_per_face_per_cell.size() + 1);
+  Require(m_face_node_offset.back() == cell_to_node_linkage.size());
+  Require(n_threads > 0);
+
+  const size_t num_cell_faces = num_nodes_per_face_per_cell.size();
+  const unsigned *const cn_linkage = cell_to_node_linkage.data();
+
+  // (1) pick the hash shard of each cell face
+
+  const auto num_shards = static_cast<unsigned>(n_threads);
+  std::vector<unsigned> cface_shard(num_cell_faces);
+
+  std::exception_ptr loop_error;
+#ifdef OPENMP_FOUND
+#pragma omp parallel for num_threads(n_threads) schedule(static)
+#endif
+  for (size_t cf = 0; cf < num_cell_faces; ++cf) {
+    try {
+      // the tables take slots from the low bits of the hash, so shard on the high bits
+      const uint64_t hash = Face_Hash_Table::hash(cn_linkage + m_face_node_offset[cf],
+                                                  num_nodes_per_face_per_cell[cf]);
+      cface_shard[cf] = static_cast<unsigned>((hash >> 32) % num_shards);
+    } catch (...) {
+#ifdef OPENMP_FOUND
+#pragma omp critical(mesh_loop_error)
+#endif
+      if (!loop_error)
+        loop_error = std::current_exception();
+    }
+  }
+  if (loop_error)
+    std::rethrow_exception(loop_error);
+
+  // bucket the cell faces by shard (counting sort), keeping serial cell face order in each bucket
+  std::vector<size_t> shard_offset(num_shards + 1, 0);
+  for (size_t cf = 0; cf < num_cell_faces; ++cf)
+    shard_offset[cface_shard[cf] + 1]++;
+  std::partial_sum(shard_offset.begin(), shard_offset.end(), shard_offset.begin());
+  std::vector<unsigned> shard_cface(num_cell_faces);
+  std::vector<unsigned> shard_cface_cell(num_cell_faces);
+  {
+    std::vector<size_t> shard_fill(shard_offset.begin(), shard_offset.end() - 1);
+    for (unsigned cell = 0; cell < num_cells; ++cell) {
+      for (unsigned cf = m_cell_face_offset[cell]; cf < m_cell_face_offset[cell + 1]; ++cf) {
+        const size_t pos = shard_fill[cface_shard[cf]]++;
+        shard_cface[pos] = cf;
+        shard_cface_cell[pos] = cell;
+      }
+    }
+  }
 
-  // (1) create map of cell face to node set
-
-  std::map<unsigned, std::set<unsigned>> cface_to_nodes;
-
-  // initialize cell face counter and cell-node iterator
-  unsigned cf_counter = 0;
-  auto cn_first = cell_to_node_linkage.begin();
-
-  // convert cell-node linkage to map of cell face to
-  for (unsigned cell = 0; cell < num_cells; ++cell) {
-    for (unsigned face = 0; face < num_faces_per_cell[cell]; ++face) {
-
-      // convert iterator to node indices to set of node indices
-      cface_to_nodes[cf_counter] =
-          std::set<unsigned>(cn_first, cn_first + num_nodes_per_face_per_cell[cf_counter]);
-
-      // increment iterator and counter
-      cn_first += num_nodes_per_face_per_cell[cf_counter];
-      cf_counter++;
+  // (2) hash the node set of each cell face in its shard, and record the cells sharing each face
+  //     (at most two are kept; more is an error below)
+
+  struct Face_Shard {
+    Face_Hash_Table faces;
+    std::vector<unsigned> key_num_cells;
+    std::vector<std::array<unsigned, 2>> key_to_cells;
+  };
+  std::vector<Face_Shard> shards(num_shards);
+  std::vector<unsigned> cface_to_key(num_cell_faces);
+
+#ifdef OPENMP_FOUND
+#pragma omp parallel for num_threads(n_threads) schedule(static, 1)
+#endif
+  for (unsigned shard = 0; shard < num_shards; ++shard) {
+    try {
+      Face_Shard &face_shard = shards[shard];
+      face_shard.faces = Face_Hash_Table(shard_offset[shard + 1] - shard_offset[shard]);
+
+      for (size_t pos = shard_offset[shard]; pos < shard_offset[shard + 1]; ++pos) {
+        const unsigned cf = shard_cface[pos];
+        const unsigned cell = shard_cface_cell[pos];
+
+        // find (or add) the key of this face's node set
+        const unsigned key = face_shard.faces.insert(cn_linkage + m_face_node_offset[cf],
+                                                     num_nodes_per_face_per_cell[cf]);
+        if (key == face_shard.key_num_cells.size()) {
+          face_shard.key_num_cells.push_back(0);
+          face_shard.key_to_cells.emplace_back();
+        }
+        cface_to_key[cf] = key;
+
+        // invert the map
+        if (face_shard.key_num_cells[key] < 2)
+          face_shard.key_to_cells[key][face_shard.key_num_cells[key]] = cell;
+        face_shard.key_num_cells[key]++;
+      }
+    } catch (...) {
+#ifdef OPENMP_FOUND
+#pragma omp critical(mesh_loop_error)
+#endif
+      if (!loop_error)
+        loop_error = std::current_exception();
     }
   }
+  if (loop_error)
+    std::rethrow_exception(loop_error);
 
-  Check(cn_first == cell_to_node_linkage.end());
+  // each face belongs to one cell (on a boundary) or two
+  for (const Face_Shard &face_shard : shards)
+    Check(std::all_of(face_shard.key_num_cells.begin(), face_shard.key_num_cells.end(),
+                      [](unsigned n) { return n >= 1 && n <= 2; }));
 
-  // (2) create a map of node-sets to cells
+  // (3) hash the node sets of boundary faces (sides) and parallel faces
 
-  std::map<std::set<unsigned>, std::vector<unsigned>> nodes_to_cells;
+  std::vector<unsigned> side_of_key;
+  const Face_Hash_Table nodes_to_side =
+      compute_node_vec_indx_map(side_node_count, side_to_node_linkage, side_of_key);
 
-  // reset cf_counter
-  cf_counter = 0;
+  std::vector<unsigned> ghost_of_key;
+  const Face_Hash_Table nodes_to_ghost =
+      compute_node_vec_indx_map(ghost_cell_type, ghost_cell_to_node_linkage, ghost_of_key);
 
-  for (unsigned cell = 0; cell < num_cells; ++cell) {
-    for (unsigned face = 0; face < num_faces_per_cell[cell]; ++face) {
+  // (4) find the neighbor cell, side and ghost cell across each cell face
 
-      // invert the map
-      nodes_to_cells[cface_to_nodes[cf_counter]].push_back(cell);
+  std::vector<unsigned> cface_cell(num_cell_faces, no_face_index);
+  std::vector<unsigned> cface_side(num_cell_faces, no_face_index);
+  std::vector<unsigned> cface_ghost(num_cell_faces, no_face_index);
 
-      // increment counter
-      cf_counter++;
+#ifdef OPENMP_FOUND
+#pragma omp parallel for num_threads(n_threads) schedule(static)
+#endif
+  for (unsigned cell = 0; cell < num_cells; ++cell) {
+    try {
+      for (unsigned cf = m_cell_face_offset[cell]; cf < m_cell_face_offset[cell + 1]; ++cf) {
+
+        const unsigned *const face_nodes = cn_linkage + m_face_node_offset[cf];
+        const unsigned face_size = num_nodes_per_face_per_cell[cf];
+
+        // a neighbor cell exists if two cells share this face's node set
+        const Face_Shard &face_shard = shards[cface_shard[cf]];
+        const unsigned key = cface_to_key[cf];
+        if (face_shard.key_num_cells[key] == 2) {
+          const std::array<unsigned, 2> &cells = face_shard.key_to_cells[key];
+          cface_cell[cf] = cell == cells[0] ? cells[1] : cells[0];
+        }
+
+        // check if a boundary/side exists for this node set
+        const unsigned side_key = nodes_to_side.find(face_nodes, face_size);
+        if (side_key != Face_Hash_Table::npos)
+          cface_side[cf] = side_of_key[side_key];
+
+        // check if a parallel face exists for this node set
+        const unsigned ghost_key = nodes_to_ghost.find(face_nodes, face_size);
+        if (ghost_key != Face_Hash_Table::npos)
+          cface_ghost[cf] = ghost_of_key[ghost_key];
+      }
+    } catch (...) {
+#ifdef OPENMP_FOUND
+#pragma omp critical(mesh_loop_error)
+#endif
+      if (!loop_error)
+        loop_error = std::current_exception();
     }
   }
+  if (loop_error)
+    std::rethrow_exception(loop_error);
 
-  // (3) create maps of nodes to boundary faces (sides) and parallel faces
-
-  std::map<std::set<unsigned>, unsigned> nodes_to_side =
-      compute_node_vec_indx_map(side_node_count, side_to_node_linkage);
-
-  std::map<std::set<unsigned>, unsigned> nodes_to_ghost =
-      compute_node_vec_indx_map(ghost_cell_type, ghost_cell_to_node_linkage);
-
-  // (4) create cell-to-cell, cell-to-side, cell-to-ghost-cell linkage
+  // (5) check the face conditions, and make faces without any a vacuum boundary (in serial cell
+  //     face order, which numbers the new sides)
 
   // resize vectors with number of faces per cell for cell-cell or cell-side linkage
   num_cellcell_faces_per_cell = std::vector<unsigned>(num_cells, 0);
   num_cellside_faces_per_cell = std::vector<unsigned>(num_cells, 0);
 
-  // reset cf_counter and cell-node iterator
-  cf_counter = 0;
-  cn_first = cell_to_node_linkage.begin();
-
   for (unsigned cell = 0; cell < num_cells; ++cell) {
     for (unsigned face = 0; face < num_faces_per_cell[cell]; ++face) {
 
-      // initialize this face to not having a condition
-      uint32_t num_cond = 0;
-
-      // get the node set for this cell and face
-      const std::set<unsigned> &node_set = cface_to_nodes[cf_counter];
-
-      // get the cells associated with this cell face from the nodes
-      const std::vector<unsigned> &cells = nodes_to_cells[node_set];
-
-      Check(cells.size() >= 1);
-      Check(cells.size() <= 2);
-
-      // get ordered node vector from cell_to_node_linkage
-      const std::vector<unsigned> node_vec(cn_first,
-                                           cn_first + num_nodes_per_face_per_cell[cf_counter]);
-
-      // check how many cells are associated with the face
-      if (cells.size() == 2) {
-
-        // get neighbor cell index
-        const unsigned oth_cell = cell == cells[0] ? cells[1] : cells[0];
-
-        Check(oth_cell != cell);
+      // get the serial index of this cell face
+      const unsigned cf = m_cell_face_offset[cell] + face;
 
-        // add to cell-cell linkage
-        cell_to_cell_linkage[cell].push_back(std::make_pair(oth_cell, node_vec));
-
-        // increment number of cell-cell faces for this cell
+      // count the face conditions (internal, boundary, or ghost)
+      uint32_t num_cond = 0;
+      if (cface_cell[cf] != no_face_index) {
+        Check(cface_cell[cf] != cell);
         num_cellcell_faces_per_cell[cell]++;
-
-        // increment number of face conditions: a neighbor cell was found
         num_cond++;
       }
-
-      // check if a boundary/side exists for this node set
-      if (nodes_to_side.find(node_set) != nodes_to_side.end()) {
-
-        // populate cell-boundary face layout
-        cell_to_side_linkage[cell].push_back(std::make_pair(nodes_to_side[node_set], node_vec));
-
-        // increment number of cell-side faces for this cell
+      if (cface_side[cf] != no_face_index) {
         num_cellside_faces_per_cell[cell]++;
-
-        // increment number of face conditions: a true boundary was found
         num_cond++;
       }
-
-      // check if a parallel face exists for this node set
-      if (nodes_to_ghost.find(node_set) != nodes_to_ghost.end()) {
-
-        // populate cell-parallel face layout
-        cell_to_ghost_cell_linkage[cell].push_back(
-            std::make_pair(nodes_to_ghost[node_set], node_vec));
-
-        // increment number of face conditions: a off-rank face was found
+      if (cface_ghost[cf] != no_face_index)
         num_cond++;
-      }
 
       // check face has only one condition (internal, boundary, or ghost)
       Insist(num_cond <= 1, "More than one condition detected on cell face.");
@@ -437,85 +620,143 @@ void Draco_Mesh::compute_cell_to_cell_linkage(
         side_set_flag.push_back(0);
 
         // augment side-node count
-        m_side_node_count.push_back(num_nodes_per_face_per_cell[cf_counter]);
+        m_side_node_count.push_back(num_nodes_per_face_per_cell[cf]);
         Check(m_side_node_count.size() == side_set_flag.size());
 
         // augment side-node linkage
-        m_side_to_node_linkage.insert(m_side_to_node_linkage.begin(), node_vec.begin(),
-                                      node_vec.end());
+        const unsigned *const face_nodes = cn_linkage + m_face_node_offset[cf];
+        m_side_to_node_linkage.insert(m_side_to_node_linkage.begin(), face_nodes,
+                                      face_nodes + num_nodes_per_face_per_cell[cf]);
 
         // augment cell-side linkage
-        cell_to_side_linkage[cell].push_back(
-            std::make_pair(static_cast<unsigned>(m_side_node_count.size() - 1), node_vec));
+        cface_side[cf] = static_cast<unsigned>(m_side_node_count.size() - 1);
       }
-
-      // increment iterator and counter
-      cn_first += num_nodes_per_face_per_cell[cf_counter];
-      cf_counter++;
     }
   }
 
-  Ensure(cn_first == cell_to_node_linkage.end());
+  // (6) create cell-to-cell, cell-to-side, cell-to-ghost-cell linkage
+
+  cell_to_cell_linkage = compute_flat_layout(cface_cell, n_threads);
+  cell_to_side_linkage = compute_flat_layout(cface_side, n_threads);
+  cell_to_ghost_cell_linkage = compute_flat_layout(cface_ghost, n_threads);
+
+  Ensure(cell_to_cell_linkage.face_offset.size() == num_cells + 1);
 }
 
 //------------------------------------------------------------------------------------------------//
 /*!
- * \brief Build a map of node vectors to indices map for boundary layouts.
+ * \brief Build a hash table of node sets to indices for boundary layouts.
  *
  * Note: the ordering of the nodes in the mesh constructor must match the node ordering of the
  * corresponding (local) cell face.
  *
  * \param[in] indx_type vector of number of nodes, subscripted by index.
  * \param[in] indx_to_node_linkage serial map of index to node indices.
- * \return a map of node index to vector of indexes adjacent to the node.
+ * \param[out] indx_of_key index for each key of the returned table; if several indices share a node
+ *               set, the last one is kept.
+ * \return a hash table of the distinct node sets.
  */
-std::map<std::set<unsigned>, unsigned>
+Face_Hash_Table
 Draco_Mesh::compute_node_vec_indx_map(const std::vector<unsigned> &indx_type,
-                                      const std::vector<unsigned> &indx_to_node_linkage) const {
+                                      const std::vector<unsigned> &indx_to_node_linkage,
+                                      std::vector<unsigned> &indx_of_key) const {
 
-  // map to return
-  std::map<std::set<unsigned>, unsigned> nodes_to_indx_map;
+  // table to return
+  Face_Hash_Table nodes_to_indx(indx_type.size());
+  indx_of_key.clear();
+  indx_of_key.reserve(indx_type.size());
 
-  // generate map
+  // generate table
   const size_t num_indxs = indx_type.size();
-  auto i2n_first = indx_to_node_linkage.begin();
+  const unsigned *i2n_first = indx_to_node_linkage.data();
   for (unsigned indx = 0; indx < num_indxs; ++indx) {
 
-    // extract the node vector
-    const std::set<unsigned> node_vec(i2n_first, i2n_first + indx_type[indx]);
-
     // set the node vector as the key and index as the value
-    nodes_to_indx_map[node_vec] = indx;
+    const unsigned key = nodes_to_indx.insert(i2n_first, indx_type[indx]);
+    if (key == indx_of_key.size())
+      indx_of_key.push_back(indx);
+    else
+      indx_of_key[key] = indx;
 
-    // increment iterator
+    // increment pointer
     i2n_first += indx_type[indx];
   }
 
-  Ensure(i2n_first == indx_to_node_linkage.end());
+  Ensure(i2n_first == indx_to_node_linkage.data() + indx_to_node_linkage.size());
+  Ensure(indx_of_key.size() == nodes_to_indx.size());
 
-  return nodes_to_indx_map;
+  return nodes_to_indx;
 }
 
 //------------------------------------------------------------------------------------------------//
 /*!
  * \brief Build a dual layout node-cell-(node neighbors) linkage across corners
  *
+ * The local part of the dual is built with n_threads threads.  The cells about each node are
+ * counted into CSR offsets, placed, and then sorted within each node's range, so every node lists
+ * its cells in increasing order for any number of threads.  The only scratch space is one cursor
+ * per node.
+ *
  * \param[in] ghost_cell_type number of common vertices per ghost cell (sharing a full face).
  * \param[in] ghost_cell_to_node_linkage vertices in common per ghost cell (sharing a full face).
  * \param[in] global_node_number vector indexed by local node with global node index as values.
+ * \param[in] n_threads number of OpenMP threads.
  */
 void Draco_Mesh::compute_node_to_cell_linkage(
     const std::vector<unsigned> &ghost_cell_type,
     const std::vector<unsigned> &ghost_cell_to_node_linkage,
-    const std::vector<unsigned> &global_node_number) {
+    const std::vector<unsigned> &global_node_number, const int n_threads) {
+
+  Require(n_threads > 0);
 
   // (1a) create map of (single) nodes to set of cells
 
+  // condense layout at each cell to a vector of unique nodes (preserves ordering in 2D)
+  std::vector<std::vector<unsigned>> cell_nodes_per_cell(num_cells);
+  std::exception_ptr loop_error;
+#ifdef OPENMP_FOUND
+#pragma omp parallel for num_threads(n_threads) schedule(static)
+#endif
+  for (unsigned cell = 0; cell < num_cells; ++cell) {
+    try {
+      cell_nodes_per_cell[cell] = this->get_cell_nodes(cell);
+    } catch (...) {
+#ifdef OPENMP_FOUND
+#pragma omp critical(mesh_loop_error)
+#endif
+      if (!loop_error)
+        loop_error = std::current_exception();
+    }
+  }
+  if (loop_error)
+    std::rethrow_exception(loop_error);
+
+  // count the cells about each node, then turn the counts into CSR offsets
+  node_cellnode_offset.assign(num_nodes + 1, 0);
+#ifdef OPENMP_FOUND
+#pragma omp parallel for num_threads(n_threads) schedule(static)
+#endif
+  for (unsigned cell = 0; cell < num_cells; ++cell) {
+    for (auto node : cell_nodes_per_cell[cell]) {
+#ifdef OPENMP_FOUND
+#pragma omp atomic
+#endif
+      node_cellnode_offset[node + 1]++;
+    }
+  }
+  std::partial_sum(node_cellnode_offset.begin(), node_cellnode_offset.end(),
+                   node_cellnode_offset.begin());
+
   // convert cell-node linkage to map of node to adjacent cells and corresponding adjacent nodes
+  // (threads claim the next position in a node's range, so the ranges are sorted by cell below)
+  node_to_cellnode_linkage.resize(node_cellnode_offset[num_nodes]);
+  std::vector<unsigned> next_cellnode(node_cellnode_offset.begin(), node_cellnode_offset.end() - 1);
+#ifdef OPENMP_FOUND
+#pragma omp parallel for num_threads(n_threads) schedule(static)
+#endif
   for (unsigned cell = 0; cell < num_cells; ++cell) {
 
-    // condense layout at this cell to a vector of unique nodes (preserves ordering in 2D)
-    const std::vector<unsigned> cell_nodes = this->get_cell_nodes(cell);
+    const std::vector<unsigned> &cell_nodes = cell_nodes_per_cell[cell];
 
     // get the size of the unique node vector
     const size_t num_cell_nodes = cell_nodes.size();
@@ -532,10 +773,24 @@ void Draco_Mesh::compute_node_to_cell_linkage(
       const std::array<unsigned, 2> node_nbrs = {cell_nodes[cnode_nbr1], cell_nodes[cnode_nbr2]};
 
       // add the pair of neighbor cells and node indices to the set for this node
-      node_to_cellnode_linkage[node].push_back(std::make_pair(cell, node_nbrs));
+      unsigned cellnode;
+#ifdef OPENMP_FOUND
+#pragma omp atomic capture
+#endif
+      cellnode = next_cellnode[node]++;
+      node_to_cellnode_linkage[cellnode] = std::make_pair(cell, node_nbrs);
     }
   }
 
+  // list each node's cells in increasing order (a cell appears once per node)
+#ifdef OPENMP_FOUND
+#pragma omp parallel for num_threads(n_threads) schedule(static)
+#endif
+  for (unsigned node = 0; node < num_nodes; ++node)
+    std::sort(node_to_cellnode_linkage.begin() + node_cellnode_offset[node],
+              node_to_cellnode_linkage.begin() + node_cellnode_offset[node + 1],
+              [](const CellNodes_Pair &a, const CellNodes_Pair &b) { return a.first < b.first; });
+
   // avoid populating ghost node map if there are no faces that go off rank
   if (ghost_cell_type.size() == 0)
     return;
@@ -579,7 +834,9 @@ void Draco_Mesh::compute_node_to_cell_linkage(
       const unsigned global_node = global_node_number[local_node];
 
       // set initial rank and local cell listing at this global node
-      global_node_to_local_cellnodes[global_node] = node_to_cellnode_linkage.at(local_node);
+      global_node_to_local_cellnodes[global_node].assign(
+          node_to_cellnode_linkage.begin() + node_cellnode_offset[local_node],
+          node_to_cellnode_linkage.begin() + node_cellnode_offset[local_node + 1]);
 
       // increment ghost-cell-node-linkage counter
       gcn_counter++;
@@ -629,10 +886,10 @@ void Draco_Mesh::compute_node_to_cell_linkage(
       const unsigned node1 = global_node_cellnode_pair.second[j].second[0];
       const unsigned node2 = global_node_cellnode_pair.second[j].second[1];
       const size_t cnbrs_offset = 4 * (serial_count + j);
-      coord_nbrs_per_serial[cnbrs_offset] = node_coord_vec[node1][0];
-      coord_nbrs_per_serial[cnbrs_offset + 1] = node_coord_vec[node1][1];
-      coord_nbrs_per_serial[cnbrs_offset + 2] = node_coord_vec[node2][0];
-      coord_nbrs_per_serial[cnbrs_offset + 3] = node_coord_vec[node2][1];
+      coord_nbrs_per_serial[cnbrs_offset] = node_coords[2 * node1];
+      coord_nbrs_per_serial[cnbrs_offset + 1] = node_coords[2 * node1 + 1];
+      coord_nbrs_per_serial[cnbrs_offset + 2] = node_coords[2 * node2];
+      coord_nbrs_per_serial[cnbrs_offset + 3] = node_coords[2 * node2 + 1];
     }
 
     // increment count over serial index
@@ -719,6 +976,10 @@ void Draco_Mesh::compute_node_to_cell_linkage(
   // get this (my) rank
   const unsigned my_rank = rtt_c4::node();
 
+  // per-node ghost data, gathered in rank order before flattening
+  Dual_Ghost_Layout ghost_cells_per_node;
+  Dual_Ghost_Layout_Coords ghost_coords_per_node;
+
   // generate dual ghost layout
   for (unsigned rank = 0; rank < num_ranks; ++rank) {
 
@@ -753,15 +1014,37 @@ void Draco_Mesh::compute_node_to_cell_linkage(
 
       // append each local-cell-rank pair to dual ghost layout
       for (auto local_cellnodes : ghost_dualmap_per_rank[rank].at(gl_node))
-        node_to_ghost_cell_linkage[node].emplace_back(std::make_pair(local_cellnodes, rank));
+        ghost_cells_per_node[node].emplace_back(std::make_pair(local_cellnodes, rank));
 
       // append each ghost coordinate pair bounding a ghost cell neighboring this node
       for (auto coord_nbrs : ghost_coord_nbrs_per_rank[rank].at(gl_node))
-        node_to_ghost_coord_linkage[node].emplace_back(coord_nbrs);
+        ghost_coords_per_node[node].emplace_back(coord_nbrs);
     }
   }
 
-  // since this mesh was constructed with ghost data, the resulting map must have non-zero size
+  //----------------------------------------------------------------------------------------------//
+  // flatten the dual ghost layout and coordinates, which have the same length at each node
+
+  node_ghost_offset.assign(num_nodes + 1, 0);
+  for (const auto &node_ghosts : ghost_cells_per_node) {
+    Check(node_ghosts.second.size() == ghost_coords_per_node.at(node_ghosts.first).size());
+    node_ghost_offset[node_ghosts.first + 1] = static_cast<unsigned>(node_ghosts.second.size());
+  }
+  std::partial_sum(node_ghost_offset.begin(), node_ghost_offset.end(), node_ghost_offset.begin());
+
+  node_to_ghost_cell_linkage.clear();
+  node_to_ghost_coord_linkage.clear();
+  node_to_ghost_cell_linkage.reserve(node_ghost_offset[num_nodes]);
+  node_to_ghost_coord_linkage.reserve(node_ghost_offset[num_nodes]);
+  for (const auto &node_ghosts : ghost_cells_per_node) {
+    const std::vector<Coord_NBRS> &coords = ghost_coords_per_node.at(node_ghosts.first);
+    node_to_ghost_cell_linkage.insert(node_to_ghost_cell_linkage.end(), node_ghosts.second.begin(),
+                                      node_ghosts.second.end());
+    node_to_ghost_coord_linkage.insert(node_to_ghost_coord_linkage.end(), coords.begin(),
+                                       coords.end());
+  }
+
+  // since this mesh was constructed with ghost data, the resulting layout must have non-zero size
   Ensure(node_to_ghost_cell_linkage.size() > 0);
   Ensure(node_to_ghost_coord_linkage.size() > 0);
 }
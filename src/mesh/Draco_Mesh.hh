@@ -10,6 +10,9 @@
 #ifndef rtt_mesh_Draco_Mesh_hh
 #define rtt_mesh_Draco_Mesh_hh
 
+#include "Face_Hash_Table.hh"
+#include "ds++/Assert.hh"
+#include "ds++/Slice.hh"
 #include "ds++/config.h"
 #include "mesh_element/Geometry.hh"
 #include <array>
@@ -40,11 +43,22 @@ namespace rtt_mesh {
  * 4) Dual_Ghost_Layout, which stores node connectivity to off-process adjacent cells and nodes.
  *    This an has additional field for the MPI rank index the neighboring cell and nodes are on.
  *
+ * The layouts, the cell-to-node linkage and the node coordinates are stored flat, in compressed
+ * sparse row (CSR) form: an offset array per cell (or node, or face) into one contiguous array.
+ * The get_flat_* and per-cell or per-node accessors return references or rtt_dsxx::Slice views of
+ * that storage, so they copy nothing.  The older map- and nested-vector-shaped getters (e.g.
+ * get_cc_linkage()) are kept for compatibility; they build their containers from the flat storage
+ * on each call, so loops that run every cycle should use the flat accessors.
+ *
+ * The constructor can build the layouts with several OpenMP threads (n_threads_).  The per-cell
+ * work is split by cell, faces are matched in hash shards that each keep their own insertion order,
+ * and the node-to-cell dual is counted into CSR offsets and then sorted by cell within each node, so
+ * the mesh is identical for any thread count.  A DBC failure inside a threaded loop is rethrown
+ * after the loop.
+ *
  * Possibly temporary features:
  * 1) The num_faces_per_cell_ vector (argument to the constructor) is currently taken to be the
  *    number of faces per cell.
- * 2) The layout data structure(s) will probably be moved to a separate class, where accessors might
- *    be used on a flattened version.
  */
 //================================================================================================//
 
@@ -69,6 +83,40 @@ public:
       std::map<unsigned int, std::vector<std::pair<CellNodes_Pair, unsigned int>>>;
   using Dual_Ghost_Layout_Coords = std::map<unsigned int, std::vector<Coord_NBRS>>;
 
+  // views into flat storage
+  using Index_View = rtt_dsxx::Slice<const unsigned *>;
+  using Coord_View = rtt_dsxx::Slice<const double *>;
+  using CellNodes_View = rtt_dsxx::Slice<const CellNodes_Pair *>;
+  using Ghost_CellNodes_View = rtt_dsxx::Slice<const std::pair<CellNodes_Pair, unsigned int> *>;
+  using Coord_NBRS_View = rtt_dsxx::Slice<const Coord_NBRS *>;
+
+  /*!
+   * \brief Flat (CSR) form of a Layout.
+   *
+   * The faces of cell c in the layout are f = face_offset[c], ..., face_offset[c+1]-1, in the same
+   * order as the vector of a Layout entry.  Face f links to face_index[f] (the adjacent cell, side
+   * or ghost cell) and is cell face cell_face[f] of the mesh, whose ordered nodes are
+   * Draco_Mesh::get_face_nodes(cell_face[f]).
+   */
+  struct Flat_Layout {
+    std::vector<unsigned> face_offset; //!< num_cells + 1 offsets into face_index and cell_face
+    std::vector<unsigned> face_index;  //!< adjacent cell, side or ghost cell index per face
+    std::vector<unsigned> cell_face;   //!< serial cell face index per face
+
+    //! Number of faces of a cell in this layout.
+    unsigned num_faces(unsigned cell) const { return face_offset[cell + 1] - face_offset[cell]; }
+
+    //! Adjacent cell, side or ghost cell indices of a cell's faces.
+    Index_View indices(unsigned cell) const {
+      return Index_View(face_index.data() + face_offset[cell], num_faces(cell));
+    }
+
+    //! Serial cell face indices of a cell's faces.
+    Index_View faces(unsigned cell) const {
+      return Index_View(cell_face.data() + face_offset[cell], num_faces(cell));
+    }
+  };
+
 protected:
   // >>> DATA
 
@@ -93,36 +141,42 @@ protected:
   // Node index for each ghost cell, subscripted with local ghost cell index
   const std::vector<int> ghost_cell_rank;
 
-  // Vector subscripted with node index with coordinate vector
-  const std::vector<std::vector<double>> node_coord_vec;
+  // Node coordinates, dimension values per node
+  const std::vector<double> node_coords;
 
   // Cell types and node indices per cell
   const std::vector<unsigned> m_num_faces_per_cell;
   const std::vector<unsigned> m_num_nodes_per_face_per_cell;
-  const std::vector<std::vector<std::vector<unsigned>>> m_cell_to_node_linkage;
+  const std::vector<unsigned> m_cell_to_node_linkage;
+
+  // CSR offsets of m_cell_to_node_linkage: the faces of cell c are the serial cell faces
+  // m_cell_face_offset[c], ..., m_cell_face_offset[c+1]-1, and the nodes of serial cell face f are
+  // m_cell_to_node_linkage[m_face_node_offset[f]], ..., [m_face_node_offset[f+1]-1]
+  std::vector<unsigned> m_cell_face_offset;
+  std::vector<unsigned> m_face_node_offset;
 
   // Side types and node indices per side
   std::vector<unsigned> m_side_node_count;
   std::vector<unsigned> m_side_to_node_linkage;
 
-  // Layout of mesh: vector index is cell index, vector element is description of cell's adjacency
-  // to other cells in the mesh.
-  Layout cell_to_cell_linkage;
+  // Layout of mesh: description of each cell's adjacency to other cells in the mesh.
+  Flat_Layout cell_to_cell_linkage;
 
   // Side layout of mesh
-  Layout cell_to_side_linkage;
+  Flat_Layout cell_to_side_linkage;
 
   // Ghost cell layout of mesh
-  Layout cell_to_ghost_cell_linkage;
+  Flat_Layout cell_to_ghost_cell_linkage;
 
-  // Node map to vector of local cells
-  Dual_Layout node_to_cellnode_linkage;
+  // Local cells and their neighbor nodes about each node (CSR; empty offsets unless 2D)
+  std::vector<unsigned> node_cellnode_offset;
+  std::vector<CellNodes_Pair> node_to_cellnode_linkage;
 
-  // Node map to vector of ghost cells
-  Dual_Ghost_Layout node_to_ghost_cell_linkage;
-
-  // Node map to vector of adjacent coordinates bounding adjacent ghost cells
-  Dual_Ghost_Layout_Coords node_to_ghost_coord_linkage;
+  // Ghost cells with their ranks, and the coordinates bounding them, about each node (CSR; empty
+  // offsets without ghost data).  Both arrays share node_ghost_offset.
+  std::vector<unsigned> node_ghost_offset;
+  std::vector<std::pair<CellNodes_Pair, unsigned int>> node_to_ghost_cell_linkage;
+  std::vector<Coord_NBRS> node_to_ghost_coord_linkage;
 
   // number of cell-cell linkage faces per cell
   std::vector<unsigned> num_cellcell_faces_per_cell;
@@ -143,7 +197,7 @@ public:
              const std::vector<unsigned> &ghost_cell_type_ = {},
              const std::vector<unsigned> &ghost_cell_to_node_linkage_ = {},
              const std::vector<int> &ghost_cell_number_ = {},
-             const std::vector<int> &ghost_cell_rank_ = {});
+             const std::vector<int> &ghost_cell_rank_ = {}, const int n_threads_ = 1);
 
   // >>> ACCESSORS
 
@@ -151,30 +205,91 @@ public:
   Geometry get_geometry() const { return geometry; }
   unsigned get_num_cells() const { return num_cells; }
   unsigned get_num_nodes() const { return num_nodes; }
-  std::vector<unsigned> get_side_set_flag() const { return side_set_flag; }
-  std::vector<int> get_ghost_cell_numbers() const { return ghost_cell_number; }
-  std::vector<int> get_ghost_cell_ranks() const { return ghost_cell_rank; }
-  std::vector<std::vector<double>> get_node_coord_vec() const { return node_coord_vec; }
-  std::vector<unsigned> get_num_faces_per_cell() const { return m_num_faces_per_cell; }
-  std::vector<unsigned> get_num_nodes_per_face_per_cell() const {
+  const std::vector<unsigned> &get_side_set_flag() const { return side_set_flag; }
+  const std::vector<int> &get_ghost_cell_numbers() const { return ghost_cell_number; }
+  const std::vector<int> &get_ghost_cell_ranks() const { return ghost_cell_rank; }
+  const std::vector<unsigned> &get_num_faces_per_cell() const { return m_num_faces_per_cell; }
+  const std::vector<unsigned> &get_num_nodes_per_face_per_cell() const {
     return m_num_nodes_per_face_per_cell;
   }
-  std::vector<std::vector<std::vector<unsigned>>> get_cell_to_node_linkage() const {
+  const std::vector<unsigned> &get_side_node_count() const { return m_side_node_count; }
+  const std::vector<unsigned> &get_side_to_node_linkage() const { return m_side_to_node_linkage; }
+
+  // >>> FLAT (CSR) ACCESSORS
+
+  //! Node coordinates, dimension values per node.
+  const std::vector<double> &get_node_coords() const { return node_coords; }
+
+  //! Coordinates of one node.
+  Coord_View get_node_coords(const unsigned node) const {
+    Require(node < num_nodes);
+    return Coord_View(node_coords.data() + dimension * node, dimension);
+  }
+
+  //! Cell-to-node linkage, as passed to the constructor.
+  const std::vector<unsigned> &get_flat_cell_node_linkage() const {
     return m_cell_to_node_linkage;
   }
-  std::vector<unsigned> get_side_node_count() const { return m_side_node_count; }
-  std::vector<unsigned> get_side_to_node_linkage() const { return m_side_to_node_linkage; }
-  Layout get_cc_linkage() const { return cell_to_cell_linkage; }
-  Layout get_cs_linkage() const { return cell_to_side_linkage; }
-  Layout get_cg_linkage() const { return cell_to_ghost_cell_linkage; }
-  Dual_Layout get_nc_linkage() const { return node_to_cellnode_linkage; }
-  Dual_Ghost_Layout get_ngc_linkage() const { return node_to_ghost_cell_linkage; }
-  Dual_Ghost_Layout_Coords get_ngcoord_linkage() const { return node_to_ghost_coord_linkage; }
+
+  //! Ordered nodes of serial cell face cell_face.
+  Index_View get_face_nodes(const unsigned cell_face) const {
+    Require(cell_face + 1 < m_face_node_offset.size());
+    return Index_View(m_cell_to_node_linkage.data() + m_face_node_offset[cell_face],
+                      m_face_node_offset[cell_face + 1] - m_face_node_offset[cell_face]);
+  }
+
+  //! Ordered nodes of a cell's face.
+  Index_View get_cell_face_nodes(const unsigned cell, const unsigned face) const {
+    Require(cell < num_cells);
+    Require(face < m_num_faces_per_cell[cell]);
+    return get_face_nodes(m_cell_face_offset[cell] + face);
+  }
+
+  const Flat_Layout &get_flat_cc_linkage() const { return cell_to_cell_linkage; }
+  const Flat_Layout &get_flat_cs_linkage() const { return cell_to_side_linkage; }
+  const Flat_Layout &get_flat_cg_linkage() const { return cell_to_ghost_cell_linkage; }
+
+  //! Local cells, with their neighbor nodes, about a node (2D only; empty otherwise).
+  CellNodes_View get_node_cellnodes(const unsigned node) const {
+    Require(node < num_nodes);
+    if (node_cellnode_offset.empty())
+      return CellNodes_View(node_to_cellnode_linkage.data(), 0);
+    return CellNodes_View(node_to_cellnode_linkage.data() + node_cellnode_offset[node],
+                          node_cellnode_offset[node + 1] - node_cellnode_offset[node]);
+  }
+
+  //! Ghost cells, with their neighbor nodes and ranks, about a node.
+  Ghost_CellNodes_View get_node_ghost_cells(const unsigned node) const {
+    Require(node < num_nodes);
+    if (node_ghost_offset.empty())
+      return Ghost_CellNodes_View(node_to_ghost_cell_linkage.data(), 0);
+    return Ghost_CellNodes_View(node_to_ghost_cell_linkage.data() + node_ghost_offset[node],
+                                node_ghost_offset[node + 1] - node_ghost_offset[node]);
+  }
+
+  //! Neighbor node coordinates bounding each of get_node_ghost_cells(node).
+  Coord_NBRS_View get_node_ghost_coords(const unsigned node) const {
+    Require(node < num_nodes);
+    if (node_ghost_offset.empty())
+      return Coord_NBRS_View(node_to_ghost_coord_linkage.data(), 0);
+    return Coord_NBRS_View(node_to_ghost_coord_linkage.data() + node_ghost_offset[node],
+                           node_ghost_offset[node + 1] - node_ghost_offset[node]);
+  }
+
+  // >>> COMPATIBILITY ACCESSORS (built from the flat storage on each call)
+
+  std::vector<std::vector<double>> get_node_coord_vec() const;
+  std::vector<std::vector<std::vector<unsigned>>> get_cell_to_node_linkage() const;
+  Layout get_cc_linkage() const { return expand_layout(cell_to_cell_linkage); }
+  Layout get_cs_linkage() const { return expand_layout(cell_to_side_linkage); }
+  Layout get_cg_linkage() const { return expand_layout(cell_to_ghost_cell_linkage); }
+  Dual_Layout get_nc_linkage() const;
+  Dual_Ghost_Layout get_ngc_linkage() const;
+  Dual_Ghost_Layout_Coords get_ngcoord_linkage() const;
 
   // >>> SERVICES
 
   const std::vector<unsigned> get_cell_nodes(const unsigned cell) const;
-  const std::vector<unsigned> get_flat_cell_node_linkage() const;
 
   //! Get face index of adjacent face in neighboring cell
   int32_t next_face(const int32_t cell, const int32_t face) const;
@@ -182,15 +297,17 @@ public:
 private:
   // >>> SUPPORT FUNCTIONS
 
-  //! Calculate (merely deserialize) the vector of node coordinates
-  std::vector<std::vector<double>>
-  compute_node_coord_vec(const std::vector<double> &coordinates) const;
+  //! Calculate the CSR offsets of the cell-node linkage by cell and face
+  void compute_cell_to_node_offsets();
 
-  //! Convert cell-node linkage into tensor for easier indexing by cell, face
-  std::vector<std::vector<std::vector<unsigned>>>
-  compute_cell_to_node_tensor(const std::vector<unsigned> &num_faces_per_cell,
-                              const std::vector<unsigned> &num_nodes_per_face_per_cell,
-                              const std::vector<unsigned> &cell_to_node_linkage) const;
+  //! Build the Layout form of a flat layout
+  Layout expand_layout(const Flat_Layout &flat) const;
+
+  //! Build a flat layout from the index across each serial cell face
+  Flat_Layout compute_flat_layout(const std::vector<unsigned> &cface_index, int n_threads) const;
+
+  //! Copy the ordered nodes of a serial cell face
+  std::vector<unsigned> copy_face_nodes(unsigned cell_face) const;
 
   //! Calculate the cell-to-cell linkage with face type vector
   void compute_cell_to_cell_linkage(const std::vector<unsigned> &num_faces_per_cell,
@@ -199,17 +316,19 @@ private:
                                     const std::vector<unsigned> &side_node_count,
                                     const std::vector<unsigned> &side_to_node_linkage,
                                     const std::vector<unsigned> &ghost_cell_type,
-                                    const std::vector<unsigned> &ghost_cell_to_node_linkage);
+                                    const std::vector<unsigned> &ghost_cell_to_node_linkage,
+                                    int n_threads);
 
-  //! Calculate a map of node vectors to indices (sides, ghost cells)
-  std::map<std::set<unsigned>, unsigned>
-  compute_node_vec_indx_map(const std::vector<unsigned> &indx_type,
-                            const std::vector<unsigned> &indx_to_node_linkage) const;
+  //! Calculate a hash table of node sets with their indices (sides, ghost cells)
+  Face_Hash_Table compute_node_vec_indx_map(const std::vector<unsigned> &indx_type,
+                                            const std::vector<unsigned> &indx_to_node_linkage,
+                                            std::vector<unsigned> &indx_of_key) const;
 
   //! Calculate cell-corner-cell layouts (adjacent cells not sharing a face)
   void compute_node_to_cell_linkage(const std::vector<unsigned> &ghost_cell_type,
                                     const std::vector<unsigned> &ghost_cell_to_node_linkage,
-                                    const std::vector<unsigned> &global_node_number);
+                                    const std::vector<unsigned> &global_node_number,
+                                    int n_threads);
 };
 
 } // end namespace rtt_mesh
@@ -10,6 +10,7 @@
 #ifndef rtt_mesh_Draco_Mesh_Builder_hh
 #define rtt_mesh_Draco_Mesh_Builder_hh
 
+#include "Draco_Mesh_Ordering.hh"
 #include "mesh_element/Geometry.hh"
 #include <memory>
 
@@ -27,6 +28,12 @@ class Draco_Mesh;
  * Reader is a template parameter ("FRT" = "Format Reader Type") to the builder class. Hence all
  * readers that instantiate the template must have a common set of accessors.  In particular the
  * reader must supply some functions in the RTT_Format_Reader class.
+ *
+ * build_mesh can gather the reader's data, and build the mesh, with several OpenMP threads.  The
+ * reader's accessors are then called concurrently, so they must not modify the reader.
+ *
+ * build_mesh can also renumber cells and nodes into a Mesh_Ordering for locality, returning the
+ * Mesh_Permutation from reader order so clients can move their fields into mesh order.
  */
 //================================================================================================//
 
@@ -43,7 +50,12 @@ public:
 
   // >>> SERVICES
 
-  std::shared_ptr<Draco_Mesh> build_mesh(rtt_mesh_element::Geometry geometry);
+  std::shared_ptr<Draco_Mesh> build_mesh(rtt_mesh_element::Geometry geometry,
+                                         const int n_threads = 1);
+
+  std::shared_ptr<Draco_Mesh> build_mesh(rtt_mesh_element::Geometry geometry,
+                                         Mesh_Ordering ordering, Mesh_Permutation &permutation,
+                                         const int n_threads = 1);
 };
 
 } // end namespace rtt_mesh
@@ -9,8 +9,10 @@
 
 #include "Draco_Mesh.hh"
 #include "Draco_Mesh_Builder.hh"
+#include "c4/c4_omp.h"
 #include "ds++/Assert.hh"
 #include <algorithm>
+#include <exception>
 #include <iostream>
 #include <numeric>
 
@@ -41,15 +43,46 @@ Draco_Mesh_Builder<FRT>::Draco_Mesh_Builder(std::shared_ptr<FRT> reader_) : read
 /*!
  * \brief Build a Draco_Mesh object
  *
+ * The loops over cells, sides and nodes are split over n_threads OpenMP threads.  Cell and side
+ * nodes are gathered per cell or side and then copied behind serial offsets, so the mesh
+ * constructor arguments are the same for any number of threads.  An exception thrown by the reader
+ * inside a threaded loop is rethrown after the loop.
+ *
+ * \param[in] geometry enumeration of mesh geometry
+ * \param[in] n_threads number of OpenMP threads, also used to construct the mesh
+ *
+ * \return shared pointer to the Draco_Mesh object
+ */
+template <typename FRT>
+std::shared_ptr<Draco_Mesh>
+Draco_Mesh_Builder<FRT>::build_mesh(rtt_mesh_element::Geometry geometry, const int n_threads) {
+  Mesh_Permutation permutation;
+  return build_mesh(geometry, Mesh_Ordering::READER, permutation, n_threads);
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Build a Draco_Mesh object with its cells and nodes in a given order
+ *
+ * The reader's data is renumbered by reorder_mesh_data before the mesh is constructed, so mesh
+ * cell c is reader cell permutation.old_cell[c] and mesh node n is reader node
+ * permutation.old_node[n].  Side order is unchanged, and the mesh's global node numbers remain
+ * the reader's node indices.
+ *
  * \param[in] geometry enumeration of mesh geometry
+ * \param[in] ordering cell ordering of the mesh
+ * \param[out] permutation cell and node renumbering from reader order to mesh order
+ * \param[in] n_threads number of OpenMP threads, also used to construct the mesh
  *
  * \return shared pointer to the Draco_Mesh object
  */
 template <typename FRT>
 std::shared_ptr<Draco_Mesh>
-Draco_Mesh_Builder<FRT>::build_mesh(rtt_mesh_element::Geometry geometry) {
+Draco_Mesh_Builder<FRT>::build_mesh(rtt_mesh_element::Geometry geometry, Mesh_Ordering ordering,
+                                    Mesh_Permutation &permutation, const int n_threads) {
 
   Require(geometry != rtt_mesh_element::Geometry::END_GEOMETRY);
+  Require(n_threads > 0);
 
   // >>> GENERATE MESH CONSTRUCTOR ARGUMENTS
 
@@ -63,96 +96,154 @@ Draco_Mesh_Builder<FRT>::build_mesh(rtt_mesh_element::Geometry geometry) {
 
   // generate the cell type vector
   std::vector<unsigned> num_faces_per_cell(num_cells);
-  for (size_t cell = 0; cell < num_cells; ++cell)
-    num_faces_per_cell[cell] = reader->get_celltype(cell);
+  std::exception_ptr loop_error;
+#ifdef OPENMP_FOUND
+#pragma omp parallel for num_threads(n_threads) schedule(static)
+#endif
+  for (size_t cell = 0; cell < num_cells; ++cell) {
+    try {
+      num_faces_per_cell[cell] = reader->get_celltype(cell);
+    } catch (...) {
+#ifdef OPENMP_FOUND
+#pragma omp critical(mesh_loop_error)
+#endif
+      if (!loop_error)
+        loop_error = std::current_exception();
+    }
+  }
+  if (loop_error)
+    std::rethrow_exception(loop_error);
 
   // \todo: Can the cell definitions past num_cells - 1 be checked as invalid?
 
-  // generate the cell-to-node linkage
-  std::vector<unsigned> cell_to_node_linkage;
-  for (size_t cell = 0; cell < num_cells; ++cell) {
+  // get the serial index of each cell's first face
+  std::vector<size_t> cell_face_offset(num_cells + 1, 0);
+  for (size_t cell = 0; cell < num_cells; ++cell)
+    cell_face_offset[cell + 1] = cell_face_offset[cell] + num_faces_per_cell[cell];
 
-    // insert the vector of node indices
-    const std::vector<unsigned> cell_nodes = reader->get_cellnodes(cell);
-    cell_to_node_linkage.insert(cell_to_node_linkage.end(), cell_nodes.begin(), cell_nodes.end());
+  // gather the node indices of each cell and the number of nodes of each of its faces
+  std::vector<std::vector<unsigned>> cell_nodes_per_cell(num_cells);
+  std::vector<unsigned> num_nodes_per_face_per_cell(cell_face_offset[num_cells]);
+#ifdef OPENMP_FOUND
+#pragma omp parallel for num_threads(n_threads) schedule(static)
+#endif
+  for (size_t cell = 0; cell < num_cells; ++cell) {
+    try {
+      // get the vector of node indices
+      cell_nodes_per_cell[cell] = reader->get_cellnodes(cell);
+
+      // store number of nodes for each face
+      for (unsigned face = 0; face < num_faces_per_cell[cell]; ++face)
+        num_nodes_per_face_per_cell[cell_face_offset[cell] + face] =
+            static_cast<unsigned>(reader->get_cellfacenodes(cell, face).size());
+    } catch (...) {
+#ifdef OPENMP_FOUND
+#pragma omp critical(mesh_loop_error)
+#endif
+      if (!loop_error)
+        loop_error = std::current_exception();
+    }
   }
+  if (loop_error)
+    std::rethrow_exception(loop_error);
+
+  // generate the cell-to-node linkage
+  std::vector<size_t> cell_node_offset(num_cells + 1, 0);
+  for (size_t cell = 0; cell < num_cells; ++cell)
+    cell_node_offset[cell + 1] = cell_node_offset[cell] + cell_nodes_per_cell[cell].size();
+
+  std::vector<unsigned> cell_to_node_linkage(cell_node_offset[num_cells]);
+#ifdef OPENMP_FOUND
+#pragma omp parallel for num_threads(n_threads) schedule(static)
+#endif
+  for (size_t cell = 0; cell < num_cells; ++cell)
+    std::copy(cell_nodes_per_cell[cell].begin(), cell_nodes_per_cell[cell].end(),
+              cell_to_node_linkage.begin() + cell_node_offset[cell]);
 
   // get the number of sides
   size_t num_sides = reader->get_numsides();
 
-  // generate the side node count vector
-  size_t sn_linkage_size = 0;
+  // generate the side node count, side flag and side node vectors
   std::vector<unsigned> side_node_count(num_sides);
   std::vector<unsigned> side_set_flag(num_sides);
+  std::vector<std::vector<unsigned>> side_nodes_per_side(num_sides);
+#ifdef OPENMP_FOUND
+#pragma omp parallel for num_threads(n_threads) schedule(static)
+#endif
   for (size_t side = 0; side < num_sides; ++side) {
-
-    // acquire the number of nodes associated with this side def
-    Check(reader->get_sidetype(side) < UINT_MAX);
-    side_node_count[side] = static_cast<unsigned>(reader->get_sidetype(side));
-
-    // this is not required in RTT meshes, but is so in Draco_Mesh
-    Check(dimension == 2 ? side_node_count[side] == 2 : true);
-
-    // get the 1st side flag associated with this side
-    // \todo: What happens when side has no flags?
-    side_set_flag[side] = reader->get_sideflag(side);
-
-    // increment size of cell-to-node linkage array
-    sn_linkage_size += side_node_count[side];
+    try {
+      // acquire the number of nodes associated with this side def
+      Check(reader->get_sidetype(side) < UINT_MAX);
+      side_node_count[side] = static_cast<unsigned>(reader->get_sidetype(side));
+
+      // this is not required in RTT meshes, but is so in Draco_Mesh
+      Check(dimension == 2 ? side_node_count[side] == 2 : true);
+
+      // get the 1st side flag associated with this side
+      // \todo: What happens when side has no flags?
+      side_set_flag[side] = reader->get_sideflag(side);
+
+      // get the vector of node indices
+      side_nodes_per_side[side] = reader->get_sidenodes(side);
+    } catch (...) {
+#ifdef OPENMP_FOUND
+#pragma omp critical(mesh_loop_error)
+#endif
+      if (!loop_error)
+        loop_error = std::current_exception();
+    }
   }
+  if (loop_error)
+    std::rethrow_exception(loop_error);
 
   // \todo: Can the side definitions past num_sides - 1 be checked as invalid?
 
   // generate the side-to-node linkage
-  std::vector<unsigned> side_to_node_linkage;
-  side_to_node_linkage.reserve(sn_linkage_size);
-  for (size_t side = 0; side < num_sides; ++side) {
+  std::vector<size_t> side_node_offset(num_sides + 1, 0);
+  for (size_t side = 0; side < num_sides; ++side)
+    side_node_offset[side + 1] = side_node_offset[side] + side_nodes_per_side[side].size();
 
-    // insert the vector of node indices
-    const std::vector<unsigned> side_nodes = reader->get_sidenodes(side);
-    side_to_node_linkage.insert(side_to_node_linkage.end(), side_nodes.begin(), side_nodes.end());
-  }
+  std::vector<unsigned> side_to_node_linkage(side_node_offset[num_sides]);
+#ifdef OPENMP_FOUND
+#pragma omp parallel for num_threads(n_threads) schedule(static)
+#endif
+  for (size_t side = 0; side < num_sides; ++side)
+    std::copy(side_nodes_per_side[side].begin(), side_nodes_per_side[side].end(),
+              side_to_node_linkage.begin() + side_node_offset[side]);
 
   // get the number of nodes
   size_t num_nodes = reader->get_numnodes();
 
   Check(num_nodes >= num_cells);
+  Check(num_nodes < UINT_MAX);
 
   // generate the global node number serialized vector of coordinates
   std::vector<unsigned> global_node_number(num_nodes);
   std::vector<double> coordinates(dimension * num_nodes);
+#ifdef OPENMP_FOUND
+#pragma omp parallel for num_threads(n_threads) schedule(static)
+#endif
   for (size_t node = 0; node < num_nodes; ++node) {
-
-    // set the "global" node indices
-    Check(node < UINT_MAX);
-    global_node_number[node] = static_cast<unsigned>(node);
-
-    // get coordinates for this node
-    const std::vector<double> node_coord = reader->get_nodecoord(node);
-
-    // populate coordinate vector
-    for (unsigned d = 0; d < dimension; ++d)
-      coordinates[dimension * node + d] = node_coord[d];
-  }
-
-  // reserve some space for num_nodes_per_face_per_cell
-  std::vector<unsigned> num_nodes_per_face_per_cell;
-  num_nodes_per_face_per_cell.reserve(
-      std::accumulate(num_faces_per_cell.begin(), num_faces_per_cell.end(), 0U));
-
-  // generate num_nodes_per_face_per_cell vector
-  unsigned cf_counter = 0;
-  for (size_t cell = 0; cell < num_cells; ++cell) {
-    for (unsigned face = 0; face < num_faces_per_cell[cell]; ++face) {
-
-      // store number of nodes for this face
-      num_nodes_per_face_per_cell.push_back(
-          static_cast<unsigned>(reader->get_cellfacenodes(cell, face).size()));
-
-      // increment counter
-      cf_counter++;
+    try {
+      // set the "global" node indices
+      global_node_number[node] = static_cast<unsigned>(node);
+
+      // get coordinates for this node
+      const std::vector<double> node_coord = reader->get_nodecoord(node);
+
+      // populate coordinate vector
+      for (unsigned d = 0; d < dimension; ++d)
+        coordinates[dimension * node + d] = node_coord[d];
+    } catch (...) {
+#ifdef OPENMP_FOUND
+#pragma omp critical(mesh_loop_error)
+#endif
+      if (!loop_error)
+        loop_error = std::current_exception();
     }
   }
+  if (loop_error)
+    std::rethrow_exception(loop_error);
 
   Remember(auto cn_minmax =
                std::minmax_element(cell_to_node_linkage.begin(), cell_to_node_linkage.end()));
@@ -161,11 +252,19 @@ Draco_Mesh_Builder<FRT>::build_mesh(rtt_mesh_element::Geometry geometry) {
   Ensure(*cn_minmax.second < num_nodes);
   Ensure(side_to_node_linkage.size() > 0 ? *sn_minmax.second < num_nodes : true);
 
+  // >>> REORDER THE MESH DATA
+
+  std::vector<unsigned> ghost_cell_to_node_linkage;
+  permutation = reorder_mesh_data(ordering, dimension, num_faces_per_cell, cell_to_node_linkage,
+                                  num_nodes_per_face_per_cell, side_to_node_linkage, coordinates,
+                                  global_node_number, ghost_cell_to_node_linkage);
+
   // >>> CONSTRUCT THE MESH
 
   std::shared_ptr<Draco_Mesh> mesh(new Draco_Mesh(
       dimension, geometry, num_faces_per_cell, cell_to_node_linkage, side_set_flag, side_node_count,
-      side_to_node_linkage, coordinates, global_node_number, num_nodes_per_face_per_cell));
+      side_to_node_linkage, coordinates, global_node_number, num_nodes_per_face_per_cell, {}, {},
+      {}, {}, n_threads));
 
   return mesh;
 }
@@ -0,0 +1,584 @@
+//--------------------------------------------*-C++-*---------------------------------------------//
+/*!
+ * \file   mesh/Draco_Mesh_Ordering.cc
+ * \author agent <agent@local>
+ * \date   Friday, Oct 16, 2026, 3:20 pm
+ * \brief  Cell and node reordering of Draco_Mesh constructor data.
+ * \note   Copyright (C) 2026 Triad National Security, LLC., All rights reserved. */
+//------------------------------------------------------------------------------------------------//
+
+#include "Draco_Mesh_Ordering.hh"
+#include "Face_Hash_Table.hh"
+#include "c4/C4_Functions.hh"
+#include "c4/Invert_Comm_Map.hh"
+#include "c4/swap.hh"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <numeric>
+#include <utility>
+
+namespace rtt_mesh {
+
+namespace {
+
+// Marks a node not yet reached by any cell while renumbering nodes.
+constexpr unsigned unnumbered_node = UINT_MAX;
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Convert quantized coordinates to the transposed Hilbert index, in place.
+ *
+ * This is Skilling's "AxesToTranspose" (AIP Conf. Proc. 707, 381 (2004)): afterwards interleaving
+ * the bits of x, most significant first, gives the cell's distance along the Hilbert curve.
+ *
+ * \param[in,out] x the coordinates, each in [0, 2^bits).
+ * \param[in] bits number of bits per coordinate.
+ * \param[in] dimension number of coordinates.
+ */
+void axes_to_transpose(uint32_t *x, unsigned bits, unsigned dimension) {
+  const uint32_t top = uint32_t(1) << (bits - 1);
+
+  // inverse undo
+  for (uint32_t q = top; q > 1; q >>= 1) {
+    const uint32_t p = q - 1;
+    for (unsigned d = 0; d < dimension; ++d) {
+      if (x[d] & q) {
+        x[0] ^= p;
+      } else {
+        const uint32_t t = (x[0] ^ x[d]) & p;
+        x[0] ^= t;
+        x[d] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  for (unsigned d = 1; d < dimension; ++d)
+    x[d] ^= x[d - 1];
+  uint32_t t = 0;
+  for (uint32_t q = top; q > 1; q >>= 1)
+    if (x[dimension - 1] & q)
+      t ^= q - 1;
+  for (unsigned d = 0; d < dimension; ++d)
+    x[d] ^= t;
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Order cells along a space-filling curve through their centroids.
+ *
+ * A cell's centroid is the mean of its face-node entries.  Centroids are quantized onto a 2^bits
+ * grid per dimension over the nodes' bounding box (bits = 21 in 3D, so a key fits in 64 bits),
+ * and cells sort by curve key, ties keeping reader order.
+ *
+ * \param[in] hilbert true for the Hilbert curve, false for the Morton curve.
+ * \param[in] dimension mesh dimension.
+ * \param[in] num_faces_per_cell number of faces of each cell.
+ * \param[in] cell_to_node_linkage face nodes of each cell.
+ * \param[in] num_nodes_per_face_per_cell number of nodes of each face of each cell.
+ * \param[in] coordinates node coordinates.
+ *
+ * \return reader indices of the cells in curve order.
+ */
+std::vector<unsigned> curve_cell_order(bool hilbert, unsigned dimension,
+                                       const std::vector<unsigned> &num_faces_per_cell,
+                                       const std::vector<unsigned> &cell_to_node_linkage,
+                                       const std::vector<unsigned> &num_nodes_per_face_per_cell,
+                                       const std::vector<double> &coordinates) {
+  Require(dimension > 0 && dimension <= 3);
+  Require(coordinates.size() % dimension == 0);
+
+  const size_t num_cells = num_faces_per_cell.size();
+  const size_t num_nodes = coordinates.size() / dimension;
+  const unsigned bits = std::min(32u, 64u / dimension);
+  const double max_grid = std::ldexp(1.0, static_cast<int>(bits)) - 1.0;
+
+  // bounding box of the nodes
+  std::vector<double> lo(dimension, 0.0);
+  std::vector<double> scale(dimension, 0.0);
+  for (unsigned d = 0; d < dimension; ++d) {
+    double hi = lo[d];
+    if (num_nodes > 0) {
+      lo[d] = hi = coordinates[d];
+      for (size_t node = 1; node < num_nodes; ++node) {
+        lo[d] = std::min(lo[d], coordinates[node * dimension + d]);
+        hi = std::max(hi, coordinates[node * dimension + d]);
+      }
+    }
+    scale[d] = hi > lo[d] ? max_grid / (hi - lo[d]) : 0.0;
+  }
+
+  std::vector<std::pair<uint64_t, unsigned>> cell_keys(num_cells);
+  size_t face = 0;
+  size_t cn_offset = 0;
+  for (unsigned cell = 0; cell < num_cells; ++cell) {
+
+    // centroid of the cell's face-node entries
+    double centroid[3] = {0.0, 0.0, 0.0};
+    size_t num_entries = 0;
+    for (unsigned f = 0; f < num_faces_per_cell[cell]; ++f, ++face) {
+      for (unsigned i = 0; i < num_nodes_per_face_per_cell[face]; ++i) {
+        const unsigned node = cell_to_node_linkage[cn_offset + i];
+        Check(node < num_nodes);
+        for (unsigned d = 0; d < dimension; ++d)
+          centroid[d] += coordinates[node * dimension + d];
+      }
+      cn_offset += num_nodes_per_face_per_cell[face];
+      num_entries += num_nodes_per_face_per_cell[face];
+    }
+
+    uint32_t grid[3] = {0, 0, 0};
+    for (unsigned d = 0; d < dimension; ++d) {
+      const double mean = num_entries > 0 ? centroid[d] / static_cast<double>(num_entries) : 0.0;
+      const double g = std::floor((mean - lo[d]) * scale[d] + 0.5);
+      grid[d] = static_cast<uint32_t>(std::min(std::max(g, 0.0), max_grid));
+    }
+    if (hilbert)
+      axes_to_transpose(grid, bits, dimension);
+
+    // interleave the coordinate bits, most significant first
+    uint64_t key = 0;
+    for (unsigned b = bits; b-- > 0;)
+      for (unsigned d = 0; d < dimension; ++d)
+        key = (key << 1) | ((grid[d] >> b) & 1u);
+
+    cell_keys[cell] = std::make_pair(key, cell);
+  }
+  Check(cn_offset == cell_to_node_linkage.size());
+
+  std::sort(cell_keys.begin(), cell_keys.end());
+
+  std::vector<unsigned> order(num_cells);
+  for (size_t c = 0; c < num_cells; ++c)
+    order[c] = cell_keys[c].second;
+  return order;
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Breadth-first search of the unvisited cells reachable from a root.
+ *
+ * \param[in] root first cell of the search.
+ * \param[in] adj_offset CSR offsets of each cell's neighbors.
+ * \param[in] adj neighbors of each cell, sorted by increasing degree.
+ * \param[in] visited nonzero for cells already ordered (not searched).
+ * \param[in,out] level BFS level of each searched cell; UINT_MAX on entry for unsearched cells.
+ * \param[out] queue the searched cells in BFS order.
+ *
+ * \return position in queue of the first cell of the last level.
+ */
+size_t bfs_levels(unsigned root, const std::vector<size_t> &adj_offset,
+                  const std::vector<unsigned> &adj, const std::vector<char> &visited,
+                  std::vector<unsigned> &level, std::vector<unsigned> &queue) {
+  queue.clear();
+  queue.push_back(root);
+  level[root] = 0;
+  size_t last_level = 0;
+  for (size_t head = 0; head < queue.size(); ++head) {
+    const unsigned cell = queue[head];
+    if (level[cell] != level[queue[last_level]])
+      last_level = head;
+    for (size_t a = adj_offset[cell]; a < adj_offset[cell + 1]; ++a) {
+      const unsigned nbr = adj[a];
+      if (!visited[nbr] && level[nbr] == UINT_MAX) {
+        level[nbr] = level[cell] + 1;
+        queue.push_back(nbr);
+      }
+    }
+  }
+  return last_level;
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Order cells by reverse Cuthill-McKee on the face-adjacency graph.
+ *
+ * Cells sharing a face node set are adjacent.  Each connected component is searched breadth-first
+ * from a pseudo-peripheral cell (found by the George-Liu iteration), visiting neighbors in order
+ * of increasing degree, and the concatenated order is reversed.
+ *
+ * \param[in] num_faces_per_cell number of faces of each cell.
+ * \param[in] cell_to_node_linkage face nodes of each cell.
+ * \param[in] num_nodes_per_face_per_cell number of nodes of each face of each cell.
+ *
+ * \return reader indices of the cells in RCM order.
+ */
+std::vector<unsigned> rcm_cell_order(const std::vector<unsigned> &num_faces_per_cell,
+                                     const std::vector<unsigned> &cell_to_node_linkage,
+                                     const std::vector<unsigned> &num_nodes_per_face_per_cell) {
+
+  const auto num_cells = static_cast<unsigned>(num_faces_per_cell.size());
+
+  // match faces to find the adjacent cell pairs
+  Face_Hash_Table faces(num_nodes_per_face_per_cell.size() / 2 + 1);
+  std::vector<unsigned> key_cell;
+  key_cell.reserve(num_nodes_per_face_per_cell.size() / 2 + 1);
+  std::vector<std::pair<unsigned, unsigned>> cell_pairs;
+  cell_pairs.reserve(num_nodes_per_face_per_cell.size() / 2);
+  size_t face = 0;
+  size_t cn_offset = 0;
+  for (unsigned cell = 0; cell < num_cells; ++cell) {
+    for (unsigned f = 0; f < num_faces_per_cell[cell]; ++f, ++face) {
+      const unsigned key =
+          faces.insert(&cell_to_node_linkage[cn_offset], num_nodes_per_face_per_cell[face]);
+      cn_offset += num_nodes_per_face_per_cell[face];
+      if (key == key_cell.size())
+        key_cell.push_back(cell);
+      else if (key_cell[key] != cell)
+        cell_pairs.emplace_back(key_cell[key], cell);
+    }
+  }
+
+  // symmetric CSR adjacency, each neighbor list sorted by (degree, index)
+  std::vector<size_t> adj_offset(num_cells + 1, 0);
+  for (const auto &cell_pair : cell_pairs) {
+    ++adj_offset[cell_pair.first + 1];
+    ++adj_offset[cell_pair.second + 1];
+  }
+  std::partial_sum(adj_offset.begin(), adj_offset.end(), adj_offset.begin());
+  std::vector<unsigned> adj(adj_offset[num_cells]);
+  {
+    std::vector<size_t> next(adj_offset.begin(), adj_offset.end() - 1);
+    for (const auto &cell_pair : cell_pairs) {
+      adj[next[cell_pair.first]++] = cell_pair.second;
+      adj[next[cell_pair.second]++] = cell_pair.first;
+    }
+  }
+  auto degree = [&adj_offset](unsigned cell) { return adj_offset[cell + 1] - adj_offset[cell]; };
+  for (unsigned cell = 0; cell < num_cells; ++cell)
+    std::sort(adj.begin() + static_cast<std::ptrdiff_t>(adj_offset[cell]),
+              adj.begin() + static_cast<std::ptrdiff_t>(adj_offset[cell + 1]),
+              [&degree](unsigned a, unsigned b) {
+                return degree(a) < degree(b) || (degree(a) == degree(b) && a < b);
+              });
+
+  std::vector<unsigned> order;
+  order.reserve(num_cells);
+  std::vector<char> visited(num_cells, 0);
+  std::vector<unsigned> level(num_cells, UINT_MAX);
+  std::vector<unsigned> queue;
+  for (unsigned seed = 0; seed < num_cells; ++seed) {
+    if (visited[seed])
+      continue;
+
+    // find a pseudo-peripheral root of the seed's component
+    unsigned root = seed;
+    size_t last_level = bfs_levels(root, adj_offset, adj, visited, level, queue);
+    while (true) {
+      const unsigned depth = level[queue.back()];
+      unsigned candidate = queue[last_level];
+      for (size_t q = last_level + 1; q < queue.size(); ++q)
+        if (degree(queue[q]) < degree(candidate))
+          candidate = queue[q];
+      for (const unsigned cell : queue)
+        level[cell] = UINT_MAX;
+      const size_t candidate_last = bfs_levels(candidate, adj_offset, adj, visited, level, queue);
+      if (level[queue.back()] <= depth) {
+        for (const unsigned cell : queue)
+          level[cell] = UINT_MAX;
+        break;
+      }
+      root = candidate;
+      last_level = candidate_last;
+    }
+
+    // Cuthill-McKee order of the component
+    const size_t begin = order.size();
+    order.push_back(root);
+    visited[root] = 1;
+    for (size_t head = begin; head < order.size(); ++head) {
+      const unsigned cell = order[head];
+      for (size_t a = adj_offset[cell]; a < adj_offset[cell + 1]; ++a) {
+        if (!visited[adj[a]]) {
+          visited[adj[a]] = 1;
+          order.push_back(adj[a]);
+        }
+      }
+    }
+  }
+  Check(order.size() == num_cells);
+
+  std::reverse(order.begin(), order.end());
+  return order;
+}
+
+//------------------------------------------------------------------------------------------------//
+//! Replace each node index in a linkage by its mesh index.
+void renumber_nodes(const std::vector<unsigned> &new_node, std::vector<unsigned> &linkage) {
+  for (unsigned &node : linkage) {
+    Check(node < new_node.size());
+    node = new_node[node];
+  }
+}
+
+} // end anonymous namespace
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Compute the order of the cells in a mesh ordering.
+ *
+ * \param[in] ordering the cell ordering.
+ * \param[in] dimension mesh dimension.
+ * \param[in] num_faces_per_cell number of faces of each cell.
+ * \param[in] cell_to_node_linkage face nodes of each cell.
+ * \param[in] num_nodes_per_face_per_cell number of nodes of each face of each cell.
+ * \param[in] coordinates node coordinates.
+ *
+ * \return reader indices of the cells in mesh order.
+ */
+std::vector<unsigned> compute_cell_order(Mesh_Ordering ordering, unsigned dimension,
+                                         const std::vector<unsigned> &num_faces_per_cell,
+                                         const std::vector<unsigned> &cell_to_node_linkage,
+                                         const std::vector<unsigned> &num_nodes_per_face_per_cell,
+                                         const std::vector<double> &coordinates) {
+  Require(num_nodes_per_face_per_cell.size() ==
+          std::accumulate(num_faces_per_cell.begin(), num_faces_per_cell.end(), 0u));
+  Require(cell_to_node_linkage.size() == std::accumulate(num_nodes_per_face_per_cell.begin(),
+                                                         num_nodes_per_face_per_cell.end(), 0u));
+
+  std::vector<unsigned> order;
+  switch (ordering) {
+  case Mesh_Ordering::READER:
+    order.resize(num_faces_per_cell.size());
+    std::iota(order.begin(), order.end(), 0u);
+    break;
+  case Mesh_Ordering::MORTON:
+  case Mesh_Ordering::HILBERT:
+    order = curve_cell_order(ordering == Mesh_Ordering::HILBERT, dimension, num_faces_per_cell,
+                             cell_to_node_linkage, num_nodes_per_face_per_cell, coordinates);
+    break;
+  case Mesh_Ordering::RCM:
+    order = rcm_cell_order(num_faces_per_cell, cell_to_node_linkage, num_nodes_per_face_per_cell);
+    break;
+  default:
+    Insist(false, "Unknown mesh ordering.");
+  }
+
+  Ensure(order.size() == num_faces_per_cell.size());
+  return order;
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Renumber Draco_Mesh constructor data in place into a mesh ordering.
+ *
+ * Cells are permuted into compute_cell_order's order, each keeping its faces and face nodes in
+ * reader order.  Nodes are then numbered in order of first reference by the permuted cells, with
+ * any unreferenced nodes last in reader order, so cell-to-node accesses also walk memory forward.
+ * The READER ordering leaves all data unchanged.
+ *
+ * Sides and ghost cells keep their reader order, so per-side data (side set flags, side node
+ * counts) and per-ghost data (types, ranks) stay valid; only the node indices in their linkages
+ * are renumbered.  Ghost cell numbers index cells on other ranks, so they are renumbered
+ * separately by remap_ghost_cell_numbers once every rank has chosen its permutation.
+ * global_node_number moves with the nodes, so node identities across ranks are unchanged.
+ *
+ * \param[in] ordering the cell ordering.
+ * \param[in] dimension mesh dimension.
+ * \param[in,out] num_faces_per_cell number of faces of each cell.
+ * \param[in,out] cell_to_node_linkage face nodes of each cell.
+ * \param[in,out] num_nodes_per_face_per_cell number of nodes of each face of each cell.
+ * \param[in,out] side_to_node_linkage nodes of each side.
+ * \param[in,out] coordinates node coordinates.
+ * \param[in,out] global_node_number global index of each node.
+ * \param[in,out] ghost_cell_to_node_linkage nodes of each ghost cell's face.
+ *
+ * \return the cell and node permutation, for remapping client fields.
+ */
+Mesh_Permutation reorder_mesh_data(Mesh_Ordering ordering, unsigned dimension,
+                                   std::vector<unsigned> &num_faces_per_cell,
+                                   std::vector<unsigned> &cell_to_node_linkage,
+                                   std::vector<unsigned> &num_nodes_per_face_per_cell,
+                                   std::vector<unsigned> &side_to_node_linkage,
+                                   std::vector<double> &coordinates,
+                                   std::vector<unsigned> &global_node_number,
+                                   std::vector<unsigned> &ghost_cell_to_node_linkage) {
+  Require(dimension > 0 && dimension <= 3);
+  Require(coordinates.size() == dimension * global_node_number.size());
+
+  const size_t num_cells = num_faces_per_cell.size();
+  const size_t num_nodes = global_node_number.size();
+
+  Mesh_Permutation permutation;
+  permutation.old_cell = compute_cell_order(ordering, dimension, num_faces_per_cell,
+                                            cell_to_node_linkage, num_nodes_per_face_per_cell,
+                                            coordinates);
+  permutation.new_cell.resize(num_cells);
+  for (unsigned cell = 0; cell < num_cells; ++cell)
+    permutation.new_cell[permutation.old_cell[cell]] = cell;
+
+  if (ordering == Mesh_Ordering::READER) {
+    permutation.old_node.resize(num_nodes);
+    std::iota(permutation.old_node.begin(), permutation.old_node.end(), 0u);
+    permutation.new_node = permutation.old_node;
+    return permutation;
+  }
+
+  // offsets of each reader cell's faces and face nodes
+  std::vector<size_t> cell_face_offset(num_cells + 1, 0);
+  std::partial_sum(num_faces_per_cell.begin(), num_faces_per_cell.end(),
+                   cell_face_offset.begin() + 1);
+  std::vector<size_t> cell_node_offset(num_cells + 1, 0);
+  for (size_t cell = 0; cell < num_cells; ++cell)
+    cell_node_offset[cell + 1] =
+        cell_node_offset[cell] +
+        std::accumulate(
+            num_nodes_per_face_per_cell.begin() +
+                static_cast<std::ptrdiff_t>(cell_face_offset[cell]),
+            num_nodes_per_face_per_cell.begin() +
+                static_cast<std::ptrdiff_t>(cell_face_offset[cell + 1]),
+            size_t(0));
+
+  // move each cell's face block to its new position
+  std::vector<unsigned> mesh_num_faces_per_cell(num_cells);
+  std::vector<unsigned> mesh_cell_to_node_linkage;
+  mesh_cell_to_node_linkage.reserve(cell_to_node_linkage.size());
+  std::vector<unsigned> mesh_num_nodes_per_face_per_cell;
+  mesh_num_nodes_per_face_per_cell.reserve(num_nodes_per_face_per_cell.size());
+  for (size_t cell = 0; cell < num_cells; ++cell) {
+    const unsigned old = permutation.old_cell[cell];
+    mesh_num_faces_per_cell[cell] = num_faces_per_cell[old];
+    mesh_num_nodes_per_face_per_cell.insert(
+        mesh_num_nodes_per_face_per_cell.end(),
+        num_nodes_per_face_per_cell.begin() + static_cast<std::ptrdiff_t>(cell_face_offset[old]),
+        num_nodes_per_face_per_cell.begin() +
+            static_cast<std::ptrdiff_t>(cell_face_offset[old + 1]));
+    mesh_cell_to_node_linkage.insert(
+        mesh_cell_to_node_linkage.end(),
+        cell_to_node_linkage.begin() + static_cast<std::ptrdiff_t>(cell_node_offset[old]),
+        cell_to_node_linkage.begin() + static_cast<std::ptrdiff_t>(cell_node_offset[old + 1]));
+  }
+
+  // number nodes by first reference from the permuted cells
+  permutation.new_node.assign(num_nodes, unnumbered_node);
+  permutation.old_node.reserve(num_nodes);
+  for (const unsigned node : mesh_cell_to_node_linkage) {
+    Check(node < num_nodes);
+    if (permutation.new_node[node] == unnumbered_node) {
+      permutation.new_node[node] = static_cast<unsigned>(permutation.old_node.size());
+      permutation.old_node.push_back(node);
+    }
+  }
+  for (unsigned node = 0; node < num_nodes; ++node) {
+    if (permutation.new_node[node] == unnumbered_node) {
+      permutation.new_node[node] = static_cast<unsigned>(permutation.old_node.size());
+      permutation.old_node.push_back(node);
+    }
+  }
+  Check(permutation.old_node.size() == num_nodes);
+
+  renumber_nodes(permutation.new_node, mesh_cell_to_node_linkage);
+  renumber_nodes(permutation.new_node, side_to_node_linkage);
+  renumber_nodes(permutation.new_node, ghost_cell_to_node_linkage);
+
+  std::vector<double> mesh_coordinates(coordinates.size());
+  for (size_t node = 0; node < num_nodes; ++node)
+    for (unsigned d = 0; d < dimension; ++d)
+      mesh_coordinates[node * dimension + d] =
+          coordinates[permutation.old_node[node] * dimension + d];
+
+  num_faces_per_cell.swap(mesh_num_faces_per_cell);
+  cell_to_node_linkage.swap(mesh_cell_to_node_linkage);
+  num_nodes_per_face_per_cell.swap(mesh_num_nodes_per_face_per_cell);
+  coordinates.swap(mesh_coordinates);
+  global_node_number = permutation.node_field(global_node_number);
+
+  Ensure(permutation.old_cell.size() == num_cells);
+  Ensure(permutation.new_node.size() == num_nodes);
+  return permutation;
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Renumber ghost cell numbers into their owning ranks' mesh order.
+ *
+ * A ghost cell number is a cell index local to the ghost's rank, so after each rank reorders its
+ * cells with reorder_mesh_data the numbers must be mapped through the owning rank's new_cell.  Each
+ * rank sends the distinct cell numbers it references to their owners (point-to-point), and each
+ * owner returns their new numbers, so the traffic scales with the number of ghost cells.  Every rank
+ * must call this function.
+ *
+ * \param[in] permutation this rank's permutation from reorder_mesh_data.
+ * \param[in] ghost_cell_rank owning rank of each ghost cell.
+ * \param[in,out] ghost_cell_number local index of each ghost cell on its owning rank.
+ */
+void remap_ghost_cell_numbers(const Mesh_Permutation &permutation,
+                              const std::vector<int> &ghost_cell_rank,
+                              std::vector<int> &ghost_cell_number) {
+  Require(ghost_cell_rank.size() == ghost_cell_number.size());
+
+  const int rank = rtt_c4::node();
+
+  // the distinct cells referenced on each other rank, in increasing order
+  std::map<int, std::vector<unsigned>> cells_per_owner;
+  for (size_t g = 0; g < ghost_cell_number.size(); ++g) {
+    Check(ghost_cell_rank[g] >= 0 && ghost_cell_rank[g] < rtt_c4::nodes());
+    Check(ghost_cell_number[g] >= 0);
+    if (ghost_cell_rank[g] != rank)
+      cells_per_owner[ghost_cell_rank[g]].push_back(static_cast<unsigned>(ghost_cell_number[g]));
+  }
+
+  rtt_c4::Invert_Comm_Map_t to_map;
+  std::vector<unsigned> owner_ranks;
+  std::vector<std::vector<unsigned>> owner_cells;
+  for (auto &owner : cells_per_owner) {
+    std::vector<unsigned> &cells = owner.second;
+    std::sort(cells.begin(), cells.end());
+    cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+    to_map[owner.first] = cells.size();
+    owner_ranks.push_back(static_cast<unsigned>(owner.first));
+    owner_cells.push_back(std::move(cells));
+  }
+
+  // find the ranks that reference cells of this rank, and receive their cell lists
+  rtt_c4::Invert_Comm_Map_t from_map;
+  rtt_c4::invert_comm_map(to_map, from_map);
+  std::vector<unsigned> client_ranks;
+  std::vector<std::vector<unsigned>> client_cells;
+  for (const auto &client : from_map) {
+    client_ranks.push_back(static_cast<unsigned>(client.first));
+    client_cells.emplace_back(client.second);
+  }
+  rtt_c4::determinate_swap(owner_ranks, owner_cells, client_ranks, client_cells);
+
+  // renumber the referenced cells into this rank's mesh order and return them (each rank's request
+  // message to an owner is sent before its reply, so the two exchanges can share a tag)
+  for (std::vector<unsigned> &cells : client_cells) {
+    for (unsigned &cell : cells) {
+      Check(cell < permutation.new_cell.size());
+      cell = permutation.new_cell[cell];
+    }
+  }
+  std::vector<std::vector<unsigned>> owner_new_cells(owner_cells.size());
+  for (size_t owner = 0; owner < owner_cells.size(); ++owner)
+    owner_new_cells[owner].resize(owner_cells[owner].size());
+  rtt_c4::determinate_swap(client_ranks, client_cells, owner_ranks, owner_new_cells);
+
+  for (size_t g = 0; g < ghost_cell_number.size(); ++g) {
+    const auto cell = static_cast<unsigned>(ghost_cell_number[g]);
+    if (ghost_cell_rank[g] == rank) {
+      Check(cell < permutation.new_cell.size());
+      ghost_cell_number[g] = static_cast<int>(permutation.new_cell[cell]);
+      continue;
+    }
+    const auto owner = static_cast<size_t>(
+        std::lower_bound(owner_ranks.begin(), owner_ranks.end(),
+                         static_cast<unsigned>(ghost_cell_rank[g])) -
+        owner_ranks.begin());
+    Check(owner < owner_ranks.size());
+    const std::vector<unsigned> &cells = owner_cells[owner];
+    const auto index =
+        static_cast<size_t>(std::lower_bound(cells.begin(), cells.end(), cell) - cells.begin());
+    Check(index < cells.size() && cells[index] == cell);
+    ghost_cell_number[g] = static_cast<int>(owner_new_cells[owner][index]);
+  }
+}
+
+} // end namespace rtt_mesh
+
+//------------------------------------------------------------------------------------------------//
+// end of mesh/Draco_Mesh_Ordering.cc
+//------------------------------------------------------------------------------------------------//
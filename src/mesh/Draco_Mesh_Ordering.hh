@@ -0,0 +1,99 @@
+//--------------------------------------------*-C++-*---------------------------------------------//
+/*!
+ * \file   mesh/Draco_Mesh_Ordering.hh
+ * \author agent <agent@local>
+ * \date   Friday, Oct 16, 2026, 3:20 pm
+ * \brief  Cell and node reordering of Draco_Mesh constructor data.
+ * \note   Copyright (C) 2026 Triad National Security, LLC., All rights reserved. */
+//------------------------------------------------------------------------------------------------//
+
+#ifndef rtt_mesh_Draco_Mesh_Ordering_hh
+#define rtt_mesh_Draco_Mesh_Ordering_hh
+
+#include "ds++/Assert.hh"
+#include <vector>
+
+namespace rtt_mesh {
+
+//! Cell orderings a Draco_Mesh may be built with.
+enum class Mesh_Ordering {
+  READER,  //!< keep the reader's cell and node order
+  MORTON,  //!< sort cells along a Morton (Z-order) curve through their centroids
+  HILBERT, //!< sort cells along a Hilbert curve through their centroids
+  RCM      //!< reverse Cuthill-McKee order of the cell face-adjacency graph
+};
+
+//================================================================================================//
+/*!
+ * \struct Mesh_Permutation
+ *
+ * \brief Cell and node renumbering between reader order and mesh order.
+ *
+ * new_cell[c] is the mesh index of reader cell c and old_cell[c] is the reader index of mesh cell
+ * c, and likewise for nodes.  Fields a client holds in reader order are moved to mesh order with
+ * cell_field() and node_field().
+ */
+//================================================================================================//
+
+struct Mesh_Permutation {
+  //! Reader index of each mesh cell.
+  std::vector<unsigned> old_cell;
+  //! Mesh index of each reader cell.
+  std::vector<unsigned> new_cell;
+  //! Reader index of each mesh node.
+  std::vector<unsigned> old_node;
+  //! Mesh index of each reader node.
+  std::vector<unsigned> new_node;
+
+  //! Reorder a per-cell field from reader order to mesh order.
+  template <typename T> std::vector<T> cell_field(const std::vector<T> &reader_field) const {
+    return permute(old_cell, reader_field);
+  }
+
+  //! Reorder a per-node field from reader order to mesh order.
+  template <typename T> std::vector<T> node_field(const std::vector<T> &reader_field) const {
+    return permute(old_node, reader_field);
+  }
+
+private:
+  template <typename T>
+  static std::vector<T> permute(const std::vector<unsigned> &old_index,
+                                const std::vector<T> &reader_field) {
+    Require(reader_field.size() == old_index.size());
+    std::vector<T> mesh_field;
+    mesh_field.reserve(reader_field.size());
+    for (const unsigned old : old_index)
+      mesh_field.push_back(reader_field[old]);
+    return mesh_field;
+  }
+};
+
+//! Reader indices of the cells in the order given by an ordering.
+std::vector<unsigned> compute_cell_order(Mesh_Ordering ordering, unsigned dimension,
+                                         const std::vector<unsigned> &num_faces_per_cell,
+                                         const std::vector<unsigned> &cell_to_node_linkage,
+                                         const std::vector<unsigned> &num_nodes_per_face_per_cell,
+                                         const std::vector<double> &coordinates);
+
+//! Renumber Draco_Mesh constructor data in place into an ordering, returning the permutation.
+Mesh_Permutation reorder_mesh_data(Mesh_Ordering ordering, unsigned dimension,
+                                   std::vector<unsigned> &num_faces_per_cell,
+                                   std::vector<unsigned> &cell_to_node_linkage,
+                                   std::vector<unsigned> &num_nodes_per_face_per_cell,
+                                   std::vector<unsigned> &side_to_node_linkage,
+                                   std::vector<double> &coordinates,
+                                   std::vector<unsigned> &global_node_number,
+                                   std::vector<unsigned> &ghost_cell_to_node_linkage);
+
+//! Renumber ghost cells' local indices on their owning ranks into mesh order (collective).
+void remap_ghost_cell_numbers(const Mesh_Permutation &permutation,
+                              const std::vector<int> &ghost_cell_rank,
+                              std::vector<int> &ghost_cell_number);
+
+} // end namespace rtt_mesh
+
+#endif // rtt_mesh_Draco_Mesh_Ordering_hh
+
+//------------------------------------------------------------------------------------------------//
+// end of mesh/Draco_Mesh_Ordering.hh
+//------------------------------------------------------------------------------------------------//
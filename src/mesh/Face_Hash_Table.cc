@@ -0,0 +1,205 @@
+//--------------------------------------------*-C++-*---------------------------------------------//
+/*!
+ * \file   mesh/Face_Hash_Table.cc
+ * \author agent <agent@local>
+ * \date   Friday, Oct 16, 2026, 10:12 am
+ * \brief  Face_Hash_Table class implementation file.
+ * \note   Copyright (C) 2026 Triad National Security, LLC., All rights reserved. */
+//------------------------------------------------------------------------------------------------//
+
+#include "Face_Hash_Table.hh"
+#include "ds++/Assert.hh"
+#include <algorithm>
+
+namespace rtt_mesh {
+
+constexpr unsigned Face_Hash_Table::npos;
+
+// Faces with at most this many nodes are canonicalized on the stack.
+constexpr unsigned face_key_stack_size = 16;
+
+//------------------------------------------------------------------------------------------------//
+// CONSTRUCTOR
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Face_Hash_Table constructor.
+ *
+ * \param[in] expected_faces number of distinct faces the table should hold without growing.
+ */
+Face_Hash_Table::Face_Hash_Table(size_t expected_faces) : key_offset(1, 0) {
+
+  // keep the table at most half full
+  size_t num_slots = 16;
+  while (num_slots < 2 * expected_faces)
+    num_slots *= 2;
+  slots.assign(num_slots, npos);
+
+  key_offset.reserve(expected_faces + 1);
+  key_hash.reserve(expected_faces);
+}
+
+//------------------------------------------------------------------------------------------------//
+// PUBLIC FUNCTIONS
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Return the key index of a face, adding the face if its node set is new.
+ *
+ * \param[in] nodes the face's node indices, in any order and possibly repeated.
+ * \param[in] count number of entries in nodes.
+ *
+ * \return the key index of the face's node set.
+ */
+unsigned Face_Hash_Table::insert(const unsigned *nodes, unsigned count) {
+  Require(count > 0);
+
+  unsigned stack_key[face_key_stack_size];
+  std::vector<unsigned> heap_key(count > face_key_stack_size ? count : 0);
+  unsigned *const key = count > face_key_stack_size ? heap_key.data() : stack_key;
+  const unsigned key_count = canonical_key(nodes, count, key);
+  const uint64_t hash = hash_key(key, key_count);
+
+  size_t slot = probe(key, key_count, hash);
+  if (slots[slot] != npos)
+    return slots[slot];
+
+  // add a new key, growing first if that would make the table more than half full
+  if (2 * (key_hash.size() + 1) > slots.size()) {
+    grow();
+    slot = probe(key, key_count, hash);
+  }
+  Check(key_hash.size() < npos);
+  const auto new_key = static_cast<unsigned>(key_hash.size());
+  slots[slot] = new_key;
+  node_keys.insert(node_keys.end(), key, key + key_count);
+  key_offset.push_back(node_keys.size());
+  key_hash.push_back(hash);
+
+  Ensure(size() == new_key + 1);
+  return new_key;
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Return the key index of a face.
+ *
+ * \param[in] nodes the face's node indices, in any order and possibly repeated.
+ * \param[in] count number of entries in nodes.
+ *
+ * \return the key index of the face's node set, or npos if it has not been inserted.
+ */
+unsigned Face_Hash_Table::find(const unsigned *nodes, unsigned count) const {
+  Require(count > 0);
+
+  unsigned stack_key[face_key_stack_size];
+  std::vector<unsigned> heap_key(count > face_key_stack_size ? count : 0);
+  unsigned *const key = count > face_key_stack_size ? heap_key.data() : stack_key;
+  const unsigned key_count = canonical_key(nodes, count, key);
+
+  return slots[probe(key, key_count, hash_key(key, key_count))];
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Hash a face's node set.
+ *
+ * \param[in] nodes the face's node indices, in any order and possibly repeated.
+ * \param[in] count number of entries in nodes.
+ *
+ * \return the 64-bit hash insert() and find() use for the face.
+ */
+uint64_t Face_Hash_Table::hash(const unsigned *nodes, unsigned count) {
+  Require(count > 0);
+
+  unsigned stack_key[face_key_stack_size];
+  std::vector<unsigned> heap_key(count > face_key_stack_size ? count : 0);
+  unsigned *const key = count > face_key_stack_size ? heap_key.data() : stack_key;
+  return hash_key(key, canonical_key(nodes, count, key));
+}
+
+//------------------------------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Copy a face's nodes into key, sorted and without duplicates.
+ *
+ * \param[in] nodes the face's node indices.
+ * \param[in] count number of entries in nodes.
+ * \param[out] key storage for at least count node indices.
+ *
+ * \return number of unique nodes written to key.
+ */
+unsigned Face_Hash_Table::canonical_key(const unsigned *nodes, unsigned count, unsigned *key) {
+  std::copy(nodes, nodes + count, key);
+
+  // faces are small, so insertion sort beats std::sort here
+  for (unsigned i = 1; i < count; ++i) {
+    const unsigned node = key[i];
+    unsigned j = i;
+    for (; j > 0 && key[j - 1] > node; --j)
+      key[j] = key[j - 1];
+    key[j] = node;
+  }
+
+  return static_cast<unsigned>(std::unique(key, key + count) - key);
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Hash a canonical key.
+ *
+ * \param[in] key sorted, unique node indices.
+ * \param[in] count number of entries in key.
+ *
+ * \return a 64-bit hash of the node set.
+ */
+uint64_t Face_Hash_Table::hash_key(const unsigned *key, unsigned count) {
+  uint64_t hash = count;
+  for (unsigned i = 0; i < count; ++i)
+    hash = (hash ^ key[i]) * 0x9E3779B97F4A7C15ULL;
+
+  // fold the well-mixed high bits into the low bits used for the slot index
+  return hash ^ (hash >> 29);
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Find the slot of a canonical key by linear probing.
+ *
+ * \param[in] key sorted, unique node indices.
+ * \param[in] count number of entries in key.
+ * \param[in] hash hash_key(key, count).
+ *
+ * \return the slot holding the key, or the first empty slot on its probe sequence.
+ */
+size_t Face_Hash_Table::probe(const unsigned *key, unsigned count, uint64_t hash) const {
+  const size_t mask = slots.size() - 1;
+  for (size_t slot = hash & mask;; slot = (slot + 1) & mask) {
+    const unsigned entry = slots[slot];
+    if (entry == npos)
+      return slot;
+    if (key_hash[entry] == hash && key_size(entry) == count &&
+        std::equal(key, key + count, key_nodes(entry)))
+      return slot;
+  }
+}
+
+//------------------------------------------------------------------------------------------------//
+//! Double the number of slots and reinsert every key using its stored hash.
+void Face_Hash_Table::grow() {
+  slots.assign(2 * slots.size(), npos);
+  const size_t mask = slots.size() - 1;
+
+  const unsigned num_keys = size();
+  for (unsigned key = 0; key < num_keys; ++key) {
+    size_t slot = key_hash[key] & mask;
+    while (slots[slot] != npos)
+      slot = (slot + 1) & mask;
+    slots[slot] = key;
+  }
+}
+
+} // end namespace rtt_mesh
+
+//------------------------------------------------------------------------------------------------//
+// end of mesh/Face_Hash_Table.cc
+//------------------------------------------------------------------------------------------------//
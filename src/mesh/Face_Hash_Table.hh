@@ -0,0 +1,111 @@
+//--------------------------------------------*-C++-*---------------------------------------------//
+/*!
+ * \file   mesh/Face_Hash_Table.hh
+ * \author agent <agent@local>
+ * \date   Friday, Oct 16, 2026, 10:12 am
+ * \brief  Face_Hash_Table class header file.
+ * \note   Copyright (C) 2026 Triad National Security, LLC., All rights reserved. */
+//------------------------------------------------------------------------------------------------//
+
+#ifndef rtt_mesh_Face_Hash_Table_hh
+#define rtt_mesh_Face_Hash_Table_hh
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace rtt_mesh {
+
+//================================================================================================//
+/*!
+ * \class Face_Hash_Table
+ *
+ * \brief Open-addressing hash set of mesh faces keyed on their node sets.
+ *
+ * A face is identified by the set of its node indices, independent of node order (the two cells
+ * sharing a face list its nodes in opposite orders).  Each distinct node set gets a dense key index
+ * 0, 1, ..., size()-1 in order of first insertion, so callers keep any per-face data in plain
+ * vectors indexed by key.
+ *
+ * Keys are stored sorted and without duplicate nodes in one flat array, and the table itself is a
+ * power-of-two array of key indices probed linearly, kept at most half full.  Building a table of n
+ * faces therefore makes O(n) allocations in total rather than one std::set per face, and a lookup
+ * is a hash and (usually) a single comparison of a few contiguous integers instead of a walk down
+ * a red-black tree of sets.
+ *
+ * The slot of a face depends only on the low bits of hash(), so callers may split faces between
+ * several tables on the high bits (see Draco_Mesh::compute_cell_to_cell_linkage) without crowding
+ * any one table.
+ */
+//================================================================================================//
+
+class Face_Hash_Table {
+public:
+  //! Key index returned by find() for a face that is not in the table.
+  static constexpr unsigned npos = UINT_MAX;
+
+  //! Constructor; reserves space for about expected_faces distinct faces.
+  explicit Face_Hash_Table(size_t expected_faces = 0);
+
+  // >>> SERVICES
+
+  //! Return the key index of a face, adding the face if its node set is new.
+  unsigned insert(const unsigned *nodes, unsigned count);
+
+  //! Return the key index of a face, or npos if its node set is not in the table.
+  unsigned find(const unsigned *nodes, unsigned count) const;
+
+  //! Hash of a face's node set, as used to place it in the table.
+  static uint64_t hash(const unsigned *nodes, unsigned count);
+
+  // >>> ACCESSORS
+
+  //! Number of distinct faces.
+  unsigned size() const { return static_cast<unsigned>(key_hash.size()); }
+
+  //! Number of nodes in the key of face index key.
+  unsigned key_size(unsigned key) const {
+    return static_cast<unsigned>(key_offset[key + 1] - key_offset[key]);
+  }
+
+  //! Sorted, unique nodes of face index key.
+  const unsigned *key_nodes(unsigned key) const { return node_keys.data() + key_offset[key]; }
+
+private:
+  // >>> DATA
+
+  //! Key index per slot (npos if empty); the size is a power of two.
+  std::vector<unsigned> slots;
+
+  //! Offsets of each key in node_keys (size() + 1 entries).
+  std::vector<size_t> key_offset;
+
+  //! Sorted, unique node indices of every key, back to back.
+  std::vector<unsigned> node_keys;
+
+  //! Hash of each key, kept so that growing the table never rehashes nodes.
+  std::vector<uint64_t> key_hash;
+
+  // >>> SUPPORT FUNCTIONS
+
+  //! Sort and remove duplicates from a face's nodes; return the number of unique nodes.
+  static unsigned canonical_key(const unsigned *nodes, unsigned count, unsigned *key);
+
+  //! Hash a canonical key.
+  static uint64_t hash_key(const unsigned *key, unsigned count);
+
+  //! Slot holding a canonical key, or the empty slot where it would be inserted.
+  size_t probe(const unsigned *key, unsigned count, uint64_t hash) const;
+
+  //! Double the number of slots and reinsert every key.
+  void grow();
+};
+
+} // end namespace rtt_mesh
+
+#endif // rtt_mesh_Face_Hash_Table_hh
+
+//------------------------------------------------------------------------------------------------//
+// end of mesh/Face_Hash_Table.hh
+//------------------------------------------------------------------------------------------------//
@@ -10,6 +10,9 @@
 #include "Test_Mesh_Interface.hh"
 #include "c4/ParallelUnitTest.hh"
 #include "ds++/Release.hh"
+#include "ds++/Soft_Equivalence.hh"
+#include <chrono>
+#include <random>
 
 using rtt_mesh::Draco_Mesh;
 
@@ -336,6 +339,195 @@ void cartesian_mesh_2d(rtt_c4::ParallelUnitTest &ut) {
   return;
 }
 
+//------------------------------------------------------------------------------------------------//
+// Flat (CSR) accessors, checked against the input data and the map-shaped accessors
+void flat_accessors(rtt_c4::ParallelUnitTest &ut) {
+
+  const size_t num_xdir = 6;
+  const size_t num_ydir = 5;
+  rtt_mesh_test::Test_Mesh_Interface mesh_iface(num_xdir, num_ydir);
+  Draco_Mesh mesh(mesh_iface.dim, Draco_Mesh::Geometry::CARTESIAN, mesh_iface.cell_type,
+                  mesh_iface.cell_to_node_linkage, mesh_iface.side_set_flag,
+                  mesh_iface.side_node_count, mesh_iface.side_to_node_linkage,
+                  mesh_iface.coordinates, mesh_iface.global_node_number, mesh_iface.face_type);
+
+  // the flat accessors refer to the mesh's own storage
+  FAIL_IF_NOT(&mesh.get_flat_cell_node_linkage() == &mesh.get_flat_cell_node_linkage());
+  FAIL_IF_NOT(mesh.get_flat_cell_node_linkage() == mesh_iface.cell_to_node_linkage);
+  FAIL_IF_NOT(mesh.get_node_coords() == mesh_iface.coordinates);
+
+  // node coordinates
+  const std::vector<std::vector<double>> node_coord_vec = mesh.get_node_coord_vec();
+  for (unsigned node = 0; node < mesh.get_num_nodes(); ++node) {
+    const Draco_Mesh::Coord_View coords = mesh.get_node_coords(node);
+    FAIL_IF_NOT(coords.size() == 2);
+    FAIL_IF_NOT(rtt_dsxx::soft_equiv(coords[0], node_coord_vec[node][0]));
+    FAIL_IF_NOT(rtt_dsxx::soft_equiv(coords[1], node_coord_vec[node][1]));
+  }
+
+  // cell face nodes
+  const std::vector<std::vector<std::vector<unsigned>>> cn_tensor = mesh.get_cell_to_node_linkage();
+  auto cn_first = mesh_iface.cell_to_node_linkage.begin();
+  for (unsigned cell = 0; cell < mesh.get_num_cells(); ++cell) {
+    for (unsigned face = 0; face < 4; ++face) {
+      const Draco_Mesh::Index_View nodes = mesh.get_cell_face_nodes(cell, face);
+      FAIL_IF_NOT(nodes.size() == 2);
+      FAIL_IF_NOT(nodes[0] == cn_first[0] && nodes[1] == cn_first[1]);
+      FAIL_IF_NOT(cn_tensor[cell][face] == std::vector<unsigned>(cn_first, cn_first + 2));
+      cn_first += 2;
+    }
+  }
+
+  // cell-to-cell, cell-to-side and cell-to-ghost layouts
+  const std::array<std::pair<const Draco_Mesh::Flat_Layout *, Draco_Mesh::Layout>, 3> layouts = {
+      std::make_pair(&mesh.get_flat_cc_linkage(), mesh.get_cc_linkage()),
+      std::make_pair(&mesh.get_flat_cs_linkage(), mesh.get_cs_linkage()),
+      std::make_pair(&mesh.get_flat_cg_linkage(), mesh.get_cg_linkage())};
+  for (const auto &layout : layouts) {
+    const Draco_Mesh::Flat_Layout &flat = *layout.first;
+    FAIL_IF_NOT(flat.face_offset.size() == mesh.get_num_cells() + 1);
+    for (unsigned cell = 0; cell < mesh.get_num_cells(); ++cell) {
+      const unsigned num_faces = flat.num_faces(cell);
+      FAIL_IF_NOT(num_faces == (layout.second.count(cell) > 0 ? layout.second.at(cell).size() : 0));
+      if (num_faces == 0 || num_faces != layout.second.at(cell).size())
+        continue;
+      for (unsigned f = 0; f < num_faces; ++f) {
+        const auto &face = layout.second.at(cell)[f];
+        FAIL_IF_NOT(flat.indices(cell)[f] == face.first);
+        const Draco_Mesh::Index_View nodes = mesh.get_face_nodes(flat.faces(cell)[f]);
+        FAIL_IF_NOT(std::vector<unsigned>(&nodes[0], &nodes[0] + nodes.size()) == face.second);
+      }
+    }
+  }
+
+  // node-to-cell dual layout
+  const Draco_Mesh::Dual_Layout nc_layout = mesh.get_nc_linkage();
+  FAIL_IF_NOT(nc_layout.size() == mesh.get_num_nodes());
+  for (unsigned node = 0; node < mesh.get_num_nodes(); ++node) {
+    const Draco_Mesh::CellNodes_View cellnodes = mesh.get_node_cellnodes(node);
+    FAIL_IF_NOT(cellnodes.size() == nc_layout.at(node).size());
+    for (size_t i = 0; i < std::min(cellnodes.size(), nc_layout.at(node).size()); ++i)
+      FAIL_IF_NOT(cellnodes[i] == nc_layout.at(node)[i]);
+  }
+
+  // successful test output
+  if (ut.numFails == 0)
+    PASSMSG("Flat Draco_Mesh accessors okay.");
+  return;
+}
+
+//------------------------------------------------------------------------------------------------//
+// Face hash table test against an ordered map of node sets
+void face_hash_table(rtt_c4::ParallelUnitTest &ut) {
+
+  using rtt_mesh::Face_Hash_Table;
+
+  Face_Hash_Table table;
+
+  // node order and repeated nodes do not matter
+  const std::vector<unsigned> tri = {3, 1, 2};
+  const std::vector<unsigned> tri_rot = {2, 3, 1};
+  const std::vector<unsigned> edge = {1, 2};
+  const std::vector<unsigned> edge_rep = {2, 1, 2};
+  FAIL_IF_NOT(table.insert(tri.data(), 3) == 0);
+  FAIL_IF_NOT(table.insert(tri_rot.data(), 3) == 0);
+  FAIL_IF_NOT(table.insert(edge.data(), 2) == 1);
+  FAIL_IF_NOT(table.insert(edge_rep.data(), 3) == 1);
+  FAIL_IF_NOT(table.find(edge_rep.data(), 3) == 1);
+  FAIL_IF_NOT(table.find(tri.data(), 2) == Face_Hash_Table::npos);
+  FAIL_IF_NOT(table.size() == 2);
+  FAIL_IF_NOT(table.key_size(0) == 3);
+  FAIL_IF_NOT(std::is_sorted(table.key_nodes(0), table.key_nodes(0) + 3));
+
+  // random faces of 2 to 24 nodes (some sharing node sets), growing the table from its default
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<unsigned> num_nodes(2, 24);
+  std::uniform_int_distribution<unsigned> node(0, 40);
+  std::map<std::set<unsigned>, unsigned> ref = {{{1, 2, 3}, 0}, {{1, 2}, 1}};
+  for (unsigned f = 0; f < 20000; ++f) {
+    std::vector<unsigned> face(num_nodes(gen));
+    for (auto &n : face)
+      n = node(gen);
+    if (f % 3 == 0)
+      std::reverse(face.begin(), face.end());
+    const auto count = static_cast<unsigned>(face.size());
+    const unsigned key = table.insert(face.data(), count);
+    const std::set<unsigned> node_set(face.begin(), face.end());
+    const auto found = ref.insert(std::make_pair(node_set, key));
+    FAIL_IF_NOT(found.first->second == key);
+    FAIL_IF_NOT(table.find(face.data(), count) == key);
+    FAIL_IF_NOT(std::equal(node_set.begin(), node_set.end(), table.key_nodes(key)));
+  }
+  FAIL_IF_NOT(table.size() == ref.size());
+
+  // successful test output
+  if (ut.numFails == 0)
+    PASSMSG("Face_Hash_Table tests okay.");
+  return;
+}
+
+//------------------------------------------------------------------------------------------------//
+// Linkage of a larger 2D mesh, to exercise face matching at scale
+void large_mesh_linkage(rtt_c4::ParallelUnitTest &ut) {
+
+  const size_t num_xdir = 400;
+  const size_t num_ydir = 250;
+  rtt_mesh_test::Test_Mesh_Interface mesh_iface(num_xdir, num_ydir);
+
+  auto t0 = std::chrono::steady_clock::now();
+  Draco_Mesh mesh(mesh_iface.dim, Draco_Mesh::Geometry::CARTESIAN, mesh_iface.cell_type,
+                  mesh_iface.cell_to_node_linkage, mesh_iface.side_set_flag,
+                  mesh_iface.side_node_count, mesh_iface.side_to_node_linkage,
+                  mesh_iface.coordinates, mesh_iface.global_node_number, mesh_iface.face_type);
+  auto t1 = std::chrono::steady_clock::now();
+  std::cout << "\nDraco_Mesh with " << mesh_iface.num_cells << " cells constructed in "
+            << std::chrono::duration<double>(t1 - t0).count() << " s\n"
+            << std::endl;
+
+  // every boundary face matched a supplied side, so no vacuum sides were appended
+  FAIL_IF_NOT(mesh.get_side_set_flag() == mesh_iface.side_set_flag);
+
+  // interior neighbors are the logical neighbors, in face order (bottom, right, top, left)
+  const Draco_Mesh::Layout layout = mesh.get_cc_linkage();
+  for (size_t j = 0; j < num_ydir; ++j) {
+    for (size_t i = 0; i < num_xdir; ++i) {
+      const auto cell = static_cast<unsigned>(i + j * num_xdir);
+      std::vector<unsigned> nbrs;
+      if (j > 0)
+        nbrs.push_back(cell - static_cast<unsigned>(num_xdir));
+      if (i < num_xdir - 1)
+        nbrs.push_back(cell + 1);
+      if (j < num_ydir - 1)
+        nbrs.push_back(cell + static_cast<unsigned>(num_xdir));
+      if (i > 0)
+        nbrs.push_back(cell - 1);
+      const auto &faces = layout.at(cell);
+      FAIL_IF_NOT(faces.size() == nbrs.size());
+      for (size_t f = 0; f < std::min(faces.size(), nbrs.size()); ++f)
+        FAIL_IF_NOT(faces[f].first == nbrs[f]);
+    }
+  }
+
+  // each boundary face is linked to the side with the same nodes
+  const Draco_Mesh::Layout bd_layout = mesh.get_cs_linkage();
+  size_t num_bd_faces = 0;
+  for (const auto &cell_faces : bd_layout) {
+    for (const auto &side_face : cell_faces.second) {
+      const unsigned side = side_face.first;
+      FAIL_IF_NOT(side < mesh_iface.num_sides);
+      const auto sn_first = mesh_iface.side_to_node_linkage.begin() + 2 * side;
+      FAIL_IF_NOT(std::is_permutation(sn_first, sn_first + 2, side_face.second.begin()));
+      num_bd_faces++;
+    }
+  }
+  FAIL_IF_NOT(num_bd_faces == mesh_iface.num_sides);
+
+  // successful test output
+  if (ut.numFails == 0)
+    PASSMSG("Large 2D Draco_Mesh linkage okay.");
+  return;
+}
+
 //------------------------------------------------------------------------------------------------//
 int main(int argc, char *argv[]) {
   rtt_c4::ParallelUnitTest ut(argc, argv, rtt_dsxx::release);
@@ -343,6 +535,9 @@ int main(int argc, char *argv[]) {
     Insist(rtt_c4::nodes() == 1, "This test only uses 1 PE.");
     spherical_mesh_1d(ut);
     cartesian_mesh_2d(ut);
+    flat_accessors(ut);
+    face_hash_table(ut);
+    large_mesh_linkage(ut);
   }
   UT_EPILOG(ut);
 }
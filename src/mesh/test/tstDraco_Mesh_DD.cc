@@ -10,7 +10,9 @@
 #include "Test_Mesh_Interface.hh"
 #include "c4/ParallelUnitTest.hh"
 #include "ds++/Release.hh"
+#include "c4/gatherv.hh"
 #include "ds++/Soft_Equivalence.hh"
+#include "mesh/Draco_Mesh_Ordering.hh"
 
 using rtt_mesh::Draco_Mesh;
 using rtt_mesh_test::Test_Mesh_Interface;
@@ -408,6 +410,19 @@ void dual_layout_2d_dd_4pe(rtt_c4::ParallelUnitTest &ut) {
     // check size (should be number of nodes per rank on processor boundaries)
     FAIL_IF_NOT(ngc_layout.size() == 3);
 
+    // the flat per-node views hold the same data, in the same order
+    for (unsigned node = 0; node < mesh->get_num_nodes(); ++node) {
+      const Draco_Mesh::Ghost_CellNodes_View ghosts = mesh->get_node_ghost_cells(node);
+      const Draco_Mesh::Coord_NBRS_View coords = mesh->get_node_ghost_coords(node);
+      const size_t num_ghosts = ngc_layout.count(node) > 0 ? ngc_layout.at(node).size() : 0;
+      FAIL_IF_NOT(ghosts.size() == num_ghosts);
+      FAIL_IF_NOT(coords.size() == num_ghosts);
+      for (size_t i = 0; i < std::min(num_ghosts, ghosts.size()); ++i) {
+        FAIL_IF_NOT(ghosts[i] == ngc_layout.at(node)[i]);
+        FAIL_IF_NOT(coords[i] == ngcoord_layout.at(node)[i]);
+      }
+    }
+
     // check sizes per node and data
     if (rtt_c4::node() == 0) {
 
@@ -678,6 +693,150 @@ void dual_layout_2d_dd_4pe(rtt_c4::ParallelUnitTest &ut) {
   return;
 }
 
+//------------------------------------------------------------------------------------------------//
+// 2D Cartesian domain-decomposed mesh, reordered on each rank
+void reordered_mesh_2d_dd(rtt_c4::ParallelUnitTest &ut) {
+  //----------------------------------------------------------------------------------------------//
+  // Each rank owns a 6x5 strip of cells, r0 leftmost, and its neighbors' edge cells as ghosts:
+  //    y
+  //    ^
+  //  5 ------------------------
+  //    |      |      |   |    |
+  //    |  r0  |  r1  |...| rN |
+  //    |      |      |   |    |
+  //  0 -------------------------> x
+  //    0      6      12
+  //----------------------------------------------------------------------------------------------//
+
+  const unsigned num_ranks = rtt_c4::nodes();
+  const unsigned rank = rtt_c4::node();
+  const size_t num_xdir = 6;
+  const size_t num_ydir = 5;
+  const size_t num_global_xnodes = num_xdir * num_ranks + 1;
+
+  // global node indices of the strip
+  std::vector<unsigned> global_node_number;
+  for (size_t j = 0; j <= num_ydir; ++j)
+    for (size_t i = 0; i <= num_xdir; ++i)
+      global_node_number.push_back(
+          static_cast<unsigned>(rank * num_xdir + i + j * num_global_xnodes));
+  const Test_Mesh_Interface mesh_iface(num_xdir, num_ydir, global_node_number,
+                                       static_cast<double>(rank * num_xdir), 0.0);
+
+  // keep the sides on the global boundary (the interface sides are ghost faces)
+  std::vector<unsigned> side_set_flag;
+  std::vector<unsigned> side_node_count;
+  std::vector<unsigned> side_to_node_linkage;
+  for (size_t side = 0; side < mesh_iface.num_sides; ++side) {
+    const unsigned flag = mesh_iface.side_set_flag[side];
+    if ((flag == 2 && rank + 1 < num_ranks) || (flag == 4 && rank > 0))
+      continue;
+    side_set_flag.push_back(flag);
+    side_node_count.push_back(2);
+    side_to_node_linkage.push_back(mesh_iface.side_to_node_linkage[2 * side]);
+    side_to_node_linkage.push_back(mesh_iface.side_to_node_linkage[2 * side + 1]);
+  }
+
+  // ghost cells across the left (face 4) and right (face 2) interfaces, nodes in local face order
+  std::vector<unsigned> ghost_cell_type;
+  std::vector<unsigned> ghost_cell_to_node_linkage;
+  std::vector<int> ghost_cell_number;
+  std::vector<int> ghost_cell_rank;
+  for (size_t j = 0; j < num_ydir; ++j) {
+    if (rank > 0) {
+      const size_t cell = num_xdir * j;
+      ghost_cell_type.push_back(2);
+      ghost_cell_to_node_linkage.push_back(mesh_iface.cell_to_node_linkage[8 * cell + 6]);
+      ghost_cell_to_node_linkage.push_back(mesh_iface.cell_to_node_linkage[8 * cell + 7]);
+      ghost_cell_number.push_back(static_cast<int>(num_xdir - 1 + num_xdir * j));
+      ghost_cell_rank.push_back(static_cast<int>(rank - 1));
+    }
+    if (rank + 1 < num_ranks) {
+      const size_t cell = num_xdir - 1 + num_xdir * j;
+      ghost_cell_type.push_back(2);
+      ghost_cell_to_node_linkage.push_back(mesh_iface.cell_to_node_linkage[8 * cell + 2]);
+      ghost_cell_to_node_linkage.push_back(mesh_iface.cell_to_node_linkage[8 * cell + 3]);
+      ghost_cell_number.push_back(static_cast<int>(num_xdir * j));
+      ghost_cell_rank.push_back(static_cast<int>(rank + 1));
+    }
+  }
+
+  const Draco_Mesh ref(mesh_iface.dim, Draco_Mesh::Geometry::CARTESIAN, mesh_iface.cell_type,
+                       mesh_iface.cell_to_node_linkage, side_set_flag, side_node_count,
+                       side_to_node_linkage, mesh_iface.coordinates, global_node_number,
+                       mesh_iface.face_type, ghost_cell_type, ghost_cell_to_node_linkage,
+                       ghost_cell_number, ghost_cell_rank);
+
+  for (const rtt_mesh::Mesh_Ordering ordering :
+       {rtt_mesh::Mesh_Ordering::HILBERT, rtt_mesh::Mesh_Ordering::RCM}) {
+
+    std::vector<unsigned> num_faces_per_cell(mesh_iface.cell_type);
+    std::vector<unsigned> cell_to_node_linkage(mesh_iface.cell_to_node_linkage);
+    std::vector<unsigned> num_nodes_per_face_per_cell(mesh_iface.face_type);
+    std::vector<unsigned> mesh_side_to_node_linkage(side_to_node_linkage);
+    std::vector<double> coordinates(mesh_iface.coordinates);
+    std::vector<unsigned> mesh_global_node_number(global_node_number);
+    std::vector<unsigned> mesh_ghost_cell_to_node_linkage(ghost_cell_to_node_linkage);
+    std::vector<int> mesh_ghost_cell_number(ghost_cell_number);
+    const rtt_mesh::Mesh_Permutation perm = rtt_mesh::reorder_mesh_data(
+        ordering, mesh_iface.dim, num_faces_per_cell, cell_to_node_linkage,
+        num_nodes_per_face_per_cell, mesh_side_to_node_linkage, coordinates,
+        mesh_global_node_number, mesh_ghost_cell_to_node_linkage);
+    rtt_mesh::remap_ghost_cell_numbers(perm, ghost_cell_rank, mesh_ghost_cell_number);
+
+    const Draco_Mesh mesh(mesh_iface.dim, Draco_Mesh::Geometry::CARTESIAN, num_faces_per_cell,
+                          cell_to_node_linkage, side_set_flag, side_node_count,
+                          mesh_side_to_node_linkage, coordinates, mesh_global_node_number,
+                          num_nodes_per_face_per_cell, ghost_cell_type,
+                          mesh_ghost_cell_to_node_linkage, mesh_ghost_cell_number,
+                          ghost_cell_rank);
+
+    // ghost cells keep their order, so each cell has the ghosts of its reader cell
+    FAIL_IF_NOT(mesh.get_ghost_cell_ranks() == ghost_cell_rank);
+    bool same_ghosts = true;
+    for (unsigned cell = 0; cell < mesh.get_num_cells(); ++cell) {
+      const auto ghosts = mesh.get_flat_cg_linkage().indices(cell);
+      const auto ref_ghosts = ref.get_flat_cg_linkage().indices(perm.old_cell[cell]);
+      if (ghosts.size() != ref_ghosts.size())
+        same_ghosts = false;
+      for (size_t f = 0; f < ghosts.size() && same_ghosts; ++f)
+        if (ghosts[f] != ref_ghosts[f])
+          same_ghosts = false;
+    }
+    FAIL_IF_NOT(same_ghosts);
+
+    // every rank's global nodes of each cell, in mesh order
+    std::vector<unsigned> cell_global_nodes;
+    for (const unsigned node : mesh.get_flat_cell_node_linkage())
+      cell_global_nodes.push_back(mesh_global_node_number[node]);
+    std::vector<std::vector<unsigned>> cell_global_nodes_per_rank;
+    rtt_c4::indeterminate_allgatherv(cell_global_nodes, cell_global_nodes_per_rank);
+
+    // each ghost face's nodes are nodes of the renumbered remote cell
+    bool ghosts_match = true;
+    for (unsigned cell = 0; cell < mesh.get_num_cells(); ++cell) {
+      const auto ghosts = mesh.get_flat_cg_linkage().indices(cell);
+      const auto faces = mesh.get_flat_cg_linkage().faces(cell);
+      for (size_t f = 0; f < ghosts.size(); ++f) {
+        const auto ghost = static_cast<size_t>(ghosts[f]);
+        const std::vector<unsigned> &remote =
+            cell_global_nodes_per_rank[static_cast<size_t>(mesh.get_ghost_cell_ranks()[ghost])];
+        const auto remote_cell = static_cast<size_t>(mesh.get_ghost_cell_numbers()[ghost]);
+        const auto remote_first = remote.begin() + static_cast<std::ptrdiff_t>(8 * remote_cell);
+        for (const unsigned node : mesh.get_face_nodes(faces[f]))
+          if (std::find(remote_first, remote_first + 8, mesh_global_node_number[node]) ==
+              remote_first + 8)
+            ghosts_match = false;
+      }
+    }
+    FAIL_IF_NOT(ghosts_match);
+  }
+
+  if (ut.numFails == 0)
+    PASSMSG("Reordered 2D domain-decomposed Draco_Mesh ghost data is consistent.");
+  return;
+}
+
 //------------------------------------------------------------------------------------------------//
 
 int main(int argc, char *argv[]) {
@@ -690,6 +849,7 @@ int main(int argc, char *argv[]) {
     } else {
       Insist(false, "This test only uses 2 or 4 PE.");
     }
+    reordered_mesh_2d_dd(ut);
   }
   UT_EPILOG(ut);
 }
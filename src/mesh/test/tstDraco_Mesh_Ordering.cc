@@ -0,0 +1,346 @@
+//--------------------------------------------*-C++-*---------------------------------------------//
+/*!
+ * \file   mesh/test/tstDraco_Mesh_Ordering.cc
+ * \author agent <agent@local>
+ * \date   Friday, Oct 16, 2026, 3:20 pm
+ * \brief  Cell and node reordering tests for Draco_Mesh.
+ * \note   Copyright (C) 2026 Triad National Security, LLC., All rights reserved. */
+//------------------------------------------------------------------------------------------------//
+
+#include "Test_Mesh_Interface.hh"
+#include "c4/ParallelUnitTest.hh"
+#include "ds++/Release.hh"
+#include "mesh/Draco_Mesh_Builder.hh"
+#include "mesh/Draco_Mesh_Ordering.hh"
+#include "mesh/X3D_Draco_Mesh_Reader.hh"
+#include <iomanip>
+#include <numeric>
+
+using rtt_mesh::Draco_Mesh;
+using rtt_mesh::Draco_Mesh_Builder;
+using rtt_mesh::Mesh_Ordering;
+using rtt_mesh::Mesh_Permutation;
+using rtt_mesh::X3D_Draco_Mesh_Reader;
+
+//------------------------------------------------------------------------------------------------//
+// HELPERS
+//------------------------------------------------------------------------------------------------//
+
+//! Name of an ordering, for output.
+std::string ordering_name(const Mesh_Ordering ordering) {
+  switch (ordering) {
+  case Mesh_Ordering::READER:
+    return "reader";
+  case Mesh_Ordering::MORTON:
+    return "Morton";
+  case Mesh_Ordering::HILBERT:
+    return "Hilbert";
+  case Mesh_Ordering::RCM:
+    return "RCM";
+  }
+  return "unknown";
+}
+
+//! Largest and mean index distance between face-adjacent cells.
+std::pair<unsigned, double> cell_bandwidth(const Draco_Mesh &mesh) {
+  const Draco_Mesh::Flat_Layout &cc_linkage = mesh.get_flat_cc_linkage();
+  unsigned max_distance = 0;
+  double sum_distance = 0.0;
+  for (unsigned cell = 0; cell < mesh.get_num_cells(); ++cell) {
+    for (const unsigned nbr : cc_linkage.indices(cell)) {
+      const unsigned distance = nbr > cell ? nbr - cell : cell - nbr;
+      max_distance = std::max(max_distance, distance);
+      sum_distance += distance;
+    }
+  }
+  const size_t num_links = cc_linkage.face_index.size();
+  return {max_distance, num_links > 0 ? sum_distance / static_cast<double>(num_links) : 0.0};
+}
+
+//! Check that a permutation is a bijection of the right size.
+void check_bijection(rtt_c4::ParallelUnitTest &ut, const std::vector<unsigned> &old_index,
+                     const std::vector<unsigned> &new_index, const size_t size) {
+  FAIL_IF_NOT(old_index.size() == size);
+  FAIL_IF_NOT(new_index.size() == size);
+  bool inverse = true;
+  for (unsigned i = 0; i < size && i < old_index.size() && i < new_index.size(); ++i)
+    if (old_index[i] >= size || new_index[old_index[i]] != i)
+      inverse = false;
+  FAIL_IF_NOT(inverse);
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Check that a reordered mesh is the reference mesh renumbered by a permutation.
+ *
+ * Each mesh cell must have the faces, face nodes, neighbors, sides and ghost cells of its reader
+ * cell (in the same face order), and sides must be unchanged apart from node numbers.
+ */
+void check_permuted_mesh(rtt_c4::ParallelUnitTest &ut, const Draco_Mesh &ref,
+                         const Draco_Mesh &mesh, const Mesh_Permutation &perm) {
+
+  const unsigned num_cells = ref.get_num_cells();
+  const unsigned num_nodes = ref.get_num_nodes();
+  FAIL_IF_NOT(mesh.get_num_cells() == num_cells);
+  FAIL_IF_NOT(mesh.get_num_nodes() == num_nodes);
+  check_bijection(ut, perm.old_cell, perm.new_cell, num_cells);
+  check_bijection(ut, perm.old_node, perm.new_node, num_nodes);
+  if (ut.numFails > 0)
+    return;
+
+  // node coordinates move with the nodes
+  const unsigned dim = ref.get_dimension();
+  std::vector<double> coords;
+  for (unsigned node = 0; node < num_nodes; ++node)
+    for (unsigned d = 0; d < dim; ++d)
+      coords.push_back(ref.get_node_coords()[perm.old_node[node] * dim + d]);
+  FAIL_IF_NOT(mesh.get_node_coords() == coords);
+
+  // cells keep their faces, in order
+  FAIL_IF_NOT(mesh.get_num_faces_per_cell() == perm.cell_field(ref.get_num_faces_per_cell()));
+  bool same_faces = true;
+  for (unsigned cell = 0; cell < num_cells && same_faces; ++cell) {
+    const unsigned old = perm.old_cell[cell];
+    for (unsigned face = 0; face < mesh.get_num_faces_per_cell()[cell]; ++face) {
+      const auto nodes = mesh.get_cell_face_nodes(cell, face);
+      const auto ref_nodes = ref.get_cell_face_nodes(old, face);
+      if (nodes.size() != ref_nodes.size()) {
+        same_faces = false;
+        break;
+      }
+      for (size_t i = 0; i < nodes.size(); ++i)
+        if (perm.old_node[nodes[i]] != ref_nodes[i])
+          same_faces = false;
+    }
+  }
+  FAIL_IF_NOT(same_faces);
+
+  // sides are not reordered
+  FAIL_IF_NOT(mesh.get_side_set_flag() == ref.get_side_set_flag());
+  FAIL_IF_NOT(mesh.get_side_node_count() == ref.get_side_node_count());
+  bool same_side_nodes = mesh.get_side_to_node_linkage().size() ==
+                         ref.get_side_to_node_linkage().size();
+  for (size_t i = 0; i < mesh.get_side_to_node_linkage().size() && same_side_nodes; ++i)
+    if (perm.old_node[mesh.get_side_to_node_linkage()[i]] != ref.get_side_to_node_linkage()[i])
+      same_side_nodes = false;
+  FAIL_IF_NOT(same_side_nodes);
+
+  // cell-to-cell faces link the renumbered neighbors; side and ghost faces the same indices
+  const std::array<const Draco_Mesh::Flat_Layout *, 3> ref_layouts = {
+      &ref.get_flat_cc_linkage(), &ref.get_flat_cs_linkage(), &ref.get_flat_cg_linkage()};
+  const std::array<const Draco_Mesh::Flat_Layout *, 3> layouts = {
+      &mesh.get_flat_cc_linkage(), &mesh.get_flat_cs_linkage(), &mesh.get_flat_cg_linkage()};
+  for (size_t l = 0; l < layouts.size(); ++l) {
+    bool same_layout = true;
+    for (unsigned cell = 0; cell < num_cells && same_layout; ++cell) {
+      const unsigned old = perm.old_cell[cell];
+      const auto face_index = layouts[l]->indices(cell);
+      const auto ref_face_index = ref_layouts[l]->indices(old);
+      if (face_index.size() != ref_face_index.size()) {
+        same_layout = false;
+        break;
+      }
+      for (size_t f = 0; f < face_index.size(); ++f) {
+        const unsigned linked = l == 0 ? perm.old_cell[face_index[f]] : face_index[f];
+        if (linked != ref_face_index[f])
+          same_layout = false;
+        const auto nodes = mesh.get_face_nodes(layouts[l]->faces(cell)[f]);
+        const auto ref_nodes = ref.get_face_nodes(ref_layouts[l]->faces(old)[f]);
+        for (size_t i = 0; i < nodes.size() && i < ref_nodes.size(); ++i)
+          if (perm.old_node[nodes[i]] != ref_nodes[i])
+            same_layout = false;
+      }
+    }
+    FAIL_IF_NOT(same_layout);
+  }
+}
+
+//------------------------------------------------------------------------------------------------//
+// TESTS
+//------------------------------------------------------------------------------------------------//
+
+//! Reorder a scrambled orthogonal mesh with each ordering and check consistency and locality.
+void reorder_scrambled_mesh(rtt_c4::ParallelUnitTest &ut) {
+
+  const size_t num_xdir = 40;
+  const size_t num_ydir = 30;
+  rtt_mesh_test::Test_Mesh_Interface mesh_iface(num_xdir, num_ydir);
+  const size_t num_cells = mesh_iface.num_cells;
+  const size_t num_nodes = mesh_iface.num_nodes;
+
+  // scramble cells and nodes with multiplicative permutations (prime strides not dividing the
+  // cell and node counts)
+  const size_t cell_stride = 7;
+  const size_t node_stride = 11;
+  Insist(num_cells % cell_stride != 0, "cell_stride must be coprime to num_cells");
+  Insist(num_nodes % node_stride != 0, "node_stride must be coprime to num_nodes");
+  std::vector<unsigned> scrambled_node(num_nodes);
+  for (size_t node = 0; node < num_nodes; ++node)
+    scrambled_node[node] = static_cast<unsigned>((node * node_stride) % num_nodes);
+
+  std::vector<unsigned> cell_to_node_linkage;
+  std::vector<unsigned> num_faces_per_cell;
+  std::vector<unsigned> num_nodes_per_face_per_cell;
+  for (size_t cell = 0; cell < num_cells; ++cell) {
+    const size_t iface_cell = (cell * cell_stride) % num_cells;
+    num_faces_per_cell.push_back(mesh_iface.cell_type[iface_cell]);
+    for (unsigned i = 0; i < 8; ++i)
+      cell_to_node_linkage.push_back(
+          scrambled_node[mesh_iface.cell_to_node_linkage[8 * iface_cell + i]]);
+    for (unsigned face = 0; face < 4; ++face)
+      num_nodes_per_face_per_cell.push_back(mesh_iface.face_type[4 * iface_cell + face]);
+  }
+  std::vector<unsigned> side_to_node_linkage;
+  for (const unsigned node : mesh_iface.side_to_node_linkage)
+    side_to_node_linkage.push_back(scrambled_node[node]);
+  std::vector<double> coordinates(mesh_iface.coordinates.size());
+  for (size_t node = 0; node < num_nodes; ++node)
+    for (unsigned d = 0; d < 2; ++d)
+      coordinates[2 * scrambled_node[node] + d] = mesh_iface.coordinates[2 * node + d];
+  const std::vector<unsigned> global_node_number = mesh_iface.global_node_number;
+
+  const Draco_Mesh ref(2, Draco_Mesh::Geometry::CARTESIAN, num_faces_per_cell,
+                       cell_to_node_linkage, mesh_iface.side_set_flag, mesh_iface.side_node_count,
+                       side_to_node_linkage, coordinates, global_node_number,
+                       num_nodes_per_face_per_cell);
+  const std::pair<unsigned, double> ref_bandwidth = cell_bandwidth(ref);
+
+  std::cout << std::setprecision(4) << "\nCell index distance across faces on a " << num_xdir
+            << "x" << num_ydir << " mesh (max, mean):\n  scrambled: " << ref_bandwidth.first
+            << ", " << ref_bandwidth.second << "\n";
+
+  for (const Mesh_Ordering ordering : {Mesh_Ordering::READER, Mesh_Ordering::MORTON,
+                                       Mesh_Ordering::HILBERT, Mesh_Ordering::RCM}) {
+
+    std::vector<unsigned> mesh_num_faces_per_cell(num_faces_per_cell);
+    std::vector<unsigned> mesh_cell_to_node_linkage(cell_to_node_linkage);
+    std::vector<unsigned> mesh_num_nodes_per_face_per_cell(num_nodes_per_face_per_cell);
+    std::vector<unsigned> mesh_side_to_node_linkage(side_to_node_linkage);
+    std::vector<double> mesh_coordinates(coordinates);
+    std::vector<unsigned> mesh_global_node_number(global_node_number);
+    std::vector<unsigned> ghost_cell_to_node_linkage;
+    const Mesh_Permutation perm = rtt_mesh::reorder_mesh_data(
+        ordering, 2, mesh_num_faces_per_cell, mesh_cell_to_node_linkage,
+        mesh_num_nodes_per_face_per_cell, mesh_side_to_node_linkage, mesh_coordinates,
+        mesh_global_node_number, ghost_cell_to_node_linkage);
+
+    // global node numbers follow their nodes
+    FAIL_IF_NOT(mesh_global_node_number == perm.node_field(global_node_number));
+
+    const Draco_Mesh mesh(2, Draco_Mesh::Geometry::CARTESIAN, mesh_num_faces_per_cell,
+                          mesh_cell_to_node_linkage, mesh_iface.side_set_flag,
+                          mesh_iface.side_node_count, mesh_side_to_node_linkage, mesh_coordinates,
+                          mesh_global_node_number, mesh_num_nodes_per_face_per_cell);
+    check_permuted_mesh(ut, ref, mesh, perm);
+
+    const std::pair<unsigned, double> bandwidth = cell_bandwidth(mesh);
+    std::cout << "  " << std::setw(9) << std::left << ordering_name(ordering) + ":" << " "
+              << bandwidth.first << ", " << bandwidth.second << "\n";
+
+    if (ordering == Mesh_Ordering::READER) {
+      // the reader ordering is the identity
+      FAIL_IF_NOT(perm.old_cell == perm.new_cell);
+      FAIL_IF_NOT(perm.old_node == perm.new_node);
+      FAIL_IF_NOT(mesh_cell_to_node_linkage == cell_to_node_linkage);
+      FAIL_IF_NOT(mesh_coordinates == coordinates);
+    } else {
+      // every other ordering brings neighbors closer together
+      FAIL_IF_NOT(bandwidth.second < ref_bandwidth.second / 4.0);
+    }
+
+    // a breadth-first ordering of a grid has a bandwidth of about its shorter side
+    if (ordering == Mesh_Ordering::RCM)
+      FAIL_IF_NOT(bandwidth.first <= num_xdir + num_ydir);
+  }
+  std::cout << std::endl;
+
+  if (ut.numFails == 0) {
+    PASSMSG("Reordered meshes are consistent renumberings with better locality");
+  } else {
+    FAILMSG("Reordered meshes are not consistent renumberings, or lack locality");
+  }
+}
+
+//------------------------------------------------------------------------------------------------//
+//! Check that the Hilbert order of a 2^k x 2^k grid steps between face neighbors only.
+void hilbert_square_mesh(rtt_c4::ParallelUnitTest &ut) {
+
+  const size_t num_xdir = 16;
+  rtt_mesh_test::Test_Mesh_Interface mesh_iface(num_xdir, num_xdir);
+
+  const std::vector<unsigned> order = rtt_mesh::compute_cell_order(
+      Mesh_Ordering::HILBERT, 2, mesh_iface.cell_type, mesh_iface.cell_to_node_linkage,
+      mesh_iface.face_type, mesh_iface.coordinates);
+  FAIL_IF_NOT(order.size() == mesh_iface.num_cells);
+
+  bool adjacent = true;
+  for (size_t c = 1; c < order.size(); ++c) {
+    const size_t di = std::max(order[c] % num_xdir, order[c - 1] % num_xdir) -
+                      std::min(order[c] % num_xdir, order[c - 1] % num_xdir);
+    const size_t dj = std::max(order[c] / num_xdir, order[c - 1] / num_xdir) -
+                      std::min(order[c] / num_xdir, order[c - 1] / num_xdir);
+    if (di + dj != 1)
+      adjacent = false;
+  }
+  FAIL_IF_NOT(adjacent);
+
+  if (ut.numFails == 0) {
+    PASSMSG("Hilbert order of a square grid is a path through face neighbors");
+  } else {
+    FAILMSG("Hilbert order of a square grid is not a path through face neighbors");
+  }
+}
+
+//------------------------------------------------------------------------------------------------//
+//! Build an unstructured 3D mesh with boundary files in each ordering and check it.
+void reorder_builder_3d(rtt_c4::ParallelUnitTest &ut) {
+
+  const std::string inputpath = ut.getTestSourcePath();
+  const std::string filename = inputpath + "x3d.rnd_mesh3d.in";
+  const std::vector<std::string> bdy_filenames = {
+      inputpath + "x3d.rnd_mesh3d.bdy1.in", inputpath + "x3d.rnd_mesh3d.bdy2.in",
+      inputpath + "x3d.rnd_mesh3d.bdy3.in", inputpath + "x3d.rnd_mesh3d.bdy4.in",
+      inputpath + "x3d.rnd_mesh3d.bdy5.in", inputpath + "x3d.rnd_mesh3d.bdy6.in"};
+  const std::vector<unsigned> bdy_flags = {3, 1, 0, 2, 1, 5};
+
+  std::shared_ptr<X3D_Draco_Mesh_Reader> x3d_reader(
+      new X3D_Draco_Mesh_Reader(filename, bdy_filenames, bdy_flags));
+  x3d_reader->read_mesh();
+
+  Draco_Mesh_Builder<X3D_Draco_Mesh_Reader> mesh_builder(x3d_reader);
+  std::shared_ptr<Draco_Mesh> ref = mesh_builder.build_mesh(Draco_Mesh::Geometry::CARTESIAN);
+
+  for (const Mesh_Ordering ordering : {Mesh_Ordering::READER, Mesh_Ordering::MORTON,
+                                       Mesh_Ordering::HILBERT, Mesh_Ordering::RCM}) {
+    Mesh_Permutation perm;
+    std::shared_ptr<Draco_Mesh> mesh =
+        mesh_builder.build_mesh(Draco_Mesh::Geometry::CARTESIAN, ordering, perm, 2);
+    check_permuted_mesh(ut, *ref, *mesh, perm);
+
+    // a per-cell field moves with the cells
+    std::vector<unsigned> reader_cell(ref->get_num_cells());
+    std::iota(reader_cell.begin(), reader_cell.end(), 0u);
+    FAIL_IF_NOT(perm.cell_field(reader_cell) == perm.old_cell);
+  }
+
+  if (ut.numFails == 0) {
+    PASSMSG("Reordered 3D X3D mesh builds are consistent renumberings");
+  } else {
+    FAILMSG("Reordered 3D X3D mesh builds are not consistent renumberings");
+  }
+}
+
+//------------------------------------------------------------------------------------------------//
+int main(int argc, char *argv[]) {
+  rtt_c4::ParallelUnitTest ut(argc, argv, rtt_dsxx::release);
+  try {
+    reorder_scrambled_mesh(ut);
+    hilbert_square_mesh(ut);
+    reorder_builder_3d(ut);
+  }
+  UT_EPILOG(ut);
+}
+
+//------------------------------------------------------------------------------------------------//
+// end of mesh/test/tstDraco_Mesh_Ordering.cc
+//------------------------------------------------------------------------------------------------//
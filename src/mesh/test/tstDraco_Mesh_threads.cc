@@ -0,0 +1,339 @@
+//--------------------------------------------*-C++-*---------------------------------------------//
+/*!
+ * \file   mesh/test/tstDraco_Mesh_threads.cc
+ * \author agent <agent@local>
+ * \date   Friday, Oct 16, 2026, 2:05 pm
+ * \brief  Threaded Draco_Mesh construction tests and startup benchmark.
+ * \note   Copyright (C) 2026 Triad National Security, LLC., All rights reserved. */
+//------------------------------------------------------------------------------------------------//
+
+#include "Test_Mesh_Interface.hh"
+#include "c4/ParallelUnitTest.hh"
+#include "c4/Timer.hh"
+#include "c4/c4_omp.h"
+#include "ds++/Release.hh"
+#include "mesh/Draco_Mesh_Builder.hh"
+#include "mesh/X3D_Draco_Mesh_Reader.hh"
+#include <fstream>
+#include <iomanip>
+
+using rtt_c4::Timer;
+using rtt_mesh::Draco_Mesh;
+using rtt_mesh::Draco_Mesh_Builder;
+using rtt_mesh::X3D_Draco_Mesh_Reader;
+
+//------------------------------------------------------------------------------------------------//
+// HELPERS
+//------------------------------------------------------------------------------------------------//
+
+//! Thread count for the threaded builds; at least four, so that several face hash shards and cell
+//! blocks are used even on a single core.
+int test_threads() { return std::max(rtt_c4::get_omp_max_threads(), 4); }
+
+//! Check that two meshes hold the same data, down to the order of every layout.
+void check_same_mesh(rtt_c4::ParallelUnitTest &ut, const Draco_Mesh &ref, const Draco_Mesh &mesh) {
+
+  FAIL_IF_NOT(mesh.get_dimension() == ref.get_dimension());
+  FAIL_IF_NOT(mesh.get_num_cells() == ref.get_num_cells());
+  FAIL_IF_NOT(mesh.get_num_nodes() == ref.get_num_nodes());
+  FAIL_IF_NOT(mesh.get_node_coords() == ref.get_node_coords());
+  FAIL_IF_NOT(mesh.get_flat_cell_node_linkage() == ref.get_flat_cell_node_linkage());
+  FAIL_IF_NOT(mesh.get_num_faces_per_cell() == ref.get_num_faces_per_cell());
+  FAIL_IF_NOT(mesh.get_num_nodes_per_face_per_cell() == ref.get_num_nodes_per_face_per_cell());
+
+  // vacuum sides are appended in the same order
+  FAIL_IF_NOT(mesh.get_side_set_flag() == ref.get_side_set_flag());
+  FAIL_IF_NOT(mesh.get_side_node_count() == ref.get_side_node_count());
+  FAIL_IF_NOT(mesh.get_side_to_node_linkage() == ref.get_side_to_node_linkage());
+
+  const std::array<const Draco_Mesh::Flat_Layout *, 3> ref_layouts = {
+      &ref.get_flat_cc_linkage(), &ref.get_flat_cs_linkage(), &ref.get_flat_cg_linkage()};
+  const std::array<const Draco_Mesh::Flat_Layout *, 3> layouts = {
+      &mesh.get_flat_cc_linkage(), &mesh.get_flat_cs_linkage(), &mesh.get_flat_cg_linkage()};
+  for (size_t l = 0; l < layouts.size(); ++l) {
+    FAIL_IF_NOT(layouts[l]->face_offset == ref_layouts[l]->face_offset);
+    FAIL_IF_NOT(layouts[l]->face_index == ref_layouts[l]->face_index);
+    FAIL_IF_NOT(layouts[l]->cell_face == ref_layouts[l]->cell_face);
+  }
+
+  // each node lists its cells in the same order
+  FAIL_IF_NOT(mesh.get_nc_linkage() == ref.get_nc_linkage());
+
+  // faces across cells are matched the same way
+  bool same_next_face = true;
+  for (unsigned cell = 0; cell < ref.get_num_cells(); ++cell) {
+    const auto num_faces = static_cast<int32_t>(ref.get_num_faces_per_cell()[cell]);
+    const auto cell_id = static_cast<int32_t>(cell + 1);
+    for (int32_t face = 1; face <= num_faces; ++face)
+      if (mesh.next_face(cell_id, face) != ref.next_face(cell_id, face))
+        same_next_face = false;
+  }
+  FAIL_IF_NOT(same_next_face);
+}
+
+//------------------------------------------------------------------------------------------------//
+/*!
+ * \brief Write an orthogonal 2D mesh of quadrilaterals as an X3D file.
+ *
+ * The file has the layout x3d_generator.py writes for an orth_2d_mesh (see mesh_types.py) on
+ * [0,1]x[0,1], without boundary files, so every boundary face becomes a vacuum side.
+ */
+void write_orth_2d_x3d(const std::string &filename, const size_t num_xdir, const size_t num_ydir) {
+
+  const size_t num_cells = num_xdir * num_ydir;
+  const size_t num_nodes = (num_xdir + 1) * (num_ydir + 1);
+
+  std::ofstream fo(filename);
+  Insist(fo.is_open(), "Failed to open " + filename);
+
+  fo << "ascii\nheader\n"
+     << "   process                         1\n"
+     << "   numdim                          2\n"
+     << "   materials                       1\n"
+     << "   nodes                           " << num_nodes << "\n"
+     << "   faces                           " << 4 * num_cells << "\n"
+     << "   elements                        " << num_cells << "\n"
+     << "   ghost_nodes                     0\n"
+     << "   slaved_nodes                    0\n"
+     << "   nodes_per_slave                 2\n"
+     << "   nodes_per_face                  2\n"
+     << "   faces_per_cell                  4\n"
+     << "   node_data_fields                0\n"
+     << "   cell_data_fields                2\n"
+     << "end_header\n\n"
+     << "matnames\n            1   0\nend_matnames\n\n"
+     << "mateos\n            1   -1\nend_mateos\n\n"
+     << "matopc\n            1   -1\nend_matopc\n\n";
+
+  // node coordinates, x fastest
+  fo << "nodes\n" << std::scientific << std::setprecision(15);
+  for (size_t j = 0; j <= num_ydir; ++j)
+    for (size_t i = 0; i <= num_xdir; ++i)
+      fo << std::setw(10) << i + j * (num_xdir + 1) + 1 << "  "
+         << static_cast<double>(i) / static_cast<double>(num_xdir) << "  "
+         << static_cast<double>(j) / static_cast<double>(num_ydir) << "  " << 0.0 << "\n";
+  fo << "end_nodes\n\n";
+
+  // four faces per cell (bottom, right, top, left), counter-clockwise
+  fo << "faces\n";
+  for (size_t j = 0; j < num_ydir; ++j) {
+    for (size_t i = 0; i < num_xdir; ++i) {
+      const size_t cell = i + num_xdir * j;
+      const size_t n0 = i + j * (num_xdir + 1) + 1;
+      const size_t n3 = n0 + num_xdir + 1;
+      const std::array<std::array<size_t, 2>, 4> face_nodes = {
+          {{n0, n0 + 1}, {n0 + 1, n3 + 1}, {n3 + 1, n3}, {n3, n0}}};
+      for (size_t f = 0; f < 4; ++f)
+        fo << std::setw(10) << 4 * cell + f + 1 << std::setw(10) << 2 << std::setw(10)
+           << face_nodes[f][0] << std::setw(10) << face_nodes[f][1] << "\n";
+    }
+  }
+  fo << "end_faces\n\n";
+
+  fo << "cells\n";
+  for (size_t cell = 0; cell < num_cells; ++cell) {
+    fo << std::setw(10) << cell + 1 << std::setw(10) << 4;
+    for (size_t f = 0; f < 4; ++f)
+      fo << std::setw(10) << 4 * cell + f + 1;
+    fo << "\n";
+  }
+  fo << "end_cells\n\n";
+
+  fo << "slaved_nodes         0\nend_slaved_nodes\nghost_nodes          0\nend_ghost_nodes\n\n";
+
+  fo << "cell_data\nmatid\n";
+  for (size_t cell = 0; cell < num_cells; ++cell)
+    fo << std::setw(10) << cell + 1 << std::setw(10) << 0 << "\n";
+  fo << "end_matid\npartelm\n         1\nend_partelm\nend_cell_data\n";
+}
+
+//------------------------------------------------------------------------------------------------//
+// TESTS
+//------------------------------------------------------------------------------------------------//
+
+//! Check that a threaded construction matches the serial one and report the wall clock times.
+void threaded_construction(rtt_c4::ParallelUnitTest &ut) {
+
+  const size_t num_xdir = 400;
+  const size_t num_ydir = 250;
+  rtt_mesh_test::Test_Mesh_Interface mesh_iface(num_xdir, num_ydir);
+
+  // drop two sides to exercise the vacuum boundary path
+  const size_t num_sides = mesh_iface.side_set_flag.size() - 2;
+  const std::vector<unsigned> side_set_flag(mesh_iface.side_set_flag.begin(),
+                                            mesh_iface.side_set_flag.begin() + num_sides);
+  const std::vector<unsigned> side_node_count(mesh_iface.side_node_count.begin(),
+                                              mesh_iface.side_node_count.begin() + num_sides);
+  const std::vector<unsigned> side_to_node_linkage(
+      mesh_iface.side_to_node_linkage.begin(),
+      mesh_iface.side_to_node_linkage.begin() + 2 * num_sides);
+
+  const int n_threads = test_threads();
+
+  Timer serial_timer;
+  serial_timer.start();
+  const Draco_Mesh serial_mesh(mesh_iface.dim, Draco_Mesh::Geometry::CARTESIAN,
+                               mesh_iface.cell_type, mesh_iface.cell_to_node_linkage,
+                               side_set_flag, side_node_count, side_to_node_linkage,
+                               mesh_iface.coordinates, mesh_iface.global_node_number,
+                               mesh_iface.face_type);
+  serial_timer.stop();
+
+  Timer threaded_timer;
+  threaded_timer.start();
+  const Draco_Mesh threaded_mesh(mesh_iface.dim, Draco_Mesh::Geometry::CARTESIAN,
+                                 mesh_iface.cell_type, mesh_iface.cell_to_node_linkage,
+                                 side_set_flag, side_node_count, side_to_node_linkage,
+                                 mesh_iface.coordinates, mesh_iface.global_node_number,
+                                 mesh_iface.face_type, {}, {}, {}, {}, n_threads);
+  threaded_timer.stop();
+
+  // the two boundary faces without a side were closed with vacuum sides
+  FAIL_IF_NOT(serial_mesh.get_side_set_flag().size() == num_sides + 2);
+
+  check_same_mesh(ut, serial_mesh, threaded_mesh);
+
+  std::cout << std::setprecision(4) << "\nDraco_Mesh construction with " << mesh_iface.num_cells
+            << " cells:\n  1 thread   : " << serial_timer.wall_clock() << " s\n  " << n_threads
+            << " thread(s): " << threaded_timer.wall_clock() << " s\n"
+            << std::endl;
+
+  if (ut.numFails == 0) {
+    PASSMSG("Threaded Draco_Mesh construction matches the serial construction");
+  } else {
+    FAILMSG("Threaded Draco_Mesh construction differs from the serial construction");
+  }
+}
+
+//------------------------------------------------------------------------------------------------//
+//! Time mesh startup (read and build) from an orthogonal X3D file, serial and threaded.
+void threaded_builder_startup(rtt_c4::ParallelUnitTest &ut) {
+
+  const size_t num_xdir = 200;
+  const size_t num_ydir = 150;
+  const std::string filename = "x3d.orth_threads.mesh.in";
+  write_orth_2d_x3d(filename, num_xdir, num_ydir);
+
+  Timer read_timer;
+  read_timer.start();
+  std::shared_ptr<X3D_Draco_Mesh_Reader> x3d_reader(new X3D_Draco_Mesh_Reader(filename));
+  x3d_reader->read_mesh();
+  read_timer.stop();
+
+  Draco_Mesh_Builder<X3D_Draco_Mesh_Reader> mesh_builder(x3d_reader);
+  const int n_threads = test_threads();
+
+  Timer serial_timer;
+  serial_timer.start();
+  std::shared_ptr<Draco_Mesh> serial_mesh =
+      mesh_builder.build_mesh(Draco_Mesh::Geometry::CARTESIAN);
+  serial_timer.stop();
+
+  Timer threaded_timer;
+  threaded_timer.start();
+  std::shared_ptr<Draco_Mesh> threaded_mesh =
+      mesh_builder.build_mesh(Draco_Mesh::Geometry::CARTESIAN, n_threads);
+  threaded_timer.stop();
+
+  FAIL_IF_NOT(serial_mesh->get_num_cells() == num_xdir * num_ydir);
+  FAIL_IF_NOT(serial_mesh->get_num_nodes() == (num_xdir + 1) * (num_ydir + 1));
+
+  // with no boundary files, every boundary face is a vacuum side
+  FAIL_IF_NOT(serial_mesh->get_side_set_flag().size() == 2 * (num_xdir + num_ydir));
+  FAIL_IF_NOT(serial_mesh->get_flat_cc_linkage().face_index.size() ==
+              2 * (2 * num_xdir * num_ydir - num_xdir - num_ydir));
+
+  check_same_mesh(ut, *serial_mesh, *threaded_mesh);
+
+  std::cout << std::setprecision(4) << "\nStartup of a " << num_xdir << "x" << num_ydir
+            << " orthogonal X3D mesh:\n  read       : " << read_timer.wall_clock()
+            << " s\n  build, 1 thread   : " << serial_timer.wall_clock() << " s\n  build, "
+            << n_threads << " thread(s): " << threaded_timer.wall_clock() << " s\n"
+            << std::endl;
+
+  if (ut.numFails == 0) {
+    PASSMSG("Threaded orthogonal X3D mesh build matches the serial build");
+  } else {
+    FAILMSG("Threaded orthogonal X3D mesh build differs from the serial build");
+  }
+}
+
+//------------------------------------------------------------------------------------------------//
+//! Check a threaded build of an unstructured 3D mesh with boundary files.
+void threaded_builder_3d(rtt_c4::ParallelUnitTest &ut) {
+
+  const std::string inputpath = ut.getTestSourcePath();
+  const std::string filename = inputpath + "x3d.rnd_mesh3d.in";
+  const std::vector<std::string> bdy_filenames = {
+      inputpath + "x3d.rnd_mesh3d.bdy1.in", inputpath + "x3d.rnd_mesh3d.bdy2.in",
+      inputpath + "x3d.rnd_mesh3d.bdy3.in", inputpath + "x3d.rnd_mesh3d.bdy4.in",
+      inputpath + "x3d.rnd_mesh3d.bdy5.in", inputpath + "x3d.rnd_mesh3d.bdy6.in"};
+  const std::vector<unsigned> bdy_flags = {3, 1, 0, 2, 1, 5};
+
+  std::shared_ptr<X3D_Draco_Mesh_Reader> x3d_reader(
+      new X3D_Draco_Mesh_Reader(filename, bdy_filenames, bdy_flags));
+  x3d_reader->read_mesh();
+
+  Draco_Mesh_Builder<X3D_Draco_Mesh_Reader> mesh_builder(x3d_reader);
+  std::shared_ptr<Draco_Mesh> serial_mesh =
+      mesh_builder.build_mesh(Draco_Mesh::Geometry::CARTESIAN);
+  std::shared_ptr<Draco_Mesh> threaded_mesh =
+      mesh_builder.build_mesh(Draco_Mesh::Geometry::CARTESIAN, test_threads());
+
+  FAIL_IF_NOT(serial_mesh->get_num_cells() == 64);
+  check_same_mesh(ut, *serial_mesh, *threaded_mesh);
+
+  if (ut.numFails == 0) {
+    PASSMSG("Threaded 3D X3D mesh build matches the serial build");
+  } else {
+    FAILMSG("Threaded 3D X3D mesh build differs from the serial build");
+  }
+}
+
+//------------------------------------------------------------------------------------------------//
+//! Check that a DBC failure inside a threaded construction loop reaches the caller.
+void threaded_dbc_failure(rtt_c4::ParallelUnitTest &ut) {
+#if DBC & 1
+  rtt_mesh_test::Test_Mesh_Interface mesh_iface(3, 2);
+
+  // a face without nodes breaks the precondition of the face hash inside the threaded loop
+  std::vector<unsigned> face_type(mesh_iface.face_type);
+  const auto face_nodes = static_cast<std::ptrdiff_t>(face_type[0]);
+  face_type[0] = 0;
+  const std::vector<unsigned> cell_to_node_linkage(
+      mesh_iface.cell_to_node_linkage.begin() + face_nodes, mesh_iface.cell_to_node_linkage.end());
+
+  bool caught = false;
+  try {
+    const Draco_Mesh mesh(mesh_iface.dim, Draco_Mesh::Geometry::CARTESIAN, mesh_iface.cell_type,
+                          cell_to_node_linkage, mesh_iface.side_set_flag,
+                          mesh_iface.side_node_count, mesh_iface.side_to_node_linkage,
+                          mesh_iface.coordinates, mesh_iface.global_node_number, face_type, {},
+                          {}, {}, {}, test_threads());
+  } catch (rtt_dsxx::assertion & /*error*/) {
+    caught = true;
+  }
+  FAIL_IF_NOT(caught);
+
+  if (ut.numFails == 0)
+    PASSMSG("Threaded Draco_Mesh DBC failure is rethrown to the caller");
+#else
+  PASSMSG("Threaded Draco_Mesh DBC failure test requires DBC preconditions");
+#endif
+}
+
+//------------------------------------------------------------------------------------------------//
+int main(int argc, char *argv[]) {
+  rtt_c4::ParallelUnitTest ut(argc, argv, rtt_dsxx::release);
+  try {
+    threaded_construction(ut);
+    threaded_builder_startup(ut);
+    threaded_builder_3d(ut);
+    threaded_dbc_failure(ut);
+  }
+  UT_EPILOG(ut);
+}
+
+//------------------------------------------------------------------------------------------------//
+// end of mesh/test/tstDraco_Mesh_threads.cc
+//------------------------------------------------------------------------------------------------//
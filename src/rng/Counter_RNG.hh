@@ -151,6 +151,87 @@ GPU_HOST_DEVICE inline double _ran(ctr_type::value_type *const data) {
   return r123::u01fixedpt<double, ctr_type::value_type>(result[0]);
 }
 
+//------------------------------------------------------------------------------------------------//
+/*! \brief Fill a buffer with random doubles.
+ *
+ * Given a pointer to RNG state data, this function writes n random doubles in the open interval
+ * (0, 1) to out, using both 64-bit words of every Threefry2x64 output.  The stream layout is:
+ *
+ * \verbatim
+ *   counter c+k (k = 0, ..., ceil(n/2)-1) -> result[0] -> out[2k]
+ *                                         -> result[1] -> out[2k+1]   (if 2k+1 < n)
+ * \endverbatim
+ *
+ * where c is the counter held in data[0:1] on entry, and the counter is advanced by ceil(n/2).
+ * Because out[2k] is generated from result[0] of the same counter that the (k+1)-th call to ran()
+ * would use, the even entries of a fill reproduce the ran() sequence and fill(out, 1) is identical
+ * to ran().  The odd entries are the otherwise discarded second words.  The sequence is therefore
+ * independent of how a fill is split into smaller fills, as long as each piece has even length.
+ *
+ * Each counter is formed directly from its offset k (instead of repeated increments), so the cipher
+ * evaluations in the main loop are independent of each other and can be vectorized.
+ */
+GPU_HOST_DEVICE inline void _fill(ctr_type::value_type *const data, double *const out,
+                                  const size_t n) {
+  CBRNG rng;
+  const key_type key = {{data[2], data[3]}};
+  const ctr_type::value_type ctr_lo = data[0];
+  const ctr_type::value_type ctr_hi = data[1];
+  const size_t n_pairs = n / 2;
+  const size_t n_ctr = n_pairs + n % 2;
+
+  for (size_t k = 0; k < n_pairs; ++k) {
+    // the low word wraps into the high word exactly as ctr_type::incr() does
+    const ctr_type::value_type lo = ctr_lo + k;
+    const ctr_type ctr = {{lo, ctr_hi + static_cast<ctr_type::value_type>(lo < ctr_lo)}};
+    const ctr_type result = rng(ctr, key);
+    out[2 * k] = r123::u01fixedpt<double, ctr_type::value_type>(result[0]);
+    out[2 * k + 1] = r123::u01fixedpt<double, ctr_type::value_type>(result[1]);
+  }
+  if (n_ctr > n_pairs) {
+    const ctr_type::value_type lo = ctr_lo + n_pairs;
+    const ctr_type ctr = {{lo, ctr_hi + static_cast<ctr_type::value_type>(lo < ctr_lo)}};
+    const ctr_type result = rng(ctr, key);
+    out[n - 1] = r123::u01fixedpt<double, ctr_type::value_type>(result[0]);
+  }
+
+  // Advance the counter past every counter used above.
+  data[0] = ctr_lo + n_ctr;
+  data[1] = ctr_hi + static_cast<ctr_type::value_type>(data[0] < ctr_lo);
+}
+
+//------------------------------------------------------------------------------------------------//
+/*! \brief Advance a spawn identifier down the spawn tree.
+ *
+ * Given the spawn identifier (data[3]) of a parent generator, this function shifts the parent to
+ * its next left child in place and returns the identifier of the new (right) child.  See
+ * Counter_RNG::_spawn for a description of the tree traversal.
+ */
+GPU_HOST_DEVICE inline ctr_type::value_type _spawn_id(ctr_type::value_type &parent_id) {
+  ctr_type::value_type next_id = parent_id;
+
+  // If the child generator would overflow the key...
+  if (2 * parent_id + 2 < parent_id) {
+    // ... look back up the tree for the parent of the first spawned child; it will be the first
+    // even-numbered node...
+    while (next_id % 2)
+      next_id = (next_id - 1) / 2;
+
+    // ... shift to the right subtree of that original parent...
+    next_id = 2 * next_id + 2;
+
+    // ... and wrap back to 0 if we've run out of subtrees.
+    if (next_id > parent_id)
+      next_id = 0;
+  }
+
+  // Shift the parent to the left child.
+  parent_id = 2 * next_id + 1;
+
+  // The new generator is the right child.
+  return parent_id + 1;
+}
+
 } // namespace
 
 //================================================================================================//
@@ -178,6 +259,10 @@ public:
   GPU_HOST_DEVICE
   double ran() const { return _ran(data.access()); }
 
+  //! Fill out[0:n) with random doubles in (0, 1), using both words of each cipher output.
+  GPU_HOST_DEVICE
+  void fill(double *const out, const size_t n) const { _fill(data.access(), out, n); }
+
   //! Spawn a new, independent generator from this reference.
   inline void spawn(Counter_RNG &new_gen) const;
 
@@ -205,6 +290,9 @@ private:
  * Counter_RNG provides an interface to a counter-based random number generator from the Random123
  * library from D. E. Shaw Research (http://www.deshawresearch.com/resources_random123.html).
  *
+ * ran() returns one double per cipher call.  fill() returns two doubles per cipher call by also
+ * using the second output word; see _fill for the (reproducible) stream layout it follows.
+ *
  * Counter_RNG_Ref is a friend of Counter_RNG because spawning a new generator modifies both the
  * parent and the child generator in ways that should not be exposed through the public interface of
  * Counter_RNG.
@@ -213,11 +301,13 @@ private:
  * access to private data that should not be exposed through the public interface.  Rnd_Control
  * takes no responsibility for instantiating Counter_RNGs itself, and since copying Counter_RNGs is
  * disabled (via a private copy constructor), an Rnd_Control must be able to initialize a generator
- * that was instantiated outside of its control.
+ * that was instantiated outside of its control.  Counter_RNG_Bank is a friend for the same reason:
+ * it moves generator state into and out of its structure-of-arrays storage.
  */
 //================================================================================================//
 class Counter_RNG {
   friend class Counter_RNG_Ref;
+  friend class Counter_RNG_Bank;
   friend class Rnd_Control;
 
 public:
@@ -260,6 +350,10 @@ public:
   GPU_HOST_DEVICE
   double ran() const { return _ran(&data[0]); }
 
+  //! Fill out[0:n) with random doubles in (0, 1), using both words of each cipher output.
+  GPU_HOST_DEVICE
+  void fill(double *const out, const size_t n) const { _fill(&data[0], out, n); }
+
   //! Spawn a new, independent generator from this one.
   void spawn(Counter_RNG &new_gen) const { new_gen._spawn(&data[0]); }
 
@@ -397,28 +491,8 @@ inline void Counter_RNG::_spawn(ctr_type::value_type *const parent_data) {
   uint64_t streamnum = parent_data[2];
   initialize(seed, streamnum);
 
-  ctr_type::value_type next_id = parent_data[3];
-
-  // If the child generator would overflow the key...
-  if (2 * parent_data[3] + 2 < parent_data[3]) {
-    // ... look back up the tree for the parent of the first spawned child; it will be the first
-    // even-numbered node...
-    while (next_id % 2)
-      next_id = (next_id - 1) / 2;
-
-    // ... shift to the right subtree of that original parent...
-    next_id = 2 * next_id + 2;
-
-    // ... and wrap back to 0 if we've run out of subtrees.
-    if (next_id > parent_data[3])
-      next_id = 0;
-  }
-
-  // Shift the parent to the left child.
-  parent_data[3] = 2 * next_id + 1;
-
-  // Shift this generator to the right child.
-  data[3] = parent_data[3] + 1;
+  // Shift the parent to the left child and this generator to the right child.
+  data[3] = _spawn_id(parent_data[3]);
 }
 
 } // end namespace rtt_rng
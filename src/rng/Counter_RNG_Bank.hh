@@ -0,0 +1,236 @@
+//--------------------------------------------*-C++-*---------------------------------------------//
+/*!
+ * \file   rng/Counter_RNG_Bank.hh
+ * \author agent
+ * \brief  Declaration of class Counter_RNG_Bank.
+ * \note   Copyright (C) 2026 Triad National Security, LLC., All rights reserved. */
+//------------------------------------------------------------------------------------------------//
+
+#ifndef rtt_rng_Counter_RNG_Bank_hh
+#define rtt_rng_Counter_RNG_Bank_hh
+
+#include "Counter_RNG.hh"
+#include <vector>
+
+namespace rtt_rng {
+
+//================================================================================================//
+/*!
+ * \class Counter_RNG_Bank
+ * \brief Structure-of-arrays storage for many Counter_RNG streams.
+ *
+ * A Counter_RNG_Bank holds the state of N independent generators with each of the four state
+ * words of Counter_RNG (counter low, counter high/seed, stream number, spawn identifier) stored in
+ * its own contiguous array.  Batched ran() and spawn() operate over a range of streams in a single
+ * loop with no per-generator objects, so event-based transport can draw one number for every
+ * particle in a batch at once.
+ *
+ * Every operation is bit-identical to the same operation on a Counter_RNG with the same state:
+ * stream i of a bank produces exactly the sequence (and the spawned children) that a Counter_RNG
+ * loaded from it would.  load() and store() move single generators in and out of the bank, and
+ * pack() and unpack() convert the whole bank to and from one contiguous buffer in the Counter_RNG
+ * state layout ([stream][CBRNG_DATA_SIZE]), e.g. for checkpointing.
+ */
+//================================================================================================//
+class Counter_RNG_Bank {
+public:
+  using value_type = ctr_type::value_type;
+
+  //! Constructor; all streams start with zero state.
+  explicit Counter_RNG_Bank(const size_t n_streams = 0)
+      : ctr_lo(n_streams, 0), ctr_hi(n_streams, 0), key_lo(n_streams, 0), key_hi(n_streams, 0) {}
+
+  //! Return the number of streams in the bank.
+  size_t size() const { return ctr_lo.size(); }
+
+  //! Change the number of streams; new streams start with zero state.
+  void resize(const size_t n_streams) {
+    ctr_lo.resize(n_streams, 0);
+    ctr_hi.resize(n_streams, 0);
+    key_lo.resize(n_streams, 0);
+    key_hi.resize(n_streams, 0);
+  }
+
+  //! Initialize stream i from a seed and stream number (as Counter_RNG(seed, streamnum) does).
+  inline void initialize(const size_t i, const uint32_t seed, const uint64_t streamnum);
+
+  //! Copy the state of a generator into stream i.
+  inline void load(const size_t i, const Counter_RNG &rng);
+
+  //! Copy stream i into a generator.
+  inline void store(const size_t i, Counter_RNG &rng) const;
+
+  //! Return a random double in (0, 1) from stream i.
+  double ran(const size_t i) {
+    double x = 0.0;
+    ran(i, 1, &x);
+    return x;
+  }
+
+  //! Draw one random double from each of the streams [first, first + n) into out[0:n).
+  inline void ran(const size_t first, const size_t n, double *const out);
+
+  //! Draw one random double from every stream into out[0:size()).
+  void ran(double *const out) { ran(0, size(), out); }
+
+  //! Spawn a child from each stream [first, first + n) into children streams [child_first, ...).
+  inline void spawn(const size_t first, const size_t n, Counter_RNG_Bank &children,
+                    const size_t child_first);
+
+  //! Return the stream number of stream i.
+  uint64_t get_num(const size_t i) const {
+    Require(i < size());
+    return key_lo[i];
+  }
+
+  //! Return the unique identifier of stream i.
+  uint64_t get_unique_num(const size_t i) const {
+    Require(i < size());
+    const value_type data[CBRNG_DATA_SIZE] = {ctr_lo[i], ctr_hi[i], key_lo[i], key_hi[i]};
+    return _get_unique_num(data);
+  }
+
+  //! Write every stream into one contiguous buffer in Counter_RNG state layout.
+  inline std::vector<value_type> pack() const;
+
+  //! Replace the bank with the streams stored in a buffer produced by pack().
+  inline void unpack(const std::vector<value_type> &buffer);
+
+private:
+  //! Low bits of the counters (Counter_RNG data[0]).
+  std::vector<value_type> ctr_lo;
+  //! High bits of the counters; holds the seed (Counter_RNG data[1]).
+  std::vector<value_type> ctr_hi;
+  //! Low bits of the keys; the stream numbers (Counter_RNG data[2]).
+  std::vector<value_type> key_lo;
+  //! High bits of the keys; the spawn identifiers (Counter_RNG data[3]).
+  std::vector<value_type> key_hi;
+};
+
+//------------------------------------------------------------------------------------------------//
+// Implementation
+//------------------------------------------------------------------------------------------------//
+
+//! Initialize stream i from a seed and stream number.
+inline void Counter_RNG_Bank::initialize(const size_t i, const uint32_t seed,
+                                         const uint64_t streamnum) {
+  Require(i < size());
+  ctr_lo[i] = 0;
+  ctr_hi[i] = static_cast<uint64_t>(seed) << 32U;
+  key_lo[i] = streamnum;
+  key_hi[i] = 0;
+}
+
+//------------------------------------------------------------------------------------------------//
+//! Copy the state of a generator into stream i.
+inline void Counter_RNG_Bank::load(const size_t i, const Counter_RNG &rng) {
+  Require(i < size());
+  ctr_lo[i] = rng.data[0];
+  ctr_hi[i] = rng.data[1];
+  key_lo[i] = rng.data[2];
+  key_hi[i] = rng.data[3];
+}
+
+//------------------------------------------------------------------------------------------------//
+//! Copy stream i into a generator.
+inline void Counter_RNG_Bank::store(const size_t i, Counter_RNG &rng) const {
+  Require(i < size());
+  rng.data[0] = ctr_lo[i];
+  rng.data[1] = ctr_hi[i];
+  rng.data[2] = key_lo[i];
+  rng.data[3] = key_hi[i];
+}
+
+//------------------------------------------------------------------------------------------------//
+/*! \brief Draw one random double from each stream in a range.
+ *
+ * The loop body is the Counter_RNG _ran kernel applied to stream i; the streams are independent, so
+ * the loop can be vectorized across them.
+ *
+ * \param[in] first index of the first stream
+ * \param[in] n number of streams
+ * \param[out] out random doubles in (0, 1), out[k] drawn from stream first + k
+ */
+inline void Counter_RNG_Bank::ran(const size_t first, const size_t n, double *const out) {
+  Require(first + n <= size());
+  Require(n == 0 || out != nullptr);
+  CBRNG rng;
+  value_type *const lo = ctr_lo.data() + first;
+  value_type *const hi = ctr_hi.data() + first;
+  const value_type *const klo = key_lo.data() + first;
+  const value_type *const khi = key_hi.data() + first;
+  for (size_t k = 0; k < n; ++k) {
+    ctr_type ctr = {{lo[k], hi[k]}};
+    const key_type key = {{klo[k], khi[k]}};
+    const ctr_type result = rng(ctr, key);
+    ctr.incr();
+    lo[k] = ctr[0];
+    hi[k] = ctr[1];
+    out[k] = r123::u01fixedpt<double, value_type>(result[0]);
+  }
+}
+
+//------------------------------------------------------------------------------------------------//
+/*! \brief Spawn a new, independent generator from each stream in a range.
+ *
+ * Stream first + k is the parent of children stream child_first + k, exactly as
+ * Counter_RNG::spawn would do for a single generator: the child gets the parent's seed and stream
+ * number with a fresh counter, and both parent and child move down the spawn tree.  The children
+ * may live in this bank as long as the parent and child ranges do not overlap.
+ *
+ * \param[in] first index of the first parent stream
+ * \param[in] n number of parents
+ * \param[in,out] children bank that receives the new generators
+ * \param[in] child_first index of the first child stream in children
+ */
+inline void Counter_RNG_Bank::spawn(const size_t first, const size_t n, Counter_RNG_Bank &children,
+                                    const size_t child_first) {
+  Require(first + n <= size());
+  Require(child_first + n <= children.size());
+  Require(&children != this || child_first >= first + n || child_first + n <= first);
+  for (size_t k = 0; k < n; ++k) {
+    const size_t p = first + k;
+    const size_t c = child_first + k;
+    children.ctr_lo[c] = 0;
+    children.ctr_hi[c] = ctr_hi[p] & 0xffffffff00000000ULL; // seed only, counter reset
+    children.key_lo[c] = key_lo[p];
+    children.key_hi[c] = _spawn_id(key_hi[p]);
+  }
+}
+
+//------------------------------------------------------------------------------------------------//
+//! Write every stream into one contiguous buffer in Counter_RNG state layout.
+inline std::vector<Counter_RNG_Bank::value_type> Counter_RNG_Bank::pack() const {
+  const size_t n = size();
+  std::vector<value_type> buffer(n * CBRNG_DATA_SIZE);
+  for (size_t i = 0; i < n; ++i) {
+    buffer[i * CBRNG_DATA_SIZE] = ctr_lo[i];
+    buffer[i * CBRNG_DATA_SIZE + 1] = ctr_hi[i];
+    buffer[i * CBRNG_DATA_SIZE + 2] = key_lo[i];
+    buffer[i * CBRNG_DATA_SIZE + 3] = key_hi[i];
+  }
+  return buffer;
+}
+
+//------------------------------------------------------------------------------------------------//
+//! Replace the bank with the streams stored in a buffer produced by pack().
+inline void Counter_RNG_Bank::unpack(const std::vector<value_type> &buffer) {
+  Insist(buffer.size() % CBRNG_DATA_SIZE == 0,
+         "Counter_RNG_Bank::unpack buffer size must be a multiple of CBRNG_DATA_SIZE");
+  const size_t n = buffer.size() / CBRNG_DATA_SIZE;
+  resize(n);
+  for (size_t i = 0; i < n; ++i) {
+    ctr_lo[i] = buffer[i * CBRNG_DATA_SIZE];
+    ctr_hi[i] = buffer[i * CBRNG_DATA_SIZE + 1];
+    key_lo[i] = buffer[i * CBRNG_DATA_SIZE + 2];
+    key_hi[i] = buffer[i * CBRNG_DATA_SIZE + 3];
+  }
+}
+
+} // end namespace rtt_rng
+
+#endif // rtt_rng_Counter_RNG_Bank_hh
+
+//------------------------------------------------------------------------------------------------//
+// end of rng/Counter_RNG_Bank.hh
+//------------------------------------------------------------------------------------------------//
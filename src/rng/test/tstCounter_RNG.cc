@@ -675,6 +675,85 @@ void test_unique(UnitTest &ut) {
     PASSMSG("test_unique passed");
 }
 
+//------------------------------------------------------------------------------------------------//
+void test_fill(UnitTest &ut) {
+  uint32_t seed = 0x2468ace;
+  uint64_t streamnum = 77;
+
+  // fill(out, 1) is identical to ran().
+  {
+    Counter_RNG rng(seed, streamnum);
+    Counter_RNG rng2(seed, streamnum);
+    double x = 0.0;
+    rng.fill(&x, 1);
+    FAIL_IF_NOT(soft_equiv(x, rng2.ran()));
+    FAIL_IF_NOT(rng == rng2);
+  }
+
+  // The even entries of a fill reproduce the ran() sequence, and the counter advances by
+  // ceil(n/2).
+  const size_t n = 37;
+  vector<double> block(n, 0.0);
+  {
+    Counter_RNG rng(seed, streamnum);
+    Counter_RNG rng2(seed, streamnum);
+    rng.fill(block.data(), n);
+    for (size_t i = 0; i < n; i += 2)
+      FAIL_IF_NOT(soft_equiv(block[i], rng2.ran()));
+    FAIL_IF_NOT(rng == rng2);
+    for (auto const x : block)
+      FAIL_IF_NOT(x > 0.0 && x < 1.0);
+    // the odd entries are new values, not repeats of the even ones
+    std::set<double> values(block.begin(), block.end());
+    FAIL_IF_NOT(values.size() == n);
+  }
+
+  // Splitting a fill into even-length pieces does not change the stream.
+  {
+    Counter_RNG rng(seed, streamnum);
+    vector<double> pieces(n, 0.0);
+    rng.fill(&pieces[0], 10);
+    rng.fill(&pieces[10], 4);
+    rng.fill(&pieces[14], n - 14);
+    FAIL_IF_NOT(pieces == block);
+  }
+
+  // Counter_RNG_Ref fills the same stream and updates the referenced state.
+  {
+    vector<uint64_t> data(CBRNG_DATA_SIZE);
+    data[0] = 0;
+    data[1] = static_cast<uint64_t>(seed) << 32U;
+    data[2] = streamnum;
+    data[3] = 0;
+    Counter_RNG_Ref ref(&data[0], &data[0] + CBRNG_DATA_SIZE);
+    vector<double> ref_block(n, 0.0);
+    ref.fill(ref_block.data(), n);
+    FAIL_IF_NOT(ref_block == block);
+    FAIL_IF_NOT(data[0] == (n + 1) / 2);
+  }
+
+  // The counter carries into the high word exactly as repeated ran() calls do.
+  {
+    vector<uint64_t> data(CBRNG_DATA_SIZE);
+    data[0] = 0xfffffffffffffffd;
+    data[1] = 1;
+    data[2] = 0xabcd;
+    data[3] = 0xef00;
+    Counter_RNG rng(&data[0], &data[0] + CBRNG_DATA_SIZE);
+    Counter_RNG rng2(&data[0], &data[0] + CBRNG_DATA_SIZE);
+    vector<double> wrap(9, 0.0);
+    rng.fill(wrap.data(), wrap.size());
+    for (size_t i = 0; i < wrap.size(); i += 2)
+      FAIL_IF_NOT(soft_equiv(wrap[i], rng2.ran()));
+    FAIL_IF_NOT(rng == rng2);
+    FAIL_IF_NOT(*rng.begin() == 2);
+    FAIL_IF_NOT(*(rng.begin() + 1) == 2);
+  }
+
+  if (ut.numFails == 0)
+    PASSMSG("test_fill passed");
+}
+
 //------------------------------------------------------------------------------------------------//
 int main(int argc, char *argv[]) {
   ScalarUnitTest ut(argc, argv, release);
@@ -685,6 +764,7 @@ int main(int argc, char *argv[]) {
     test_rollover(ut);
     test_spawn(ut);
     test_unique(ut);
+    test_fill(ut);
   }
   UT_EPILOG(ut);
 }
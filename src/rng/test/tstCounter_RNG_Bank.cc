@@ -0,0 +1,155 @@
+//--------------------------------------------*-C++-*---------------------------------------------//
+/*!
+ * \file   rng/test/tstCounter_RNG_Bank.cc
+ * \author agent
+ * \brief  Counter_RNG_Bank tests.
+ * \note   Copyright (C) 2026 Triad National Security, LLC., All rights reserved. */
+//------------------------------------------------------------------------------------------------//
+
+#include "ds++/Release.hh"
+#include "ds++/ScalarUnitTest.hh"
+#include "ds++/Soft_Equivalence.hh"
+#include "rng/Counter_RNG_Bank.hh"
+#include <memory>
+
+using namespace std;
+using namespace rtt_dsxx;
+using namespace rtt_rng;
+
+//------------------------------------------------------------------------------------------------//
+// TESTS
+//------------------------------------------------------------------------------------------------//
+
+void test_ran(UnitTest &ut) {
+  const uint32_t seed = 0x5eed;
+  const size_t n = 17;
+
+  // A bank and a set of individual generators with the same seeds and stream numbers.
+  Counter_RNG_Bank bank(n);
+  vector<unique_ptr<Counter_RNG>> rngs;
+  for (size_t i = 0; i < n; ++i) {
+    bank.initialize(i, seed, 100 + i);
+    rngs.emplace_back(new Counter_RNG(seed, 100 + i));
+    FAIL_IF_NOT(bank.get_num(i) == rngs[i]->get_num());
+    FAIL_IF_NOT(bank.get_unique_num(i) == rngs[i]->get_unique_num());
+  }
+
+  // Batched draws over every stream, a sub-range and a single stream all follow the per-object
+  // sequences.
+  vector<double> x(n, 0.0);
+  for (size_t round = 0; round < 5; ++round) {
+    bank.ran(x.data());
+    for (size_t i = 0; i < n; ++i)
+      FAIL_IF_NOT(soft_equiv(x[i], rngs[i]->ran()));
+  }
+  bank.ran(3, 6, x.data());
+  for (size_t k = 0; k < 6; ++k)
+    FAIL_IF_NOT(soft_equiv(x[k], rngs[3 + k]->ran()));
+  FAIL_IF_NOT(soft_equiv(bank.ran(n - 1), rngs[n - 1]->ran()));
+
+  // The full state matches after the draws.
+  Counter_RNG check;
+  for (size_t i = 0; i < n; ++i) {
+    bank.store(i, check);
+    FAIL_IF_NOT(check == *rngs[i]);
+  }
+
+  if (ut.numFails == 0)
+    PASSMSG("test_ran passed");
+}
+
+//------------------------------------------------------------------------------------------------//
+void test_spawn(UnitTest &ut) {
+  const size_t n = 8;
+  Counter_RNG_Bank bank(n);
+  vector<unique_ptr<Counter_RNG>> rngs;
+  for (size_t i = 0; i < n; ++i) {
+    rngs.emplace_back(new Counter_RNG(0xabcdef, i));
+    rngs[i]->ran();
+    bank.load(i, *rngs[i]);
+  }
+
+  // Put one parent deep in the spawn tree to exercise the overflow path.
+  {
+    vector<uint64_t> data(rngs[5]->begin(), rngs[5]->end());
+    data[3] = 0xfffffffffffffffe;
+    rngs[5].reset(new Counter_RNG(&data[0], &data[0] + CBRNG_DATA_SIZE));
+    bank.load(5, *rngs[5]);
+  }
+
+  // Spawn repeatedly into a separate bank and into the back half of the same bank.
+  Counter_RNG_Bank children(n);
+  Counter_RNG child;
+  Counter_RNG check;
+  for (size_t generation = 0; generation < 3; ++generation) {
+    bank.spawn(0, n, children, 0);
+    for (size_t i = 0; i < n; ++i) {
+      rngs[i]->spawn(child);
+      children.store(i, check);
+      FAIL_IF_NOT(check == child);
+      bank.store(i, check);
+      FAIL_IF_NOT(check == *rngs[i]);
+    }
+  }
+  Counter_RNG_Bank wide(2 * n);
+  for (size_t i = 0; i < n; ++i)
+    wide.load(i, *rngs[i]);
+  wide.spawn(0, n, wide, n);
+  for (size_t i = 0; i < n; ++i) {
+    rngs[i]->spawn(child);
+    wide.store(n + i, check);
+    FAIL_IF_NOT(check == child);
+    FAIL_IF_NOT(soft_equiv(wide.ran(n + i), child.ran()));
+  }
+
+  if (ut.numFails == 0)
+    PASSMSG("test_spawn passed");
+}
+
+//------------------------------------------------------------------------------------------------//
+void test_pack(UnitTest &ut) {
+  const size_t n = 5;
+  Counter_RNG_Bank bank(n);
+  for (size_t i = 0; i < n; ++i)
+    bank.initialize(i, 42, 7 * i);
+  vector<double> x(n, 0.0);
+  bank.ran(x.data());
+
+  // The packed buffer holds each stream in Counter_RNG layout.
+  const vector<uint64_t> buffer = bank.pack();
+  FAIL_IF_NOT(buffer.size() == n * CBRNG_DATA_SIZE);
+  Counter_RNG check;
+  for (size_t i = 0; i < n; ++i) {
+    bank.store(i, check);
+    FAIL_IF_NOT(std::equal(check.begin(), check.end(), buffer.begin() + i * CBRNG_DATA_SIZE));
+  }
+
+  // Restoring the buffer resumes the same streams.
+  Counter_RNG_Bank restored;
+  restored.unpack(buffer);
+  FAIL_IF_NOT(restored.size() == n);
+  vector<double> y(n, 0.0);
+  bank.ran(x.data());
+  restored.ran(y.data());
+  for (size_t i = 0; i < n; ++i)
+    FAIL_IF_NOT(soft_equiv(x[i], y[i]));
+  FAIL_IF_NOT(restored.pack() == bank.pack());
+
+  if (ut.numFails == 0)
+    PASSMSG("test_pack passed");
+}
+
+//------------------------------------------------------------------------------------------------//
+int main(int argc, char *argv[]) {
+  ScalarUnitTest ut(argc, argv, release);
+  try {
+    test_ran(ut);
+    test_spawn(ut);
+    test_pack(ut);
+  }
+  UT_EPILOG(ut);
+}
+
+//------------------------------------------------------------------------------------------------//
+// end of tstCounter_RNG_Bank.cc
+//------------------------------------------------------------------------------------------------//